@@ -0,0 +1,37 @@
+#pragma once
+
+namespace IL2CPP
+{
+	namespace GCHandle
+	{
+		// Weak handles do not keep the target alive; GetTarget returns nullptr once it is collected.
+		inline bool IsAvailable()
+		{
+			return Functions.m_GCHandleNewWeakRef && Functions.m_GCHandleGetTarget && Functions.m_GCHandleFree;
+		}
+
+		inline uint32_t NewWeakRef(void* m_Object, bool m_TrackResurrection = false)
+		{
+			if (!Functions.m_GCHandleNewWeakRef || !m_Object)
+				return 0;
+
+			return reinterpret_cast<uint32_t(IL2CPP_CALLING_CONVENTION)(void*, bool)>(Functions.m_GCHandleNewWeakRef)(m_Object, m_TrackResurrection);
+		}
+
+		inline Unity::il2cppObject* GetTarget(uint32_t m_Handle)
+		{
+			if (!Functions.m_GCHandleGetTarget || !m_Handle)
+				return nullptr;
+
+			return reinterpret_cast<Unity::il2cppObject*(IL2CPP_CALLING_CONVENTION)(uint32_t)>(Functions.m_GCHandleGetTarget)(m_Handle);
+		}
+
+		inline void Free(uint32_t m_Handle)
+		{
+			if (!Functions.m_GCHandleFree || !m_Handle)
+				return;
+
+			reinterpret_cast<void(IL2CPP_CALLING_CONVENTION)(uint32_t)>(Functions.m_GCHandleFree)(m_Handle);
+		}
+	}
+}
@@ -42,6 +42,10 @@ namespace IL2CPP
 
 		void* m_FieldStaticGetValue = nullptr;
 		void* m_FieldStaticSetValue = nullptr;
+
+		void* m_GCHandleNewWeakRef = nullptr;
+		void* m_GCHandleGetTarget = nullptr;
+		void* m_GCHandleFree = nullptr;
 	};
 	Functions_t Functions;
 }
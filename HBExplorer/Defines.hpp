@@ -24,6 +24,9 @@
 #define IL2CPP_CLASS_FROM_IL2CPP_TYPE					IL2CPP_RStr("il2cpp_class_from_il2cpp_type")
 #define IL2CPP_FIELD_STATIC_GET_VALUE					IL2CPP_RStr("il2cpp_field_static_get_value")
 #define IL2CPP_FIELD_STATIC_SET_VALUE					IL2CPP_RStr("il2cpp_field_static_set_value")
+#define IL2CPP_GCHANDLE_NEW_WEAKREF						IL2CPP_RStr("il2cpp_gchandle_new_weakref")
+#define IL2CPP_GCHANDLE_GET_TARGET						IL2CPP_RStr("il2cpp_gchandle_get_target")
+#define IL2CPP_GCHANDLE_FREE							IL2CPP_RStr("il2cpp_gchandle_free")
 
 // Calling Convention
 #ifdef _WIN64
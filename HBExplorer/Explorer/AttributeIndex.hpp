@@ -0,0 +1,189 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Bitset.hpp"
+
+namespace UExplorer
+{
+    enum class AttributeKind : uint8_t
+    {
+        Active,      // activeInHierarchy
+        ActiveSelf,
+        Root,
+        Layer,       // value = layer 0..31
+        DepthBucket, // value = DepthBucketOf(depth)
+        External     // caller-supplied bitmap, e.g. has-component
+    };
+
+    struct AttributeTerm
+    {
+        AttributeKind kind = AttributeKind::Active;
+        int value = 0;
+        bool negate = false;
+        const Bitset* external = nullptr; // AttributeKind::External only
+    };
+
+    // One bitmap per attribute value over object ids, so compound filters reduce to word-wise
+    // AND / AND NOT over the object table instead of per-row checks. Each id's attributes are
+    // also kept packed, so updating an object only flips the bits of what changed. Scene
+    // membership is not indexed: scenes are contiguous layout ranges already.
+    struct AttributeIndex
+    {
+        static constexpr uint32_t kLayerCount = 32;
+        static constexpr uint32_t kDepthBucketCount = 6; // 0, 1, 2, 3, 4-7, 8+
+
+        // Packed per-id layout: present, active, activeSelf, root, layer + 1 (0 = unknown),
+        // depth bucket. An id that was never set is in no bitmap.
+        static constexpr uint16_t kPresentBit = 1U << 0;
+        static constexpr uint16_t kActiveBit = 1U << 1;
+        static constexpr uint16_t kActiveSelfBit = 1U << 2;
+        static constexpr uint16_t kRootBit = 1U << 3;
+        static constexpr uint32_t kLayerShift = 4;
+        static constexpr uint32_t kDepthShift = 10;
+
+        size_t objectCount = 0;
+        Bitset active;
+        Bitset activeSelf;
+        Bitset root;
+        Bitset layers[kLayerCount];
+        Bitset depthBuckets[kDepthBucketCount];
+        std::vector<uint16_t> packed;
+
+        static uint32_t DepthBucketOf(uint32_t depth)
+        {
+            if (depth < 4U)
+                return depth;
+            return depth < 8U ? 4U : 5U;
+        }
+
+        void Reset(size_t count)
+        {
+            objectCount = count;
+            active.Resize(count);
+            activeSelf.Resize(count);
+            root.Resize(count);
+            for (Bitset& layer : layers)
+                layer.Resize(count);
+            for (Bitset& bucket : depthBuckets)
+                bucket.Resize(count);
+            packed.assign(count, 0);
+        }
+
+        // Keeps what ids below both counts hold; new ids are in no bitmap until set.
+        void Resize(size_t count)
+        {
+            objectCount = count;
+            active.ResizeKeep(count);
+            activeSelf.ResizeKeep(count);
+            root.ResizeKeep(count);
+            for (Bitset& layer : layers)
+                layer.ResizeKeep(count);
+            for (Bitset& bucket : depthBuckets)
+                bucket.ResizeKeep(count);
+            packed.resize(count, 0);
+        }
+
+        static uint16_t Pack(bool isActive, bool isActiveSelf, bool isRoot, int layer, uint32_t depth)
+        {
+            const uint32_t layerCode = (layer >= 0 && static_cast<uint32_t>(layer) < kLayerCount) ? static_cast<uint32_t>(layer) + 1U : 0U;
+            return static_cast<uint16_t>(kPresentBit
+                | (isActive ? kActiveBit : 0U)
+                | (isActiveSelf ? kActiveSelfBit : 0U)
+                | (isRoot ? kRootBit : 0U)
+                | (layerCode << kLayerShift)
+                | (DepthBucketOf(depth) << kDepthShift));
+        }
+
+        // layer < 0 means unknown; the object then sits in no layer bitmap. Returns false when
+        // nothing about the object changed.
+        bool SetObject(uint32_t id, bool isActive, bool isActiveSelf, bool isRoot, int layer, uint32_t depth)
+        {
+            const uint16_t next = Pack(isActive, isActiveSelf, isRoot, layer, depth);
+            const uint16_t previous = packed[id];
+            if (next == previous)
+                return false;
+
+            Apply(id, previous, false);
+            Apply(id, next, true);
+            packed[id] = next;
+            return true;
+        }
+
+        bool IsActive(uint32_t id) const
+        {
+            return (packed[id] & kActiveBit) != 0;
+        }
+
+        void Apply(uint32_t id, uint16_t bits, bool set)
+        {
+            if ((bits & kPresentBit) == 0)
+                return;
+
+            auto write = [&](Bitset& bitset)
+                {
+                    if (set)
+                        bitset.Set(id);
+                    else
+                        bitset.Reset(id);
+                };
+
+            if (bits & kActiveBit)
+                write(active);
+            if (bits & kActiveSelfBit)
+                write(activeSelf);
+            if (bits & kRootBit)
+                write(root);
+
+            const uint32_t layerCode = (bits >> kLayerShift) & 0x3FU;
+            if (layerCode != 0)
+                write(layers[layerCode - 1U]);
+            write(depthBuckets[(bits >> kDepthShift) & 0x7U]);
+        }
+
+        // nullptr for an out-of-range value, which matches nothing.
+        const Bitset* Find(const AttributeTerm& term) const
+        {
+            switch (term.kind)
+            {
+            case AttributeKind::Active: return &active;
+            case AttributeKind::ActiveSelf: return &activeSelf;
+            case AttributeKind::Root: return &root;
+            case AttributeKind::Layer:
+                return (term.value >= 0 && static_cast<uint32_t>(term.value) < kLayerCount) ? &layers[term.value] : nullptr;
+            case AttributeKind::DepthBucket:
+                return (term.value >= 0 && static_cast<uint32_t>(term.value) < kDepthBucketCount) ? &depthBuckets[term.value] : nullptr;
+            case AttributeKind::External:
+                return term.external;
+            }
+
+            return nullptr;
+        }
+
+        // AND of all terms (each optionally negated); no terms selects every object.
+        void Evaluate(const std::vector<AttributeTerm>& terms, Bitset* outHits) const
+        {
+            outHits->Resize(objectCount, true);
+            for (const AttributeTerm& term : terms)
+            {
+                const Bitset* bits = Find(term);
+                if (!bits || bits->bitCount != objectCount)
+                {
+                    if (!term.negate)
+                    {
+                        outHits->Resize(objectCount);
+                        return;
+                    }
+                    continue;
+                }
+
+                if (term.negate)
+                    outHits->AndNotWith(*bits);
+                else
+                    outHits->AndWith(*bits);
+            }
+        }
+    };
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace UExplorer
+{
+    struct Bitset
+    {
+        std::vector<uint64_t> words;
+        size_t bitCount = 0;
+
+        void Resize(size_t count, bool value = false)
+        {
+            bitCount = count;
+            words.assign((count + 63U) / 64U, value ? ~0ULL : 0ULL);
+            TrimTail();
+        }
+
+        // Keeps the bits below both sizes; bits added by growing are clear.
+        void ResizeKeep(size_t count)
+        {
+            bitCount = count;
+            words.resize((count + 63U) / 64U, 0ULL);
+            TrimTail();
+        }
+
+        bool Test(size_t index) const
+        {
+            return ((words[index >> 6] >> (index & 63U)) & 1ULL) != 0;
+        }
+
+        void Set(size_t index)
+        {
+            words[index >> 6] |= (1ULL << (index & 63U));
+        }
+
+        void Reset(size_t index)
+        {
+            words[index >> 6] &= ~(1ULL << (index & 63U));
+        }
+
+        void SetRange(size_t begin, size_t end)
+        {
+            for (size_t index = begin; index < end && (index & 63U); ++index)
+                Set(index);
+
+            size_t index = (begin + 63U) & ~static_cast<size_t>(63U);
+            for (; index + 64U <= end; index += 64U)
+                words[index >> 6] = ~0ULL;
+
+            for (; index < end; ++index)
+                Set(index);
+        }
+
+        bool Any() const
+        {
+            for (uint64_t word : words)
+            {
+                if (word)
+                    return true;
+            }
+
+            return false;
+        }
+
+        bool AnyInRange(size_t begin, size_t end) const
+        {
+            for (size_t index = begin; index < end && (index & 63U); ++index)
+            {
+                if (Test(index))
+                    return true;
+            }
+
+            size_t index = (begin + 63U) & ~static_cast<size_t>(63U);
+            for (; index + 64U <= end; index += 64U)
+            {
+                if (words[index >> 6])
+                    return true;
+            }
+
+            for (; index < end; ++index)
+            {
+                if (Test(index))
+                    return true;
+            }
+
+            return false;
+        }
+
+        size_t Count() const
+        {
+            size_t count = 0;
+            for (uint64_t word : words)
+                count += static_cast<size_t>(std::popcount(word));
+            return count;
+        }
+
+        // Word-wise set algebra; both sides must have the same size. The loops are plain
+        // enough for the compiler to vectorize.
+        void AndWith(const Bitset& other)
+        {
+            for (size_t w = 0; w < words.size(); ++w)
+                words[w] &= other.words[w];
+        }
+
+        void OrWith(const Bitset& other)
+        {
+            for (size_t w = 0; w < words.size(); ++w)
+                words[w] |= other.words[w];
+        }
+
+        void AndNotWith(const Bitset& other)
+        {
+            for (size_t w = 0; w < words.size(); ++w)
+                words[w] &= ~other.words[w];
+        }
+
+        void Invert()
+        {
+            for (uint64_t& word : words)
+                word = ~word;
+            TrimTail();
+        }
+
+        template<typename Fn>
+        void ForEachSet(Fn&& fn) const
+        {
+            for (size_t w = 0; w < words.size(); ++w)
+            {
+                uint64_t word = words[w];
+                while (word)
+                {
+                    fn((w << 6) + static_cast<size_t>(std::countr_zero(word)));
+                    word &= word - 1ULL;
+                }
+            }
+        }
+
+        // Keeps the padding bits of the last word zero so word-wide operations stay exact.
+        void TrimTail()
+        {
+            const size_t tailBits = bitCount & 63U;
+            if (tailBits && !words.empty())
+                words.back() &= (1ULL << tailBits) - 1ULL;
+        }
+    };
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace UExplorer
+{
+    enum class ChangeEventKind : uint8_t
+    {
+        SceneLoaded,
+        SceneUnloaded,
+        ActiveSceneChanged,
+        ObjectInstantiated,
+        ObjectDestroyed
+    };
+
+    struct ChangeEvent
+    {
+        ChangeEventKind kind = ChangeEventKind::SceneLoaded;
+        int sceneHandle = 0;
+        uintptr_t subject = 0; // managed object pointer for object events
+        uint64_t tick = 0;
+    };
+
+    // Bounded lock-free multi-producer / single-consumer ring (per-cell sequence numbers).
+    // Producers are game-thread hooks that must never block; when the ring is full the event
+    // is dropped and counted so the consumer can fall back to a full refresh.
+    template<typename T, size_t kCapacity>
+    class BoundedMpscQueue
+    {
+        static_assert(kCapacity >= 2 && (kCapacity & (kCapacity - 1)) == 0, "capacity must be a power of two");
+
+    public:
+        BoundedMpscQueue()
+        {
+            for (size_t i = 0; i < kCapacity; ++i)
+                m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        BoundedMpscQueue(const BoundedMpscQueue&) = delete;
+        BoundedMpscQueue& operator=(const BoundedMpscQueue&) = delete;
+
+        bool TryPush(const T& value)
+        {
+            size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                Cell& cell = m_Cells[pos & (kCapacity - 1)];
+                const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+                const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+
+                if (diff == 0)
+                {
+                    if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        cell.value = value;
+                        cell.sequence.store(pos + 1, std::memory_order_release);
+                        return true;
+                    }
+                }
+                else if (diff < 0)
+                {
+                    m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+                else
+                {
+                    pos = m_EnqueuePos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Single consumer only.
+        bool TryPop(T* outValue)
+        {
+            Cell& cell = m_Cells[m_DequeuePos & (kCapacity - 1)];
+            const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(m_DequeuePos + 1) < 0)
+                return false;
+
+            *outValue = cell.value;
+            cell.sequence.store(m_DequeuePos + kCapacity, std::memory_order_release);
+            ++m_DequeuePos;
+            return true;
+        }
+
+        uint32_t TakeDroppedCount()
+        {
+            return m_Dropped.exchange(0, std::memory_order_relaxed);
+        }
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence{ 0 };
+            T value{};
+        };
+
+        Cell m_Cells[kCapacity];
+        alignas(64) std::atomic<size_t> m_EnqueuePos{ 0 };
+        alignas(64) size_t m_DequeuePos = 0;
+        std::atomic<uint32_t> m_Dropped{ 0 };
+    };
+
+    using ChangeEventQueue = BoundedMpscQueue<ChangeEvent, 4096>;
+}
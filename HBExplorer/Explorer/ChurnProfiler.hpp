@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace UExplorer
+{
+    // What a spawned or destroyed object is counted as: its name stem and component signature.
+    // A zero attribution is the "(untracked)" series.
+    struct ChurnAttribution
+    {
+        uint64_t stemHash = 0;
+        uint64_t signature = 0;
+    };
+
+    // Attributions of clones seen spawning, so their destroy lands on the same series even if no
+    // refresh ever saw them. Bounded: once full it starts over, and the clones it forgot are
+    // destroyed as untracked.
+    class SpawnAttributionTable
+    {
+    public:
+        explicit SpawnAttributionTable(size_t capacity = 1U << 16)
+            : m_Capacity(std::max<size_t>(capacity, 1U))
+        {
+        }
+
+        void Remember(uintptr_t subject, const ChurnAttribution& attribution)
+        {
+            if (m_BySubject.size() >= m_Capacity && m_BySubject.find(subject) == m_BySubject.end())
+            {
+                m_Forgotten += m_BySubject.size();
+                m_BySubject.clear();
+            }
+
+            m_BySubject[subject] = attribution;
+        }
+
+        // Hands back (and forgets) what the subject spawned as; false if it was never seen.
+        bool Take(uintptr_t subject, ChurnAttribution* outAttribution)
+        {
+            auto it = m_BySubject.find(subject);
+            if (it == m_BySubject.end())
+                return false;
+
+            *outAttribution = it->second;
+            m_BySubject.erase(it);
+            return true;
+        }
+
+        size_t Size() const { return m_BySubject.size(); }
+        uint64_t ForgottenCount() const { return m_Forgotten; }
+
+        void Clear()
+        {
+            m_BySubject.clear();
+            m_Forgotten = 0;
+        }
+
+    private:
+        std::unordered_map<uintptr_t, ChurnAttribution> m_BySubject;
+        size_t m_Capacity;
+        uint64_t m_Forgotten = 0;
+    };
+
+    // Create/destroy counters per key, kept as a ring of fixed-width time buckets so rates over
+    // the last few seconds cost one pass over at most kBucketCount slots. Stale buckets are only
+    // zeroed when their series is touched again, so idle series cost nothing per frame.
+    class ChurnProfiler
+    {
+    public:
+        static constexpr uint32_t kBucketMs = 250;
+        static constexpr uint32_t kBucketCount = 64; // 16 seconds of history
+        static constexpr size_t kMaxSeries = 2048;
+
+        struct Series
+        {
+            uint64_t key = 0;
+            std::string label;
+            uint64_t headBucket = 0; // absolute bucket index of the newest slot written
+            uint32_t created[kBucketCount]{};
+            uint32_t destroyed[kBucketCount]{};
+            uint64_t totalCreated = 0;
+            uint64_t totalDestroyed = 0;
+        };
+
+        struct Rate
+        {
+            uint32_t series = 0;
+            float createdPerSecond = 0.0f;
+            float destroyedPerSecond = 0.0f;
+        };
+
+        // Returns nullptr once kMaxSeries keys exist; those events only bump OverflowCount().
+        Series* Acquire(uint64_t key)
+        {
+            auto it = m_IndexByKey.find(key);
+            if (it != m_IndexByKey.end())
+                return &m_Series[it->second];
+
+            if (m_Series.size() >= kMaxSeries)
+            {
+                ++m_Overflow;
+                return nullptr;
+            }
+
+            m_IndexByKey.emplace(key, static_cast<uint32_t>(m_Series.size()));
+            Series& series = m_Series.emplace_back();
+            series.key = key;
+            return &series;
+        }
+
+        void Record(Series& series, bool created, uint64_t tickMs)
+        {
+            const uint64_t bucket = tickMs / kBucketMs;
+            if (created)
+                ++series.totalCreated;
+            else
+                ++series.totalDestroyed;
+
+            if (bucket > series.headBucket)
+            {
+                const uint64_t stale = std::min<uint64_t>(bucket - series.headBucket, kBucketCount);
+                for (uint64_t i = 1; i <= stale; ++i)
+                {
+                    const size_t slot = static_cast<size_t>((series.headBucket + i) % kBucketCount);
+                    series.created[slot] = 0;
+                    series.destroyed[slot] = 0;
+                }
+                series.headBucket = bucket;
+            }
+            else if (series.headBucket - bucket >= kBucketCount)
+            {
+                return; // older than the ring; totals only
+            }
+
+            const size_t slot = static_cast<size_t>(bucket % kBucketCount);
+            ++(created ? series.created : series.destroyed)[slot];
+        }
+
+        // Rates over the window ending at nowMs, highest combined churn first.
+        void TopChurners(uint64_t nowMs, uint32_t windowMs, size_t maxCount, std::vector<Rate>* outRates) const
+        {
+            outRates->clear();
+
+            const uint64_t nowBucket = nowMs / kBucketMs;
+            const uint64_t windowBuckets = std::clamp<uint64_t>((windowMs + kBucketMs - 1U) / kBucketMs, 1U, kBucketCount);
+
+            // The newest bucket is still filling, so only its elapsed part counts as time.
+            const float seconds = static_cast<float>((windowBuckets - 1U) * kBucketMs + (nowMs % kBucketMs) + 1U) / 1000.0f;
+
+            for (size_t index = 0; index < m_Series.size(); ++index)
+            {
+                const Series& series = m_Series[index];
+                uint64_t created = 0;
+                uint64_t destroyed = 0;
+                for (uint64_t i = 0; i < windowBuckets && i <= nowBucket; ++i)
+                {
+                    const uint64_t bucket = nowBucket - i;
+                    if (bucket > series.headBucket || series.headBucket - bucket >= kBucketCount)
+                        continue;
+
+                    const size_t slot = static_cast<size_t>(bucket % kBucketCount);
+                    created += series.created[slot];
+                    destroyed += series.destroyed[slot];
+                }
+
+                if (created == 0 && destroyed == 0)
+                    continue;
+
+                Rate rate{};
+                rate.series = static_cast<uint32_t>(index);
+                rate.createdPerSecond = static_cast<float>(created) / seconds;
+                rate.destroyedPerSecond = static_cast<float>(destroyed) / seconds;
+                outRates->emplace_back(rate);
+            }
+
+            auto byChurn = [](const Rate& left, const Rate& right)
+                {
+                    return (left.createdPerSecond + left.destroyedPerSecond) > (right.createdPerSecond + right.destroyedPerSecond);
+                };
+
+            if (outRates->size() > maxCount)
+            {
+                std::partial_sort(outRates->begin(), outRates->begin() + static_cast<std::ptrdiff_t>(maxCount), outRates->end(), byChurn);
+                outRates->resize(maxCount);
+            }
+            else
+            {
+                std::sort(outRates->begin(), outRates->end(), byChurn);
+            }
+        }
+
+        // Oldest first; buckets outside the ring or never written read as 0.
+        void CopyHistory(const Series& series, uint64_t nowMs, bool created, float* outValues) const
+        {
+            const uint64_t nowBucket = nowMs / kBucketMs;
+            const uint32_t* counts = created ? series.created : series.destroyed;
+            for (uint32_t i = 0; i < kBucketCount; ++i)
+            {
+                const uint64_t age = kBucketCount - 1U - i;
+                const uint64_t bucket = nowBucket - std::min(age, nowBucket);
+                const bool valid = age <= nowBucket && bucket <= series.headBucket && series.headBucket - bucket < kBucketCount;
+                outValues[i] = valid ? static_cast<float>(counts[bucket % kBucketCount]) : 0.0f;
+            }
+        }
+
+        const Series& At(uint32_t index) const { return m_Series[index]; }
+        size_t Size() const { return m_Series.size(); }
+        uint64_t OverflowCount() const { return m_Overflow; }
+
+        void Clear()
+        {
+            m_Series.clear();
+            m_IndexByKey.clear();
+            m_Overflow = 0;
+        }
+
+    private:
+        std::vector<Series> m_Series;
+        std::unordered_map<uint64_t, uint32_t> m_IndexByKey;
+        uint64_t m_Overflow = 0;
+    };
+}
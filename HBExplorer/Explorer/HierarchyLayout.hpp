@@ -0,0 +1,135 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Bitset.hpp"
+
+namespace UExplorer
+{
+    static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFU;
+
+    // Pre-order (Euler-tour) layout of a forest. The subtree rooted at position p occupies
+    // [p, subtreeEnd[p]), and every parent position is smaller than its children's.
+    struct HierarchyLayout
+    {
+        std::vector<uint32_t> order;       // position -> node index
+        std::vector<uint32_t> position;    // node index -> position (kInvalidIndex if unreachable)
+        std::vector<uint32_t> parent;      // position -> parent position (kInvalidIndex for roots)
+        std::vector<uint32_t> subtreeEnd;  // position -> one past the last descendant position
+        std::vector<uint32_t> depth;       // position -> depth (roots are 0)
+
+        size_t Size() const
+        {
+            return order.size();
+        }
+
+        bool HasChildren(uint32_t pos) const
+        {
+            return subtreeEnd[pos] > pos + 1U;
+        }
+    };
+
+    // childrenOf(nodeIndex) must return an iterable range of child node indices in display order.
+    template<typename ChildrenOf>
+    static void BuildHierarchyLayout(
+        size_t nodeCount,
+        const std::vector<uint32_t>& roots,
+        ChildrenOf&& childrenOf,
+        HierarchyLayout* outLayout)
+    {
+        HierarchyLayout& layout = *outLayout;
+        layout.order.clear();
+        layout.parent.clear();
+        layout.depth.clear();
+        layout.position.assign(nodeCount, kInvalidIndex);
+
+        layout.order.reserve(nodeCount);
+        layout.parent.reserve(nodeCount);
+        layout.depth.reserve(nodeCount);
+
+        // (node, parent position) pairs; children are pushed in reverse so they pop in order.
+        std::vector<std::pair<uint32_t, uint32_t>> stack;
+        stack.reserve(64);
+        for (auto it = roots.rbegin(); it != roots.rend(); ++it)
+            stack.emplace_back(*it, kInvalidIndex);
+
+        while (!stack.empty())
+        {
+            const auto [node, parentPos] = stack.back();
+            stack.pop_back();
+
+            if (node >= nodeCount || layout.position[node] != kInvalidIndex)
+                continue;
+
+            const uint32_t pos = static_cast<uint32_t>(layout.order.size());
+            layout.position[node] = pos;
+            layout.order.emplace_back(node);
+            layout.parent.emplace_back(parentPos);
+            layout.depth.emplace_back(parentPos == kInvalidIndex ? 0U : layout.depth[parentPos] + 1U);
+
+            const size_t childBase = stack.size();
+            for (uint32_t child : childrenOf(node))
+                stack.emplace_back(child, pos);
+
+            std::reverse(stack.begin() + static_cast<std::ptrdiff_t>(childBase), stack.end());
+        }
+
+        // Subtree sizes accumulate bottom-up in one reverse pass since parents precede children.
+        const size_t count = layout.order.size();
+        layout.subtreeEnd.assign(count, 1U);
+        for (size_t pos = count; pos-- > 0;)
+        {
+            const uint32_t parentPos = layout.parent[pos];
+            if (parentPos != kInvalidIndex)
+                layout.subtreeEnd[parentPos] += layout.subtreeEnd[pos];
+        }
+
+        for (size_t pos = 0; pos < count; ++pos)
+            layout.subtreeEnd[pos] += static_cast<uint32_t>(pos);
+    }
+
+    // Turns a per-position match set into a visibility set: a position is visible when it
+    // or any of its descendants matches. Runs as a single reverse linear pass.
+    static void PropagateMatchesToAncestors(const HierarchyLayout& layout, Bitset* inOutBits)
+    {
+        Bitset& bits = *inOutBits;
+        for (size_t pos = layout.Size(); pos-- > 0;)
+        {
+            if (!bits.Test(pos))
+                continue;
+
+            const uint32_t parentPos = layout.parent[pos];
+            if (parentPos != kInvalidIndex)
+                bits.Set(parentPos);
+        }
+    }
+
+    // Emits the positions that are visible and whose ancestors are all expanded. Hidden or
+    // collapsed subtrees are skipped in O(1) via subtreeEnd.
+    static void FlattenVisibleRows(
+        const HierarchyLayout& layout,
+        const Bitset* visible,
+        const Bitset& expanded,
+        std::vector<uint32_t>* outRows)
+    {
+        outRows->clear();
+
+        const uint32_t count = static_cast<uint32_t>(layout.Size());
+        uint32_t pos = 0;
+        while (pos < count)
+        {
+            if (visible && !visible->Test(pos))
+            {
+                pos = layout.subtreeEnd[pos];
+                continue;
+            }
+
+            outRows->emplace_back(pos);
+            pos = expanded.Test(pos) ? pos + 1U : layout.subtreeEnd[pos];
+        }
+    }
+}
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace UExplorer
+{
+    // Fixed-capacity sink for objects reported while the GC world is stopped. Append must not
+    // allocate (a suspended thread may hold the heap lock), so storage is reserved by Reset and
+    // anything past capacity is only counted.
+    class InstanceSink
+    {
+    public:
+        void Reset(size_t capacity)
+        {
+            m_Items.resize(capacity);
+            m_Count = 0;
+            m_Overflow = 0;
+        }
+
+        void Append(void* const* objects, size_t count)
+        {
+            const size_t take = std::min(count, m_Items.size() - m_Count);
+            for (size_t i = 0; i < take; ++i)
+                m_Items[m_Count + i] = reinterpret_cast<uintptr_t>(objects[i]);
+            m_Count += take;
+            m_Overflow += count - take;
+        }
+
+        size_t Count() const { return m_Count; }
+        size_t Overflow() const { return m_Overflow; }
+
+        // Moves the non-null addresses out, sorted and unique.
+        void Take(std::vector<uintptr_t>* out)
+        {
+            m_Items.resize(m_Count);
+            m_Items.erase(std::remove(m_Items.begin(), m_Items.end(), uintptr_t{ 0 }), m_Items.end());
+            std::sort(m_Items.begin(), m_Items.end());
+            m_Items.erase(std::unique(m_Items.begin(), m_Items.end()), m_Items.end());
+            out->swap(m_Items);
+            m_Items.clear();
+            m_Count = 0;
+        }
+
+    private:
+        std::vector<uintptr_t> m_Items;
+        size_t m_Count = 0;
+        size_t m_Overflow = 0;
+    };
+
+    // Bump allocator for the liveness walk's own arrays, which the runtime grows through a
+    // reallocate callback while the world is stopped. Only memory reserved before the walk is
+    // handed out; more of it is committed through the caller's hook (VirtualAlloc takes no heap
+    // lock). Nothing is freed individually except the newest block, which also grows in place;
+    // Reset drops everything at once.
+    class LivenessArena
+    {
+    public:
+        using CommitFn = bool (*)(void* begin, size_t bytes);
+
+        static constexpr size_t kAlign = 16;
+        static constexpr size_t kCommitStep = 1U << 20;
+
+        // Takes over [base, base + capacity), none of it committed yet.
+        void Attach(uint8_t* base, size_t capacity, CommitFn commit)
+        {
+            m_Base = base;
+            m_Capacity = capacity;
+            m_Commit = commit;
+            m_Committed = 0;
+            Reset();
+        }
+
+        void Reset()
+        {
+            m_Used = 0;
+            m_Peak = 0;
+            m_Last = nullptr;
+        }
+
+        // realloc semantics; nullptr when the reservation is exhausted or a commit fails.
+        void* Reallocate(void* pointer, size_t size)
+        {
+            uint8_t* block = static_cast<uint8_t*>(pointer);
+            if (size == 0)
+            {
+                if (block && block == m_Last)
+                {
+                    m_Used = static_cast<size_t>(block - m_Base) - kAlign;
+                    m_Last = nullptr;
+                }
+                return nullptr;
+            }
+
+            if (block && block == m_Last)
+            {
+                const size_t end = static_cast<size_t>(block - m_Base) + RoundUp(size);
+                if (!Ensure(end))
+                    return nullptr;
+
+                SizeOf(block) = size;
+                m_Used = end;
+                m_Peak = std::max(m_Peak, m_Used);
+                return block;
+            }
+
+            const size_t begin = m_Used + kAlign;
+            const size_t end = begin + RoundUp(size);
+            if (end < begin || !Ensure(end))
+                return nullptr;
+
+            uint8_t* fresh = m_Base + begin;
+            SizeOf(fresh) = size;
+            if (block)
+                std::memcpy(fresh, block, std::min(SizeOf(block), size));
+
+            m_Used = end;
+            m_Peak = std::max(m_Peak, m_Used);
+            m_Last = fresh;
+            return fresh;
+        }
+
+        bool Attached() const { return m_Base != nullptr; }
+        uint8_t* Base() const { return m_Base; }
+        size_t Capacity() const { return m_Capacity; }
+        size_t Committed() const { return m_Committed; }
+        size_t Peak() const { return m_Peak; }
+
+    private:
+        static size_t RoundUp(size_t size)
+        {
+            return (size + kAlign - 1) & ~(kAlign - 1);
+        }
+
+        // Each block is preceded by one kAlign slot holding its requested size.
+        static size_t& SizeOf(uint8_t* block)
+        {
+            return *reinterpret_cast<size_t*>(block - kAlign);
+        }
+
+        bool Ensure(size_t end)
+        {
+            if (end > m_Capacity)
+                return false;
+            if (end <= m_Committed)
+                return true;
+
+            const size_t target = std::min(m_Capacity, (end + kCommitStep - 1) / kCommitStep * kCommitStep);
+            if (!m_Commit || !m_Commit(m_Base + m_Committed, target - m_Committed))
+                return false;
+
+            m_Committed = target;
+            return true;
+        }
+
+        uint8_t* m_Base = nullptr;
+        size_t m_Capacity = 0;
+        size_t m_Committed = 0;
+        size_t m_Used = 0;
+        size_t m_Peak = 0;
+        uint8_t* m_Last = nullptr;
+        CommitFn m_Commit = nullptr;
+    };
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UEXPLORER_NAME_INDEX_SSE2 1
+#endif
+
+namespace UExplorer
+{
+    // Substring index over lowered object names. Names are packed into one NUL-separated
+    // arena; every distinct trigram of a name maps to a posting list of name ids. Ids are
+    // assigned in insertion order, so posting lists stay sorted without a separate pass.
+    struct NameIndex
+    {
+        std::string arena;
+        std::vector<uint32_t> offsets; // id -> start of the name in arena
+        std::unordered_map<uint32_t, std::vector<uint32_t>> postings;
+
+        void Clear()
+        {
+            arena.clear();
+            offsets.clear();
+            postings.clear();
+        }
+
+        void Reserve(size_t nameCount, size_t arenaBytes)
+        {
+            offsets.reserve(nameCount);
+            arena.reserve(arenaBytes);
+        }
+
+        size_t Size() const
+        {
+            return offsets.size();
+        }
+
+        std::string_view NameAt(uint32_t id) const
+        {
+            const size_t begin = offsets[id];
+            const size_t end = (static_cast<size_t>(id) + 1U < offsets.size()) ? offsets[id + 1U] - 1U : arena.size() - 1U;
+            return std::string_view(arena.data() + begin, end - begin);
+        }
+
+        uint32_t Add(std::string_view nameLower)
+        {
+            const uint32_t id = static_cast<uint32_t>(offsets.size());
+            offsets.emplace_back(static_cast<uint32_t>(arena.size()));
+            arena.append(nameLower.data(), nameLower.size());
+            arena.push_back('\0');
+
+            for (size_t i = 0; i + 3U <= nameLower.size(); ++i)
+            {
+                std::vector<uint32_t>& list = postings[PackTrigram(nameLower.data() + i)];
+                if (list.empty() || list.back() != id)
+                    list.emplace_back(id);
+            }
+
+            return id;
+        }
+
+        // Writes the sorted ids whose name contains needleLower. An empty needle matches all.
+        void Query(std::string_view needleLower, std::vector<uint32_t>* outIds) const
+        {
+            outIds->clear();
+
+            if (needleLower.empty())
+            {
+                outIds->resize(offsets.size());
+                for (uint32_t id = 0; id < outIds->size(); ++id)
+                    (*outIds)[id] = id;
+
+                return;
+            }
+
+            if (needleLower.size() < 3U)
+            {
+                ScanShort(needleLower, outIds);
+                return;
+            }
+
+            std::vector<const std::vector<uint32_t>*> lists;
+            lists.reserve(needleLower.size() - 2U);
+            for (size_t i = 0; i + 3U <= needleLower.size(); ++i)
+            {
+                auto it = postings.find(PackTrigram(needleLower.data() + i));
+                if (it == postings.end())
+                    return;
+
+                lists.emplace_back(&it->second);
+            }
+
+            std::sort(lists.begin(), lists.end(), [](const std::vector<uint32_t>* a, const std::vector<uint32_t>* b)
+                {
+                    return a->size() < b->size();
+                });
+            lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+
+            std::vector<uint32_t> candidates = *lists.front();
+            for (size_t l = 1; l < lists.size() && !candidates.empty(); ++l)
+            {
+                const std::vector<uint32_t>& list = *lists[l];
+                auto cursor = list.begin();
+                size_t kept = 0;
+                for (uint32_t id : candidates)
+                {
+                    cursor = std::lower_bound(cursor, list.end(), id);
+                    if (cursor == list.end())
+                        break;
+
+                    if (*cursor == id)
+                        candidates[kept++] = id;
+                }
+
+                candidates.resize(kept);
+            }
+
+            // Trigram hits only prove the pieces exist; the exact substring still needs checking.
+            outIds->reserve(candidates.size());
+            for (uint32_t id : candidates)
+            {
+                if (NameAt(id).find(needleLower) != std::string_view::npos)
+                    outIds->emplace_back(id);
+            }
+        }
+
+    private:
+        static uint32_t PackTrigram(const char* text)
+        {
+            return (static_cast<uint32_t>(static_cast<uint8_t>(text[0])) << 16)
+                | (static_cast<uint32_t>(static_cast<uint8_t>(text[1])) << 8)
+                | static_cast<uint32_t>(static_cast<uint8_t>(text[2]));
+        }
+
+        // One- and two-byte needles have no trigrams, so they are answered by a linear scan
+        // over the arena. The NUL separators keep two-byte matches from spanning names.
+        void ScanShort(std::string_view needle, std::vector<uint32_t>* outIds) const
+        {
+            const char* data = arena.data();
+            const size_t size = arena.size();
+            const bool pair = needle.size() == 2U;
+            const char first = needle[0];
+            const char second = pair ? needle[1] : '\0';
+
+            uint32_t currentId = 0;
+            size_t currentEnd = 0;
+            auto report = [&](size_t offset)
+                {
+                    if (offset < currentEnd)
+                        return;
+
+                    auto it = std::upper_bound(offsets.begin(), offsets.end(), static_cast<uint32_t>(offset));
+                    currentId = static_cast<uint32_t>((it - offsets.begin()) - 1);
+                    currentEnd = (it != offsets.end()) ? *it : size;
+                    outIds->emplace_back(currentId);
+                };
+
+            size_t i = 0;
+#if defined(UEXPLORER_NAME_INDEX_SSE2)
+            const __m128i firstVec = _mm_set1_epi8(first);
+            const __m128i secondVec = _mm_set1_epi8(second);
+            for (; i + 17U <= size; i += 16U)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, firstVec)));
+                if (pair && mask)
+                {
+                    const __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i + 1U));
+                    mask &= static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(next, secondVec)));
+                }
+
+                while (mask)
+                {
+                    report(i + static_cast<size_t>(std::countr_zero(mask)));
+                    mask &= mask - 1U;
+                }
+            }
+#endif
+            for (; i < size; ++i)
+            {
+                if (data[i] != first)
+                    continue;
+
+                if (pair && (i + 1U >= size || data[i + 1U] != second))
+                    continue;
+
+                report(i);
+            }
+        }
+    };
+}
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace UExplorer
+{
+    // One path component: a scene or object name plus its ordinal among earlier siblings with
+    // the same name, written as "Name[2]". A zero ordinal is omitted.
+    struct ObjectPathSegment
+    {
+        std::string name;
+        uint32_t ordinal = 0;
+        bool explicitOrdinal = false; // parsed from "[n]"; query patterns match any ordinal without one
+    };
+
+    // '/', '[' and '\' inside names are escaped with a backslash.
+    static void AppendObjectPathSegment(std::string* path, std::string_view name, uint32_t ordinal)
+    {
+        if (!path->empty())
+            path->push_back('/');
+
+        for (char c : name)
+        {
+            if (c == '/' || c == '[' || c == '\\')
+                path->push_back('\\');
+            path->push_back(c);
+        }
+
+        if (ordinal != 0)
+        {
+            path->push_back('[');
+            path->append(std::to_string(ordinal));
+            path->push_back(']');
+        }
+    }
+
+    static bool ParseObjectPath(std::string_view path, std::vector<ObjectPathSegment>* outSegments)
+    {
+        outSegments->clear();
+        if (path.empty())
+            return false;
+
+        ObjectPathSegment current{};
+        size_t i = 0;
+        while (i < path.size())
+        {
+            const char c = path[i];
+            if (c == '\\' && i + 1U < path.size())
+            {
+                current.name.push_back(path[i + 1U]);
+                i += 2U;
+                continue;
+            }
+
+            if (c == '/')
+            {
+                outSegments->emplace_back(std::move(current));
+                current = ObjectPathSegment{};
+                ++i;
+                continue;
+            }
+
+            if (c == '[')
+            {
+                // An ordinal must be all digits and close the segment.
+                size_t end = i + 1U;
+                uint64_t ordinal = 0;
+                while (end < path.size() && path[end] >= '0' && path[end] <= '9' && ordinal <= 0xFFFFFFFFULL)
+                    ordinal = ordinal * 10U + static_cast<uint64_t>(path[end++] - '0');
+
+                if (end == i + 1U || end >= path.size() || path[end] != ']' || ordinal > 0xFFFFFFFFULL)
+                    return false;
+
+                if (end + 1U < path.size() && path[end + 1U] != '/')
+                    return false;
+
+                current.ordinal = static_cast<uint32_t>(ordinal);
+                current.explicitOrdinal = true;
+                i = end + 1U;
+                continue;
+            }
+
+            current.name.push_back(c);
+            ++i;
+        }
+
+        outSegments->emplace_back(std::move(current));
+        return true;
+    }
+
+    // Prefix trie over resolved paths. Every node remembers the handle its prefix resolved to
+    // and the hierarchy stamp it was last confirmed at. Resolving trusts nodes confirmed at the
+    // current stamp, revalidates older ones, and only re-resolves from the first segment that
+    // fails; paths sharing a prefix share that work.
+    struct ObjectPathTrie
+    {
+        static constexpr size_t kMaxNodes = 1U << 16;
+
+        struct Node
+        {
+            uintptr_t handle = 0;
+            uint64_t stamp = 0;
+            std::unordered_map<std::string, uint32_t> children; // segment key -> node index
+        };
+
+        std::vector<Node> nodes = std::vector<Node>(1);
+
+        void Clear()
+        {
+            nodes.assign(1, Node{});
+        }
+
+        // validate(depth, parent, handle, segment) -> bool confirms a cached handle;
+        // resolveChild(depth, parent, segment) -> uintptr_t looks one segment up (0 = missing).
+        // Depth 0 is the scene and has parent 0.
+        template<typename Validate, typename ResolveChild>
+        uintptr_t Resolve(
+            const std::vector<ObjectPathSegment>& segments,
+            uint64_t stamp,
+            Validate&& validate,
+            ResolveChild&& resolveChild)
+        {
+            if (nodes.size() > kMaxNodes)
+                Clear();
+
+            uint32_t nodeIndex = 0;
+            uintptr_t parent = 0;
+            for (size_t depth = 0; depth < segments.size(); ++depth)
+            {
+                const ObjectPathSegment& segment = segments[depth];
+                nodeIndex = ChildFor(nodeIndex, segment);
+
+                Node& node = nodes[nodeIndex];
+                const bool cached = node.handle != 0
+                    && (node.stamp == stamp || validate(depth, parent, node.handle, segment));
+                if (!cached)
+                {
+                    node.handle = resolveChild(depth, parent, segment);
+                    if (node.handle == 0)
+                        return 0;
+                }
+
+                node.stamp = stamp;
+                parent = node.handle;
+            }
+
+            return parent;
+        }
+
+    private:
+        uint32_t ChildFor(uint32_t nodeIndex, const ObjectPathSegment& segment)
+        {
+            std::string key = segment.name;
+            key.push_back('\0');
+            key.append(std::to_string(segment.ordinal));
+
+            auto it = nodes[nodeIndex].children.find(key);
+            if (it != nodes[nodeIndex].children.end())
+                return it->second;
+
+            const uint32_t childIndex = static_cast<uint32_t>(nodes.size());
+            nodes[nodeIndex].children.emplace(std::move(key), childIndex);
+            nodes.emplace_back();
+            return childIndex;
+        }
+    };
+}
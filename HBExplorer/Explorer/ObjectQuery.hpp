@@ -0,0 +1,582 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "AttributeIndex.hpp"
+#include "ObjectPath.hpp"
+
+namespace UExplorer
+{
+    // Search queries are a whitespace-separated conjunction of terms, each optionally negated
+    // with a leading '-' or '!':
+    //   enemy              name contains "enemy"
+    //   n:enemy*           name glob (* and ?)
+    //   t:Rigidbody        has a component whose class name contains "rigidbody"
+    //   active:1 root:0    attribute flags
+    //   layer:8            layer number
+    //   depth:2 depth<3    hierarchy depth
+    //   scene:Main         scene name
+    //   path:/World/**     path glob; a leading '/' skips the scene segment, ** spans levels,
+    //                      "Name[2]" pins a sibling ordinal as in canonical object paths
+    //   field:health<10    numeric field on any component (<, <=, >, >=, =, !=)
+    // Values with spaces can be double-quoted. Matching is case-insensitive throughout.
+    enum class QueryPredicateKind : uint8_t
+    {
+        Attribute,  // AttributeIndex bitmap
+        Scene,      // scene name, mapped to the scene's layout position range
+        Type,       // TypeIndex label substring
+        PathPrefix, // subtrees of the objects named by the literal head of a path glob
+        Name,       // NameIndex substring
+        Depth,      // layout depth compare
+        NameGlob,
+        PathGlob,
+        Field       // reads managed memory
+    };
+
+    enum class QueryCompare : uint8_t
+    {
+        Less,
+        LessEqual,
+        Greater,
+        GreaterEqual,
+        Equal,
+        NotEqual
+    };
+
+    struct QueryPredicate
+    {
+        QueryPredicateKind kind = QueryPredicateKind::Name;
+        bool negate = false;
+        std::string text; // lowercased needle, glob, label, scene or field name
+        std::vector<std::string> segments; // PathPrefix: literal object names below the scene
+        std::vector<ObjectPathSegment> path; // PathGlob: the parsed pattern, scene segment first
+        AttributeKind attribute = AttributeKind::Active;
+        int attributeValue = 0;
+        QueryCompare compare = QueryCompare::Equal;
+        double number = 0.0;
+    };
+
+    // Index stages each produce a bitmap that is ANDed (or AND NOTed) into the candidate set,
+    // cheapest first. Filter stages then run per remaining candidate, cheapest first, so the
+    // field reads only ever see what no index could rule out.
+    struct QueryPlan
+    {
+        std::vector<QueryPredicate> indexed;
+        std::vector<QueryPredicate> filters;
+    };
+
+    static char QueryToLower(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    static std::string QueryLowerCopy(std::string_view text)
+    {
+        std::string lowered(text);
+        for (char& c : lowered)
+            c = QueryToLower(c);
+        return lowered;
+    }
+
+    // '*' matches any run, '?' one character. Case-insensitive.
+    static bool GlobMatch(std::string_view pattern, std::string_view text)
+    {
+        size_t p = 0;
+        size_t t = 0;
+        size_t starP = std::string_view::npos;
+        size_t starT = 0;
+        while (t < text.size())
+        {
+            if (p < pattern.size() && (pattern[p] == '?' || QueryToLower(pattern[p]) == QueryToLower(text[t])))
+            {
+                ++p;
+                ++t;
+            }
+            else if (p < pattern.size() && pattern[p] == '*')
+            {
+                starP = p++;
+                starT = t;
+            }
+            else if (starP != std::string_view::npos)
+            {
+                p = starP + 1U;
+                t = ++starT;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        while (p < pattern.size() && pattern[p] == '*')
+            ++p;
+        return p == pattern.size();
+    }
+
+    static bool HasGlobChars(std::string_view text)
+    {
+        return text.find_first_of("*?") != std::string_view::npos;
+    }
+
+    // Segment-wise glob over canonical paths: "**" matches zero or more whole segments, other
+    // names use GlobMatch, and an ordinal only has to match when the pattern spells one out.
+    static bool PathGlobMatch(const std::vector<ObjectPathSegment>& pattern, size_t p, const std::vector<ObjectPathSegment>& path, size_t s)
+    {
+        for (; p < pattern.size(); ++p, ++s)
+        {
+            if (pattern[p].name == "**" && !pattern[p].explicitOrdinal)
+            {
+                for (size_t skip = s; skip <= path.size(); ++skip)
+                {
+                    if (PathGlobMatch(pattern, p + 1U, path, skip))
+                        return true;
+                }
+                return false;
+            }
+
+            if (s >= path.size() || !GlobMatch(pattern[p].name, path[s].name))
+                return false;
+            if (pattern[p].explicitOrdinal && pattern[p].ordinal != path[s].ordinal)
+                return false;
+        }
+
+        return s == path.size();
+    }
+
+    // Longest run without wildcards, for narrowing a glob through the substring index.
+    static std::string LongestGlobLiteral(std::string_view pattern)
+    {
+        std::string_view best;
+        size_t begin = 0;
+        while (begin < pattern.size())
+        {
+            const size_t end = std::min(pattern.find_first_of("*?", begin), pattern.size());
+            if (end - begin > best.size())
+                best = pattern.substr(begin, end - begin);
+            begin = end + 1U;
+        }
+
+        return QueryLowerCopy(best);
+    }
+
+    static bool ParseQueryCompare(std::string_view text, size_t* ioPos, QueryCompare* outCompare)
+    {
+        const std::string_view rest = text.substr(*ioPos);
+        struct OpEntry { std::string_view token; QueryCompare compare; };
+        static constexpr OpEntry kOps[] = {
+            { "<=", QueryCompare::LessEqual }, { ">=", QueryCompare::GreaterEqual },
+            { "!=", QueryCompare::NotEqual }, { "==", QueryCompare::Equal },
+            { "<", QueryCompare::Less }, { ">", QueryCompare::Greater },
+            { "=", QueryCompare::Equal }, { ":", QueryCompare::Equal } };
+
+        for (const OpEntry& op : kOps)
+        {
+            if (rest.substr(0, op.token.size()) == op.token)
+            {
+                *ioPos += op.token.size();
+                *outCompare = op.compare;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    static bool ParseQueryNumber(std::string_view text, double* outValue)
+    {
+        const std::string lowered = QueryLowerCopy(text);
+        if (lowered == "true" || lowered == "yes")
+        {
+            *outValue = 1.0;
+            return true;
+        }
+        if (lowered == "false" || lowered == "no")
+        {
+            *outValue = 0.0;
+            return true;
+        }
+
+        if (lowered.empty())
+            return false;
+
+        char* end = nullptr;
+        *outValue = std::strtod(lowered.c_str(), &end);
+        return end == lowered.c_str() + lowered.size();
+    }
+
+    static bool CompareQueryNumber(double value, QueryCompare compare, double number)
+    {
+        switch (compare)
+        {
+        case QueryCompare::Less: return value < number;
+        case QueryCompare::LessEqual: return value <= number;
+        case QueryCompare::Greater: return value > number;
+        case QueryCompare::GreaterEqual: return value >= number;
+        case QueryCompare::Equal: return value == number;
+        case QueryCompare::NotEqual: return value != number;
+        }
+
+        return false;
+    }
+
+    static bool IsQueryKey(std::string_view key)
+    {
+        static constexpr std::string_view kKeys[] = {
+            "n", "name", "t", "type", "active", "self", "root", "layer", "depth", "scene", "path", "field", "f" };
+
+        for (std::string_view known : kKeys)
+        {
+            if (key == known)
+                return true;
+        }
+
+        return false;
+    }
+
+    // Splits on whitespace outside double quotes; quotes are removed.
+    static void TokenizeQuery(std::string_view text, std::vector<std::string>* outTokens)
+    {
+        outTokens->clear();
+        std::string current;
+        bool quoted = false;
+        bool any = false;
+        for (char c : text)
+        {
+            if (c == '"')
+            {
+                quoted = !quoted;
+                any = true;
+                continue;
+            }
+
+            if (!quoted && (c == ' ' || c == '\t'))
+            {
+                if (any)
+                    outTokens->emplace_back(std::move(current));
+                current.clear();
+                any = false;
+                continue;
+            }
+
+            current.push_back(c);
+            any = true;
+        }
+
+        if (any)
+            outTokens->emplace_back(std::move(current));
+    }
+
+    static bool ParseObjectQuery(std::string_view text, std::vector<QueryPredicate>* outPredicates, std::string* outError)
+    {
+        outPredicates->clear();
+        outError->clear();
+
+        std::vector<std::string> tokens;
+        TokenizeQuery(text, &tokens);
+
+        for (const std::string& token : tokens)
+        {
+            std::string_view term = token;
+            QueryPredicate predicate{};
+            if (!term.empty() && (term.front() == '-' || term.front() == '!') && term.size() > 1U)
+            {
+                predicate.negate = true;
+                term.remove_prefix(1);
+            }
+
+            // A key is a known word directly followed by an operator; anything else, including
+            // names such as "Door:Left" or "hp<3", is a name.
+            size_t keyEnd = 0;
+            while (keyEnd < term.size() && QueryToLower(term[keyEnd]) >= 'a' && QueryToLower(term[keyEnd]) <= 'z')
+                ++keyEnd;
+
+            const std::string key = QueryLowerCopy(term.substr(0, keyEnd));
+            QueryCompare compare = QueryCompare::Equal;
+            size_t valueBegin = keyEnd;
+            const bool hasOp = IsQueryKey(key) && ParseQueryCompare(term, &valueBegin, &compare);
+            const std::string_view value = term.substr(valueBegin);
+
+            auto fail = [&](const char* message)
+                {
+                    *outError = std::string(message) + ": " + token;
+                    return false;
+                };
+
+            auto parseFlag = [&](AttributeKind attribute)
+                {
+                    double number = 0.0;
+                    if (compare != QueryCompare::Equal || !ParseQueryNumber(value, &number))
+                        return false;
+
+                    predicate.kind = QueryPredicateKind::Attribute;
+                    predicate.attribute = attribute;
+                    if (number == 0.0)
+                        predicate.negate = !predicate.negate;
+                    return true;
+                };
+
+            if (!hasOp)
+            {
+                predicate.kind = HasGlobChars(term) ? QueryPredicateKind::NameGlob : QueryPredicateKind::Name;
+                predicate.text = QueryLowerCopy(term);
+            }
+            else if (key == "n" || key == "name")
+            {
+                if (compare != QueryCompare::Equal || value.empty())
+                    return fail("expected name:<text>");
+                predicate.kind = HasGlobChars(value) ? QueryPredicateKind::NameGlob : QueryPredicateKind::Name;
+                predicate.text = QueryLowerCopy(value);
+            }
+            else if (key == "t" || key == "type")
+            {
+                if (compare != QueryCompare::Equal || value.empty())
+                    return fail("expected type:<class>");
+                predicate.kind = QueryPredicateKind::Type;
+                predicate.text = QueryLowerCopy(value);
+            }
+            else if (key == "active")
+            {
+                if (!parseFlag(AttributeKind::Active))
+                    return fail("expected active:0 or active:1");
+            }
+            else if (key == "self")
+            {
+                if (!parseFlag(AttributeKind::ActiveSelf))
+                    return fail("expected self:0 or self:1");
+            }
+            else if (key == "root")
+            {
+                if (!parseFlag(AttributeKind::Root))
+                    return fail("expected root:0 or root:1");
+            }
+            else if (key == "layer")
+            {
+                double number = 0.0;
+                if (compare != QueryCompare::Equal || !ParseQueryNumber(value, &number) || number < 0.0 || number >= AttributeIndex::kLayerCount)
+                    return fail("expected layer:0..31");
+                predicate.kind = QueryPredicateKind::Attribute;
+                predicate.attribute = AttributeKind::Layer;
+                predicate.attributeValue = static_cast<int>(number);
+            }
+            else if (key == "depth")
+            {
+                if (!ParseQueryNumber(value, &predicate.number) || predicate.number < 0.0)
+                    return fail("expected depth<op><number>");
+                predicate.kind = QueryPredicateKind::Depth;
+                predicate.compare = compare;
+            }
+            else if (key == "scene")
+            {
+                if (compare != QueryCompare::Equal || value.empty())
+                    return fail("expected scene:<name>");
+                predicate.kind = QueryPredicateKind::Scene;
+                predicate.text = QueryLowerCopy(value);
+            }
+            else if (key == "path")
+            {
+                if (compare != QueryCompare::Equal || value.empty())
+                    return fail("expected path:<glob>");
+                predicate.kind = QueryPredicateKind::PathGlob;
+
+                // A leading '/' anchors at the scene roots of any scene.
+                predicate.text = (value.front() == '/') ? "*" + std::string(value) : std::string(value);
+                while (predicate.text.size() > 1U && predicate.text.back() == '/')
+                    predicate.text.pop_back();
+                if (!ParseObjectPath(predicate.text, &predicate.path))
+                    return fail("expected path:<glob>");
+            }
+            else if (key == "field" || key == "f")
+            {
+                // field:<name><op><number>; the ':' after the key is the separator, not the op.
+                if (compare != QueryCompare::Equal || term[keyEnd] != ':')
+                    return fail("expected field:<name><op><number>");
+
+                size_t nameEnd = valueBegin;
+                while (nameEnd < term.size() && term[nameEnd] != '<' && term[nameEnd] != '>' && term[nameEnd] != '=' && term[nameEnd] != '!')
+                    ++nameEnd;
+
+                size_t numberBegin = nameEnd;
+                if (nameEnd == valueBegin || !ParseQueryCompare(term, &numberBegin, &predicate.compare)
+                    || !ParseQueryNumber(term.substr(numberBegin), &predicate.number))
+                {
+                    return fail("expected field:<name><op><number>");
+                }
+
+                predicate.kind = QueryPredicateKind::Field;
+                predicate.text = std::string(term.substr(valueBegin, nameEnd - valueBegin));
+            }
+            outPredicates->emplace_back(std::move(predicate));
+        }
+
+        return true;
+    }
+
+    static uint32_t QueryPredicateCost(const QueryPredicate& predicate)
+    {
+        switch (predicate.kind)
+        {
+        case QueryPredicateKind::Attribute: return 1;
+        case QueryPredicateKind::Scene: return 1;
+        case QueryPredicateKind::Type: return 2;
+        case QueryPredicateKind::PathPrefix: return 2;
+        case QueryPredicateKind::Name: return 3;
+        case QueryPredicateKind::Depth: return 4;
+        case QueryPredicateKind::NameGlob: return 5;
+        case QueryPredicateKind::PathGlob: return 6;
+        case QueryPredicateKind::Field: return 10;
+        }
+
+        return 10;
+    }
+
+    static void PlanObjectQuery(const std::vector<QueryPredicate>& predicates, QueryPlan* outPlan)
+    {
+        outPlan->indexed.clear();
+        outPlan->filters.clear();
+
+        for (const QueryPredicate& predicate : predicates)
+        {
+            switch (predicate.kind)
+            {
+            case QueryPredicateKind::Attribute:
+            case QueryPredicateKind::Scene:
+            case QueryPredicateKind::Type:
+            case QueryPredicateKind::Name:
+                outPlan->indexed.emplace_back(predicate);
+                break;
+
+            case QueryPredicateKind::Depth:
+                // Exact shallow depths are whole buckets; anything else is a cheap per-row check.
+                if (predicate.compare == QueryCompare::Equal && predicate.number < 4.0 && predicate.number == static_cast<double>(static_cast<uint32_t>(predicate.number)))
+                {
+                    QueryPredicate bucket = predicate;
+                    bucket.kind = QueryPredicateKind::Attribute;
+                    bucket.attribute = AttributeKind::DepthBucket;
+                    bucket.attributeValue = static_cast<int>(predicate.number);
+                    outPlan->indexed.emplace_back(std::move(bucket));
+                }
+                else
+                {
+                    outPlan->filters.emplace_back(predicate);
+                }
+                break;
+
+            case QueryPredicateKind::NameGlob:
+            {
+                // A positive glob is narrowed by its longest literal through the name index.
+                const std::string literal = LongestGlobLiteral(predicate.text);
+                if (!predicate.negate && !literal.empty())
+                {
+                    QueryPredicate narrow{};
+                    narrow.kind = QueryPredicateKind::Name;
+                    narrow.text = literal;
+                    outPlan->indexed.emplace_back(std::move(narrow));
+                }
+
+                outPlan->filters.emplace_back(predicate);
+                break;
+            }
+
+            case QueryPredicateKind::PathGlob:
+            {
+                // Literal object segments after the scene bound the match to a few subtrees. The
+                // prefix stage compares names only, so pinned ordinals still need the filter.
+                const std::vector<ObjectPathSegment>& segments = predicate.path;
+
+                QueryPredicate prefix{};
+                prefix.kind = QueryPredicateKind::PathPrefix;
+                bool sceneWildcard = !segments.empty() && segments[0].name == "*";
+                bool anyOrdinal = !segments.empty() && segments[0].explicitOrdinal;
+                for (size_t i = 1; i < segments.size() && !HasGlobChars(segments[i].name); ++i)
+                {
+                    prefix.segments.emplace_back(segments[i].name);
+                    anyOrdinal = anyOrdinal || segments[i].explicitOrdinal;
+                }
+
+                if (!predicate.negate && !prefix.segments.empty())
+                {
+                    if (!sceneWildcard && !HasGlobChars(segments[0].name))
+                        prefix.text = QueryLowerCopy(segments[0].name);
+                    outPlan->indexed.emplace_back(prefix);
+                }
+
+                // "<literal>/**" is exactly the prefix subtrees; no need to rebuild paths.
+                const bool exactSubtree = !predicate.negate
+                    && !anyOrdinal
+                    && !prefix.segments.empty()
+                    && prefix.segments.size() + 2U == segments.size()
+                    && segments.back().name == "**"
+                    && (sceneWildcard || !HasGlobChars(segments[0].name));
+                if (!exactSubtree)
+                    outPlan->filters.emplace_back(predicate);
+                break;
+            }
+
+            case QueryPredicateKind::Field:
+                outPlan->filters.emplace_back(predicate);
+                break;
+
+            case QueryPredicateKind::PathPrefix:
+                outPlan->indexed.emplace_back(predicate);
+                break;
+            }
+        }
+
+        auto byCost = [](const QueryPredicate& left, const QueryPredicate& right)
+            {
+                return QueryPredicateCost(left) < QueryPredicateCost(right);
+            };
+        std::stable_sort(outPlan->indexed.begin(), outPlan->indexed.end(), byCost);
+        std::stable_sort(outPlan->filters.begin(), outPlan->filters.end(), byCost);
+    }
+
+    // What a predicate selects, negation aside: equal keys pick the same objects from the same
+    // object table, so a stage result can be reused across edits of the query text.
+    static std::string QueryPredicateKey(const QueryPredicate& predicate)
+    {
+        std::string key;
+        key.push_back(static_cast<char>('A' + static_cast<int>(predicate.kind)));
+        key.push_back(static_cast<char>('A' + static_cast<int>(predicate.attribute)));
+        key.push_back(static_cast<char>('A' + static_cast<int>(predicate.compare)));
+        key.append(std::to_string(predicate.attributeValue));
+        key.push_back('|');
+
+        char number[32];
+        std::snprintf(number, sizeof(number), "%.17g", predicate.number);
+        key.append(number);
+        key.push_back('|');
+        key.append(predicate.text);
+        for (const std::string& segment : predicate.segments)
+        {
+            key.push_back('\0');
+            key.append(segment);
+        }
+
+        return key;
+    }
+
+    static const char* QueryPredicateKindName(QueryPredicateKind kind)
+    {
+        switch (kind)
+        {
+        case QueryPredicateKind::Attribute: return "attribute";
+        case QueryPredicateKind::Scene: return "scene";
+        case QueryPredicateKind::Type: return "type";
+        case QueryPredicateKind::PathPrefix: return "path-prefix";
+        case QueryPredicateKind::Name: return "name";
+        case QueryPredicateKind::Depth: return "depth";
+        case QueryPredicateKind::NameGlob: return "name-glob";
+        case QueryPredicateKind::PathGlob: return "path-glob";
+        case QueryPredicateKind::Field: return "field";
+        }
+
+        return "?";
+    }
+}
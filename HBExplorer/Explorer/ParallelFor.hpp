@@ -0,0 +1,67 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace UExplorer
+{
+    // Workers for count items: at most maxThreads, and none that would get under minChunk items.
+    // Always at least one.
+    inline uint32_t ParallelWorkerCount(size_t count, uint32_t maxThreads, size_t minChunk)
+    {
+        const size_t byWork = std::max<size_t>(1, count / std::max<size_t>(minChunk, 1));
+        return static_cast<uint32_t>(std::min<size_t>(std::max<uint32_t>(maxThreads, 1U), byWork));
+    }
+
+    // Splits [0, count) into one contiguous chunk per worker and runs fn(worker, begin, end) for
+    // each, the first on the calling thread. Returns once every chunk is done. Threads are
+    // spawned per call: the callers are one-shot scans far longer than a thread start.
+    template<typename Fn>
+    void ParallelFor(size_t count, uint32_t workers, Fn&& fn)
+    {
+        workers = std::max<uint32_t>(workers, 1U);
+        const size_t chunk = (count + workers - 1) / workers;
+
+        auto work = [&](uint32_t worker)
+            {
+                const size_t begin = std::min(count, worker * chunk);
+                const size_t end = std::min(count, begin + chunk);
+                fn(worker, begin, end);
+            };
+
+        std::vector<std::thread> pool;
+        pool.reserve(workers - 1U);
+        for (uint32_t worker = 1; worker < workers; ++worker)
+            pool.emplace_back(work, worker);
+        work(0);
+        for (std::thread& thread : pool)
+            thread.join();
+    }
+
+    // Keeps the items for which keep(item) is true, in order. Workers decide one contiguous
+    // chunk each; keep must be safe to call from several threads. Returns the kept count.
+    template<typename KeepFn>
+    size_t ParallelCompact(std::vector<uintptr_t>* items, KeepFn&& keep, uint32_t maxThreads, size_t minChunk = 4096)
+    {
+        const size_t count = items->size();
+        std::vector<uint8_t> flags(count, 0);
+
+        ParallelFor(count, ParallelWorkerCount(count, maxThreads, minChunk), [&](uint32_t, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                    flags[i] = keep((*items)[i]) ? 1 : 0;
+            });
+
+        size_t kept = 0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (flags[i])
+                (*items)[kept++] = (*items)[i];
+        }
+        items->resize(kept);
+        return kept;
+    }
+}
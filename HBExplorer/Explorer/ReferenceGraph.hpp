@@ -0,0 +1,271 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace UExplorer
+{
+    // Open-addressing map from a non-zero address to a 32-bit value. Linear probing over a
+    // power-of-two table, grown at half load; Clear keeps the table for the next walk.
+    class AddressMap
+    {
+    public:
+        static constexpr uint32_t kMissing = 0xFFFFFFFFU;
+
+        void Clear()
+        {
+            std::fill(m_Keys.begin(), m_Keys.end(), uintptr_t{ 0 });
+            m_Count = 0;
+        }
+
+        void Reserve(size_t count)
+        {
+            size_t capacity = 64;
+            while (capacity < count * 2)
+                capacity <<= 1;
+            if (capacity > m_Keys.size())
+                Rehash(capacity);
+        }
+
+        uint32_t Find(uintptr_t key) const
+        {
+            if (m_Keys.empty())
+                return kMissing;
+
+            const size_t mask = m_Keys.size() - 1;
+            for (size_t slot = Hash(key) & mask;; slot = (slot + 1) & mask)
+            {
+                if (m_Keys[slot] == key)
+                    return m_Values[slot];
+                if (m_Keys[slot] == 0)
+                    return kMissing;
+            }
+        }
+
+        // Returns false (and leaves the map unchanged) when the key is already present.
+        bool Insert(uintptr_t key, uint32_t value)
+        {
+            if ((m_Count + 1) * 2 > m_Keys.size())
+                Rehash(std::max<size_t>(64, m_Keys.size() * 2));
+
+            const size_t mask = m_Keys.size() - 1;
+            for (size_t slot = Hash(key) & mask;; slot = (slot + 1) & mask)
+            {
+                if (m_Keys[slot] == key)
+                    return false;
+                if (m_Keys[slot] == 0)
+                {
+                    m_Keys[slot] = key;
+                    m_Values[slot] = value;
+                    ++m_Count;
+                    return true;
+                }
+            }
+        }
+
+        size_t Size() const { return m_Count; }
+
+    private:
+        static size_t Hash(uintptr_t key)
+        {
+            uint64_t value = static_cast<uint64_t>(key) >> 3;
+            value *= 0x9E3779B97F4A7C15ULL;
+            return static_cast<size_t>(value ^ (value >> 29));
+        }
+
+        void Rehash(size_t capacity)
+        {
+            std::vector<uintptr_t> keys(capacity, 0);
+            std::vector<uint32_t> values(capacity, 0);
+            const size_t mask = capacity - 1;
+            for (size_t i = 0; i < m_Keys.size(); ++i)
+            {
+                if (!m_Keys[i])
+                    continue;
+
+                size_t slot = Hash(m_Keys[i]) & mask;
+                while (keys[slot])
+                    slot = (slot + 1) & mask;
+                keys[slot] = m_Keys[i];
+                values[slot] = m_Values[i];
+            }
+            m_Keys.swap(keys);
+            m_Values.swap(values);
+        }
+
+        std::vector<uintptr_t> m_Keys;
+        std::vector<uint32_t> m_Values;
+        size_t m_Count = 0;
+    };
+
+    struct ReferenceNode
+    {
+        uintptr_t address = 0;
+        const void* type = nullptr; // runtime class
+        uint32_t parent = 0xFFFFFFFFU;
+        uint32_t label = 0;         // field index in the parent's class, or kArrayElement | index
+        uint32_t firstChild = 0;    // children are contiguous: BFS appends them together
+        uint32_t childCount = 0;
+        uint32_t depth = 0;
+    };
+
+    // Breadth-first tree of the objects reachable from a root, each reached by its shortest
+    // path. Nodes live in fixed-size chunks that are kept between walks, so the frontier (the
+    // unexpanded tail of the node list) grows without reallocating or moving.
+    class ReferenceGraph
+    {
+    public:
+        static constexpr uint32_t kArrayElement = 0x80000000U;
+        static constexpr uint32_t kNoNode = 0xFFFFFFFFU;
+        static constexpr uint32_t kChunkShift = 16;
+        static constexpr uint32_t kChunkSize = 1U << kChunkShift;
+
+        struct Limits
+        {
+            uint32_t maxDepth = 8;
+            uint32_t maxNodes = 1U << 20;
+            uint64_t maxEdges = 1ULL << 22;
+        };
+
+        struct Stats
+        {
+            uint32_t nodes = 0;
+            uint64_t edges = 0;         // references followed, including ones to visited nodes
+            uint32_t depthReached = 0;
+            bool nodeLimitHit = false;
+            bool edgeLimitHit = false;
+            double micros = 0.0;
+        };
+
+        // Handed to the expand callback; Emit returns false once a limit stops the walk.
+        class Emitter
+        {
+        public:
+            bool Emit(uintptr_t child, const void* type, uint32_t label)
+            {
+                return m_Graph->EmitChild(m_Parent, child, type, label);
+            }
+
+        private:
+            friend class ReferenceGraph;
+            Emitter(ReferenceGraph* graph, uint32_t parent) : m_Graph(graph), m_Parent(parent) {}
+
+            ReferenceGraph* m_Graph;
+            uint32_t m_Parent;
+        };
+
+        // expand(const ReferenceNode&, Emitter&) reports the node's outgoing references.
+        template<typename ExpandFn>
+        void Build(uintptr_t root, const void* rootType, const Limits& limits, ExpandFn&& expand)
+        {
+            using Clock = std::chrono::steady_clock;
+            const Clock::time_point start = Clock::now();
+
+            m_Count = 0;
+            m_Visited.Clear();
+            m_Limits = limits;
+            m_Stats = {};
+            m_Stopped = false;
+            if (!root)
+                return;
+
+            ReferenceNode rootNode{};
+            rootNode.address = root;
+            rootNode.type = rootType;
+            Append(rootNode);
+
+            for (uint32_t head = 0; head < m_Count && !m_Stopped; ++head)
+            {
+                ReferenceNode& node = At(head);
+                node.firstChild = m_Count;
+                if (node.depth < m_Limits.maxDepth)
+                {
+                    Emitter emitter(this, head);
+                    expand(static_cast<const ReferenceNode&>(node), emitter);
+                }
+
+                node.childCount = m_Count - node.firstChild;
+            }
+
+            m_Stats.nodes = m_Count;
+            m_Stats.micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        }
+
+        uint32_t Size() const { return m_Count; }
+        const ReferenceNode& Node(uint32_t index) const { return m_Chunks[index >> kChunkShift][index & (kChunkSize - 1)]; }
+        const Stats& GetStats() const { return m_Stats; }
+
+        uint32_t Find(uintptr_t address) const
+        {
+            const uint32_t index = m_Visited.Find(address);
+            return index == AddressMap::kMissing ? kNoNode : index;
+        }
+
+        // Node indices from the root down to node, inclusive.
+        void PathTo(uint32_t node, std::vector<uint32_t>* outPath) const
+        {
+            outPath->clear();
+            for (uint32_t current = node; current != kNoNode && current < m_Count; current = Node(current).parent)
+                outPath->push_back(current);
+            std::reverse(outPath->begin(), outPath->end());
+        }
+
+    private:
+        ReferenceNode& At(uint32_t index) { return m_Chunks[index >> kChunkShift][index & (kChunkSize - 1)]; }
+
+        void Append(const ReferenceNode& node)
+        {
+            const uint32_t chunk = m_Count >> kChunkShift;
+            if (chunk >= m_Chunks.size())
+                m_Chunks.emplace_back(new ReferenceNode[kChunkSize]);
+
+            At(m_Count) = node;
+            m_Visited.Insert(node.address, m_Count);
+            m_Stats.depthReached = std::max(m_Stats.depthReached, node.depth);
+            ++m_Count;
+        }
+
+        bool EmitChild(uint32_t parent, uintptr_t child, const void* type, uint32_t label)
+        {
+            if (m_Stopped)
+                return false;
+
+            if (++m_Stats.edges > m_Limits.maxEdges)
+            {
+                m_Stats.edgeLimitHit = true;
+                m_Stopped = true;
+                return false;
+            }
+
+            if (!child || m_Visited.Find(child) != AddressMap::kMissing)
+                return true;
+
+            if (m_Count >= m_Limits.maxNodes)
+            {
+                m_Stats.nodeLimitHit = true;
+                m_Stopped = true;
+                return false;
+            }
+
+            ReferenceNode node{};
+            node.address = child;
+            node.type = type;
+            node.parent = parent;
+            node.label = label;
+            node.depth = At(parent).depth + 1;
+            Append(node);
+            return true;
+        }
+
+        std::vector<std::unique_ptr<ReferenceNode[]>> m_Chunks;
+        uint32_t m_Count = 0;
+        AddressMap m_Visited;
+        Limits m_Limits;
+        Stats m_Stats;
+        bool m_Stopped = false;
+    };
+}
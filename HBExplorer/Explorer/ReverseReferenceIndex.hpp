@@ -0,0 +1,247 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "ParallelFor.hpp"
+
+namespace UExplorer
+{
+    // target -> (owner, slot) multimap over the reference slots of a set of owner objects.
+    // Every refresh re-reads all slots (in parallel; they are plain pointer loads) but only
+    // touches the map for owners that are new, gone, or whose slot values changed.
+    class ReverseReferenceIndex
+    {
+    public:
+        static constexpr size_t kMinChunk = 2048; // owners per worker before threading pays off
+        static constexpr uint32_t kNoOwner = 0xFFFFFFFFU;
+
+        struct Owner
+        {
+            uintptr_t address = 0;
+            const void* type = nullptr; // caller-defined; slots mean the same thing per type
+            uint32_t slotCount = 0;
+        };
+
+        struct Source
+        {
+            uintptr_t owner = 0;
+            uint32_t slot = 0; // index into the owner's slots
+        };
+
+        struct Stats
+        {
+            size_t owners = 0;
+            size_t references = 0;
+            size_t targets = 0;
+            size_t added = 0;      // owners not seen by the previous refresh
+            size_t changed = 0;    // owners with at least one slot retargeted
+            size_t removed = 0;
+            size_t unreadable = 0;
+            uint32_t threads = 0;
+            double gatherMs = 0.0;
+            double totalMs = 0.0;
+        };
+
+        void Clear()
+        {
+            m_Owners.clear();
+            m_SlotBegin.clear();
+            m_Slots.clear();
+            m_OwnerIndex.clear();
+            m_Incoming.clear();
+            m_References = 0;
+            m_Stats = {};
+        }
+
+        // gather(const Owner&, uintptr_t* outSlots) -> bool fills owner.slotCount slots and must
+        // be safe to call from several threads. Failed reads count as empty. Owner indices after
+        // the refresh are positions in owners.
+        template<typename GatherFn>
+        void Refresh(std::vector<Owner> owners, GatherFn&& gather, uint32_t maxThreads)
+        {
+            using Clock = std::chrono::steady_clock;
+            const Clock::time_point start = Clock::now();
+
+            const size_t count = owners.size();
+            std::vector<size_t> slotBegin(count + 1, 0);
+            for (size_t i = 0; i < count; ++i)
+                slotBegin[i + 1] = slotBegin[i] + owners[i].slotCount;
+            std::vector<uintptr_t> slots(slotBegin[count], 0);
+
+            const uint32_t workers = ParallelWorkerCount(count, maxThreads, kMinChunk);
+            std::vector<size_t> unreadable(workers, 0);
+
+            ParallelFor(count, workers, [&](uint32_t worker, size_t begin, size_t end)
+                {
+                    size_t failed = 0;
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        uintptr_t* out = slots.data() + slotBegin[i];
+                        if (!gather(static_cast<const Owner&>(owners[i]), out))
+                        {
+                            std::fill(out, out + owners[i].slotCount, uintptr_t{ 0 });
+                            ++failed;
+                        }
+                    }
+                    unreadable[worker] = failed;
+                });
+
+            const Clock::time_point gathered = Clock::now();
+
+            // Usually the owner set is unchanged and only slot values moved; then the owner
+            // index is reused and owners pair up by position.
+            const bool sameOwners = count == m_Owners.size()
+                && std::equal(owners.begin(), owners.end(), m_Owners.begin(), [](const Owner& lhs, const Owner& rhs)
+                    {
+                        return lhs.address == rhs.address && lhs.type == rhs.type && lhs.slotCount == rhs.slotCount;
+                    });
+
+            Stats stats{};
+            std::unordered_map<uintptr_t, uint32_t> ownerIndex;
+            if (!sameOwners)
+                ownerIndex.reserve(count);
+            std::vector<uint8_t> kept(m_Owners.size(), 0);
+            for (size_t i = 0; i < count; ++i)
+            {
+                const Owner& owner = owners[i];
+                const uintptr_t* current = slots.data() + slotBegin[i];
+                if (!sameOwners && !ownerIndex.emplace(owner.address, static_cast<uint32_t>(i)).second)
+                {
+                    // Duplicate owner: keep the first, index nothing for this one.
+                    owners[i].slotCount = 0;
+                    continue;
+                }
+
+                const uint32_t previous = sameOwners ? static_cast<uint32_t>(i) : FindOwner(owner.address);
+                if (previous != kNoOwner && m_Owners[previous].type == owner.type && m_Owners[previous].slotCount == owner.slotCount)
+                {
+                    kept[previous] = 1;
+                    const uintptr_t* old = m_Slots.data() + m_SlotBegin[previous];
+                    bool retargeted = false;
+                    for (uint32_t s = 0; s < owner.slotCount; ++s)
+                    {
+                        if (old[s] == current[s])
+                            continue;
+
+                        RemoveSource(old[s], owner.address, s);
+                        AddSource(current[s], owner.address, s);
+                        retargeted = true;
+                    }
+                    stats.changed += retargeted ? 1 : 0;
+                    continue;
+                }
+
+                if (previous != kNoOwner)
+                {
+                    kept[previous] = 1;
+                    RemoveOwnerSources(previous);
+                }
+                else
+                {
+                    ++stats.added;
+                }
+
+                for (uint32_t s = 0; s < owner.slotCount; ++s)
+                    AddSource(current[s], owner.address, s);
+            }
+
+            for (size_t previous = 0; previous < m_Owners.size(); ++previous)
+            {
+                if (kept[previous])
+                    continue;
+
+                RemoveOwnerSources(static_cast<uint32_t>(previous));
+                ++stats.removed;
+            }
+
+            m_Owners.swap(owners);
+            m_SlotBegin.swap(slotBegin);
+            m_Slots.swap(slots);
+            if (!sameOwners)
+                m_OwnerIndex.swap(ownerIndex);
+
+            stats.owners = m_Owners.size();
+            stats.references = m_References;
+            stats.targets = m_Incoming.size();
+            for (size_t failed : unreadable)
+                stats.unreadable += failed;
+            stats.threads = workers;
+            stats.gatherMs = std::chrono::duration<double, std::milli>(gathered - start).count();
+            stats.totalMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            m_Stats = stats;
+        }
+
+        // Everything that referenced target as of the last refresh, or nullptr.
+        const std::vector<Source>* Find(uintptr_t target) const
+        {
+            auto it = m_Incoming.find(target);
+            return it == m_Incoming.end() ? nullptr : &it->second;
+        }
+
+        uint32_t FindOwner(uintptr_t address) const
+        {
+            auto it = m_OwnerIndex.find(address);
+            return it == m_OwnerIndex.end() ? kNoOwner : it->second;
+        }
+
+        const Owner& GetOwner(uint32_t index) const { return m_Owners[index]; }
+        size_t OwnerCount() const { return m_Owners.size(); }
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        void AddSource(uintptr_t target, uintptr_t owner, uint32_t slot)
+        {
+            if (!target)
+                return;
+
+            m_Incoming[target].push_back({ owner, slot });
+            ++m_References;
+        }
+
+        void RemoveSource(uintptr_t target, uintptr_t owner, uint32_t slot)
+        {
+            if (!target)
+                return;
+
+            auto it = m_Incoming.find(target);
+            if (it == m_Incoming.end())
+                return;
+
+            std::vector<Source>& sources = it->second;
+            for (size_t i = 0; i < sources.size(); ++i)
+            {
+                if (sources[i].owner != owner || sources[i].slot != slot)
+                    continue;
+
+                sources[i] = sources.back();
+                sources.pop_back();
+                --m_References;
+                break;
+            }
+
+            if (sources.empty())
+                m_Incoming.erase(it);
+        }
+
+        void RemoveOwnerSources(uint32_t index)
+        {
+            const Owner& owner = m_Owners[index];
+            const uintptr_t* old = m_Slots.data() + m_SlotBegin[index];
+            for (uint32_t s = 0; s < owner.slotCount; ++s)
+                RemoveSource(old[s], owner.address, s);
+        }
+
+        std::vector<Owner> m_Owners;
+        std::vector<size_t> m_SlotBegin; // owner i's slots are m_Slots[m_SlotBegin[i], m_SlotBegin[i + 1])
+        std::vector<uintptr_t> m_Slots;
+        std::unordered_map<uintptr_t, uint32_t> m_OwnerIndex;
+        std::unordered_map<uintptr_t, std::vector<Source>> m_Incoming;
+        size_t m_References = 0;
+        Stats m_Stats;
+    };
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "Bitset.hpp"
+#include "HierarchyLayout.hpp"
+
+namespace UExplorer
+{
+    // Row values with this bit set stand for a collapsed group whose first member is the
+    // remaining value; plain row values are single items.
+    static constexpr uint32_t kGroupRowFlag = 0x80000000U;
+    static constexpr uint32_t kMinSiblingGroupRun = 8U;
+
+    // Reduces instance names to what their prefab was called: "Bullet (12)", "Bullet(Clone)",
+    // "Tile_042" and "NPC 7" become "Bullet", "Bullet", "Tile" and "NPC".
+    static std::string_view NameStem(std::string_view name)
+    {
+        constexpr std::string_view kCloneSuffix = "(Clone)";
+        auto isDigit = [](char c) { return c >= '0' && c <= '9'; };
+        auto isSeparator = [](char c) { return c == ' ' || c == '_' || c == '-' || c == '.'; };
+
+        for (;;)
+        {
+            const size_t before = name.size();
+
+            if (name.size() >= kCloneSuffix.size() && name.substr(name.size() - kCloneSuffix.size()) == kCloneSuffix)
+                name.remove_suffix(kCloneSuffix.size());
+
+            while (!name.empty() && isSeparator(name.back()))
+                name.remove_suffix(1);
+
+            if (!name.empty() && name.back() == ')')
+            {
+                const size_t open = name.rfind('(');
+                if (open != std::string_view::npos && open + 2U < name.size())
+                {
+                    bool digits = true;
+                    for (size_t i = open + 1U; digits && i + 1U < name.size(); ++i)
+                        digits = isDigit(name[i]);
+
+                    if (digits)
+                        name.remove_suffix(name.size() - open);
+                }
+            }
+
+            while (!name.empty() && isDigit(name.back()))
+                name.remove_suffix(1);
+
+            if (name.size() == before)
+                return name;
+        }
+    }
+
+    // Case-insensitive FNV-1a, matching the case-insensitive sibling order.
+    static uint64_t HashNameStem(std::string_view stem)
+    {
+        uint64_t hash = 14695981039346656037ULL;
+        for (char c : stem)
+        {
+            const unsigned char lowered = (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c - 'A' + 'a') : static_cast<unsigned char>(c);
+            hash = (hash ^ lowered) * 1099511628211ULL;
+        }
+
+        return hash;
+    }
+
+    // Never returns 0, which callers use for "do not group".
+    static uint64_t MixFingerprint(uint64_t stemHash, uint64_t signature)
+    {
+        uint64_t value = stemHash ^ (signature + 0x9E3779B97F4A7C15ULL + (stemHash << 6) + (stemHash >> 2));
+        value ^= value >> 33;
+        value *= 0xFF51AFD7ED558CCDULL;
+        value ^= value >> 33;
+        return value ? value : 1ULL;
+    }
+
+    // Runs of adjacent siblings that share a fingerprint, indexed by layout position of the
+    // first member. Built once per layout in a single pass over every sibling list.
+    struct SiblingGroups
+    {
+        std::vector<uint32_t> runLength; // position -> members in the run headed here, 0 if none
+        std::vector<uint32_t> runEnd;    // position -> one past the last member's subtree
+
+        void Clear()
+        {
+            runLength.clear();
+            runEnd.clear();
+        }
+    };
+
+    static void BuildSiblingGroups(
+        const HierarchyLayout& layout,
+        const std::vector<uint64_t>& fingerprintByPosition,
+        uint32_t minRun,
+        SiblingGroups* outGroups)
+    {
+        const uint32_t count = static_cast<uint32_t>(layout.Size());
+        outGroups->runLength.assign(count, 0U);
+        outGroups->runEnd.assign(count, 0U);
+
+        auto scanSiblings = [&](uint32_t first, uint32_t end)
+            {
+                uint32_t head = first;
+                uint32_t length = 0;
+                auto closeRun = [&](uint32_t runEnd)
+                    {
+                        if (length >= minRun && fingerprintByPosition[head] != 0)
+                        {
+                            outGroups->runLength[head] = length;
+                            outGroups->runEnd[head] = runEnd;
+                        }
+                    };
+
+                for (uint32_t pos = first; pos < end; pos = layout.subtreeEnd[pos])
+                {
+                    if (length != 0 && fingerprintByPosition[pos] == fingerprintByPosition[head])
+                    {
+                        ++length;
+                        continue;
+                    }
+
+                    closeRun(pos);
+                    head = pos;
+                    length = 1;
+                }
+
+                closeRun(end);
+            };
+
+        scanSiblings(0U, count);
+        for (uint32_t pos = 0; pos < count; ++pos)
+        {
+            if (layout.HasChildren(pos))
+                scanSiblings(pos + 1U, layout.subtreeEnd[pos]);
+        }
+    }
+
+    // FlattenVisibleRows with collapsed runs: a run whose head is not in groupExpanded emits
+    // one kGroupRowFlag row (if any member is visible) and is skipped in O(1).
+    static void FlattenGroupedRows(
+        const HierarchyLayout& layout,
+        const SiblingGroups& groups,
+        const Bitset* visible,
+        const Bitset& expanded,
+        const Bitset& groupExpanded,
+        std::vector<uint32_t>* outRows)
+    {
+        outRows->clear();
+
+        const uint32_t count = static_cast<uint32_t>(layout.Size());
+        uint32_t pos = 0;
+        while (pos < count)
+        {
+            if (groups.runLength[pos] != 0 && !groupExpanded.Test(pos))
+            {
+                const uint32_t runEnd = groups.runEnd[pos];
+                if (!visible || visible->AnyInRange(pos, runEnd))
+                    outRows->emplace_back(pos | kGroupRowFlag);
+
+                pos = runEnd;
+                continue;
+            }
+
+            if (visible && !visible->Test(pos))
+            {
+                pos = layout.subtreeEnd[pos];
+                continue;
+            }
+
+            outRows->emplace_back(pos);
+            pos = expanded.Test(pos) ? pos + 1U : layout.subtreeEnd[pos];
+        }
+    }
+}
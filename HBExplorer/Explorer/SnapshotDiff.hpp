@@ -0,0 +1,153 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UEXPLORER_DIFF_SSE2 1
+#endif
+
+namespace UExplorer
+{
+    // Half-open byte range [begin, end) relative to the start of the compared buffers.
+    struct ByteRange
+    {
+        uint32_t begin = 0;
+        uint32_t end = 0;
+    };
+
+    // Bytes of one field inside an instance. A span runs to the next field's offset (or the end
+    // of the instance), so padding after a field is attributed to it.
+    struct FieldSpan
+    {
+        uint32_t begin = 0;
+        uint32_t end = 0;
+        uint32_t field = 0; // caller-defined field index
+    };
+
+    namespace SnapshotDiffDetail
+    {
+        inline void AppendRange(std::vector<ByteRange>* out, uint32_t begin, uint32_t end)
+        {
+            if (!out->empty() && out->back().end == begin)
+                out->back().end = end;
+            else
+                out->push_back({ begin, end });
+        }
+
+        // Bit i of diffMask set means byte (base + i) differs.
+        inline void AppendMaskRanges(std::vector<ByteRange>* out, uint32_t base, uint32_t diffMask)
+        {
+            while (diffMask)
+            {
+                const uint32_t first = static_cast<uint32_t>(std::countr_zero(diffMask));
+                const uint32_t last = first + static_cast<uint32_t>(std::countr_one(diffMask >> first));
+                AppendRange(out, base + first, base + last);
+                diffMask = last < 32 ? diffMask & ~((1U << last) - 1U) : 0U;
+            }
+        }
+    }
+
+    // Appends the merged byte ranges where a and b differ. Equal data is skipped 32 bytes at a
+    // time; only blocks that differ are resolved down to bytes.
+    inline void DiffBytes(const uint8_t* a, const uint8_t* b, size_t size, std::vector<ByteRange>* out)
+    {
+        using namespace SnapshotDiffDetail;
+        static constexpr size_t kBlock = 32;
+
+        size_t offset = 0;
+#ifdef UEXPLORER_DIFF_SSE2
+        for (; offset + kBlock <= size; offset += kBlock)
+        {
+            const __m128i lo = _mm_cmpeq_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + offset)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + offset)));
+            const __m128i hi = _mm_cmpeq_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + offset + 16)),
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + offset + 16)));
+
+            const uint32_t equalMask = static_cast<uint32_t>(_mm_movemask_epi8(lo))
+                | (static_cast<uint32_t>(_mm_movemask_epi8(hi)) << 16);
+            if (equalMask != 0xFFFFFFFFU)
+                AppendMaskRanges(out, static_cast<uint32_t>(offset), ~equalMask);
+        }
+#else
+        for (; offset + kBlock <= size; offset += kBlock)
+        {
+            uint64_t words[8];
+            std::memcpy(words, a + offset, kBlock);
+            std::memcpy(words + 4, b + offset, kBlock);
+            if (((words[0] ^ words[4]) | (words[1] ^ words[5]) | (words[2] ^ words[6]) | (words[3] ^ words[7])) == 0)
+                continue;
+
+            uint32_t diffMask = 0;
+            for (uint32_t i = 0; i < kBlock; ++i)
+                diffMask |= static_cast<uint32_t>(a[offset + i] != b[offset + i]) << i;
+            AppendMaskRanges(out, static_cast<uint32_t>(offset), diffMask);
+        }
+#endif
+
+        for (; offset < size; ++offset)
+        {
+            if (a[offset] != b[offset])
+                AppendRange(out, static_cast<uint32_t>(offset), static_cast<uint32_t>(offset + 1));
+        }
+    }
+
+    // Builds offset-sorted spans from (offset, field) pairs of one instance. Fields sharing an
+    // offset (explicit layouts) get the same span; offsets at or past instanceSize are dropped.
+    inline void BuildFieldSpans(std::vector<FieldSpan>* spans, uint32_t instanceSize)
+    {
+        std::sort(spans->begin(), spans->end(), [](const FieldSpan& lhs, const FieldSpan& rhs)
+            {
+                return lhs.begin < rhs.begin;
+            });
+
+        spans->erase(std::remove_if(spans->begin(), spans->end(), [&](const FieldSpan& span)
+            {
+                return span.begin >= instanceSize;
+            }), spans->end());
+
+        for (size_t i = 0; i < spans->size(); ++i)
+        {
+            uint32_t end = instanceSize;
+            for (size_t j = i + 1; j < spans->size(); ++j)
+            {
+                if ((*spans)[j].begin > (*spans)[i].begin)
+                {
+                    end = (*spans)[j].begin;
+                    break;
+                }
+            }
+            (*spans)[i].end = end;
+        }
+    }
+
+    // Sets outChanged[span index] for every span overlapping a range. Both inputs are sorted by
+    // begin; spans only overlap when they share an offset.
+    inline size_t MarkChangedSpans(const std::vector<ByteRange>& ranges, const std::vector<FieldSpan>& spans, uint8_t* outChanged)
+    {
+        size_t marked = 0;
+        size_t first = 0;
+        for (const ByteRange& range : ranges)
+        {
+            while (first < spans.size() && spans[first].end <= range.begin)
+                ++first;
+
+            for (size_t s = first; s < spans.size() && spans[s].begin < range.end; ++s)
+            {
+                if (!outChanged[s])
+                {
+                    outChanged[s] = 1;
+                    ++marked;
+                }
+            }
+        }
+        return marked;
+    }
+}
@@ -0,0 +1,895 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "Bitset.hpp"
+
+namespace UExplorer
+{
+    // Six inward-facing planes (a, b, c, d): a point is inside when a*x + b*y + c*z + d >= 0
+    // for all of them.
+    struct Frustum
+    {
+        float planes[6][4]{};
+
+        // viewProjection is column-major (Unity's Matrix4x4 layout, element [column * 4 + row]),
+        // with OpenGL-style clip space as Unity reports it: -w <= x, y, z <= w.
+        static Frustum FromViewProjection(const float* viewProjection)
+        {
+            auto row = [viewProjection](int r, int c) { return viewProjection[c * 4 + r]; };
+
+            Frustum frustum{};
+            for (int i = 0; i < 6; ++i)
+            {
+                const int axis = i / 2;
+                const float sign = (i & 1) ? -1.0f : 1.0f;
+                float length = 0.0f;
+                for (int c = 0; c < 4; ++c)
+                {
+                    frustum.planes[i][c] = row(3, c) + sign * row(axis, c);
+                    if (c < 3)
+                        length += frustum.planes[i][c] * frustum.planes[i][c];
+                }
+
+                length = std::sqrt(length);
+                if (length > 0.0f)
+                {
+                    for (float& value : frustum.planes[i])
+                        value /= length;
+                }
+            }
+
+            return frustum;
+        }
+
+        // out = left * right, both column-major.
+        static void Multiply(const float* left, const float* right, float* out)
+        {
+            for (int c = 0; c < 4; ++c)
+            {
+                for (int r = 0; r < 4; ++r)
+                {
+                    float sum = 0.0f;
+                    for (int k = 0; k < 4; ++k)
+                        sum += left[k * 4 + r] * right[c * 4 + k];
+                    out[c * 4 + r] = sum;
+                }
+            }
+        }
+
+        bool ContainsPoint(float x, float y, float z) const
+        {
+            for (const float* plane : planes)
+            {
+                if (plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0.0f)
+                    return false;
+            }
+
+            return true;
+        }
+
+        // Conservative: false only when the box lies fully behind one plane.
+        bool IntersectsBox(const float* boxMin, const float* boxMax) const
+        {
+            for (const float* plane : planes)
+            {
+                const float x = plane[0] >= 0.0f ? boxMax[0] : boxMin[0];
+                const float y = plane[1] >= 0.0f ? boxMax[1] : boxMin[1];
+                const float z = plane[2] >= 0.0f ? boxMax[2] : boxMin[2];
+                if (plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0.0f)
+                    return false;
+            }
+
+            return true;
+        }
+
+        // True when every corner of the box is inside.
+        bool ContainsBox(const float* boxMin, const float* boxMax) const
+        {
+            for (const float* plane : planes)
+            {
+                const float x = plane[0] >= 0.0f ? boxMin[0] : boxMax[0];
+                const float y = plane[1] >= 0.0f ? boxMin[1] : boxMax[1];
+                const float z = plane[2] >= 0.0f ? boxMin[2] : boxMax[2];
+                if (plane[0] * x + plane[1] * y + plane[2] * z + plane[3] < 0.0f)
+                    return false;
+            }
+
+            return true;
+        }
+
+        // Box around the eight corners, padded for rounding. False when three of the planes do
+        // not meet in one point (an infinite far plane, a degenerate matrix).
+        bool CornerBounds(float* outMin, float* outMax) const
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                outMin[axis] = std::numeric_limits<float>::max();
+                outMax[axis] = std::numeric_limits<float>::lowest();
+            }
+
+            for (int corner = 0; corner < 8; ++corner)
+            {
+                float point[3];
+                if (!IntersectPlanes(planes[corner & 1], planes[2 + ((corner >> 1) & 1)], planes[4 + (corner >> 2)], point))
+                    return false;
+
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    outMin[axis] = std::min(outMin[axis], point[axis]);
+                    outMax[axis] = std::max(outMax[axis], point[axis]);
+                }
+            }
+
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float pad = (outMax[axis] - outMin[axis]) * 1e-4f + 1e-3f;
+                outMin[axis] -= pad;
+                outMax[axis] += pad;
+            }
+            return true;
+        }
+
+    private:
+        static bool IntersectPlanes(const float* p1, const float* p2, const float* p3, float* outPoint)
+        {
+            auto cross = [](const float* a, const float* b, float* out)
+                {
+                    out[0] = a[1] * b[2] - a[2] * b[1];
+                    out[1] = a[2] * b[0] - a[0] * b[2];
+                    out[2] = a[0] * b[1] - a[1] * b[0];
+                };
+
+            float c23[3], c31[3], c12[3];
+            cross(p2, p3, c23);
+            cross(p3, p1, c31);
+            cross(p1, p2, c12);
+            const float det = p1[0] * c23[0] + p1[1] * c23[1] + p1[2] * c23[2];
+            if (!(std::fabs(det) > 1e-6f))
+                return false;
+
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                outPoint[axis] = -(p1[3] * c23[axis] + p2[3] * c31[axis] + p3[3] * c12[axis]) / det;
+                if (!(std::fabs(outPoint[axis]) <= std::numeric_limits<float>::max()))
+                    return false;
+            }
+            return true;
+        }
+    };
+
+    // Uniform grid over world positions, kept as a sorted cell table: the occupied cells in
+    // (z, y, x) order, each owning a contiguous run of object slots with the positions copied
+    // alongside. A range query binary searches each (y, z) row it covers and scans that row's
+    // slots sequentially; when the searches would cost more than walking every occupied cell it
+    // walks them instead. Build is a counting sort over the cell range when that is dense and a
+    // radix sort of the cell keys otherwise, with no per-cell allocation.
+    // An object moved to another cell leaves a dead slot and joins a loose list every query
+    // scans; once those pile up the table is rebuilt from the grid's own copy of the positions.
+    class SpatialGrid
+    {
+    public:
+        static constexpr uint32_t kNone = 0xFFFFFFFFU;
+
+        struct Neighbor
+        {
+            float distanceSq = 0.0f;
+            uint32_t id = 0;
+        };
+
+        void Build(size_t count, const float* xs, const float* ys, const float* zs, const Bitset& valid, float cellSize)
+        {
+            m_CellSize = std::max(cellSize, 1e-3f);
+            m_InvCellSize = 1.0f / m_CellSize;
+            m_Count = count;
+            m_X.assign(xs, xs + count);
+            m_Y.assign(ys, ys + count);
+            m_Z.assign(zs, zs + count);
+            Index(valid);
+        }
+
+        // Moves (or inserts) one object; non-finite positions remove it.
+        void Update(uint32_t id, float x, float y, float z)
+        {
+            if (id >= m_Count)
+                return;
+
+            if (!IsFinite(x, y, z))
+            {
+                Remove(id);
+                return;
+            }
+
+            m_X[id] = x;
+            m_Y[id] = y;
+            m_Z[id] = z;
+            GrowBounds(x, y, z);
+
+            const uint32_t slot = m_Slot[id];
+            if (slot != kNone)
+            {
+                uint64_t key = 0;
+                if (KeyOf(x, y, z, &key) && m_CellKey[CellOfSlot(slot)] == key)
+                {
+                    m_Entries[slot].x = x;
+                    m_Entries[slot].y = y;
+                    m_Entries[slot].z = z;
+                    return;
+                }
+
+                m_Entries[slot].id = kNone;
+                m_Slot[id] = kNone;
+                ++m_DeadSlots;
+                AddLoose(id);
+                CompactIfNeeded();
+                return;
+            }
+
+            if (m_LoosePos[id] == kNone)
+            {
+                AddLoose(id);
+                ++m_Inserted;
+                CompactIfNeeded();
+            }
+        }
+
+        void Remove(uint32_t id)
+        {
+            if (id >= m_Count)
+                return;
+
+            if (const uint32_t slot = m_Slot[id]; slot != kNone)
+            {
+                m_Entries[slot].id = kNone;
+                m_Slot[id] = kNone;
+                ++m_DeadSlots;
+            }
+            else if (const uint32_t pos = m_LoosePos[id]; pos != kNone)
+            {
+                const uint32_t last = m_Loose.back();
+                m_Loose[pos] = last;
+                m_LoosePos[last] = pos;
+                m_Loose.pop_back();
+                m_LoosePos[id] = kNone;
+            }
+            else
+            {
+                return;
+            }
+
+            --m_Inserted;
+            CompactIfNeeded();
+        }
+
+        // fn(id) for every indexed object inside [boxMin, boxMax].
+        template<typename Fn>
+        void QueryBox(const float* boxMin, const float* boxMax, Fn&& fn) const
+        {
+            auto inside = [boxMin, boxMax](float x, float y, float z)
+                {
+                    return x >= boxMin[0] && x <= boxMax[0] && y >= boxMin[1] && y <= boxMax[1] && z >= boxMin[2] && z <= boxMax[2];
+                };
+
+            ForEachCell(boxMin, boxMax, nullptr, [&](uint32_t begin, uint32_t end, bool)
+                {
+                    for (uint32_t slot = begin; slot < end; ++slot)
+                    {
+                        const Entry& entry = m_Entries[slot];
+                        if (entry.id != kNone && inside(entry.x, entry.y, entry.z))
+                            fn(entry.id);
+                    }
+                });
+
+            for (uint32_t id : m_Loose)
+            {
+                if (inside(m_X[id], m_Y[id], m_Z[id]))
+                    fn(id);
+            }
+        }
+
+        // fn(id, distanceSq) for every indexed object within radius of center.
+        template<typename Fn>
+        void QueryRadius(const float* center, float radius, Fn&& fn) const
+        {
+            const float boxMin[3] = { center[0] - radius, center[1] - radius, center[2] - radius };
+            const float boxMax[3] = { center[0] + radius, center[1] + radius, center[2] + radius };
+            const float radiusSq = radius * radius;
+            auto distanceSq = [center](float x, float y, float z)
+                {
+                    const float dx = x - center[0];
+                    const float dy = y - center[1];
+                    const float dz = z - center[2];
+                    return dx * dx + dy * dy + dz * dz;
+                };
+
+            ForEachCell(boxMin, boxMax, nullptr, [&](uint32_t begin, uint32_t end, bool)
+                {
+                    for (uint32_t slot = begin; slot < end; ++slot)
+                    {
+                        const Entry& entry = m_Entries[slot];
+                        const float value = distanceSq(entry.x, entry.y, entry.z);
+                        if (value <= radiusSq && entry.id != kNone)
+                            fn(entry.id, value);
+                    }
+                });
+
+            for (uint32_t id : m_Loose)
+            {
+                const float value = distanceSq(m_X[id], m_Y[id], m_Z[id]);
+                if (value <= radiusSq)
+                    fn(id, value);
+            }
+        }
+
+        // The k closest objects within maxRadius, nearest first. The search radius doubles
+        // from one cell until k hits are found inside a radius that also bounds the kth.
+        void Nearest(const float* center, size_t k, float maxRadius, std::vector<Neighbor>* outNeighbors) const
+        {
+            outNeighbors->clear();
+            if (k == 0 || m_Inserted == 0)
+                return;
+
+            const float reach = std::min(maxRadius, BoundsReach(center));
+            float radius = std::min(m_CellSize, reach);
+            for (;;)
+            {
+                outNeighbors->clear();
+                QueryRadius(center, radius, [outNeighbors](uint32_t id, float distanceSq)
+                    {
+                        outNeighbors->push_back({ distanceSq, id });
+                    });
+
+                if (outNeighbors->size() >= k || radius >= reach)
+                    break;
+                radius = std::min(radius * 2.0f, reach);
+            }
+
+            auto byDistance = [](const Neighbor& left, const Neighbor& right)
+                {
+                    return left.distanceSq < right.distanceSq || (left.distanceSq == right.distanceSq && left.id < right.id);
+                };
+
+            if (outNeighbors->size() > k)
+            {
+                std::partial_sort(outNeighbors->begin(), outNeighbors->begin() + static_cast<std::ptrdiff_t>(k), outNeighbors->end(), byDistance);
+                outNeighbors->resize(k);
+            }
+            else
+            {
+                std::sort(outNeighbors->begin(), outNeighbors->end(), byDistance);
+            }
+        }
+
+        // fn(id) for every indexed object inside the frustum. Only cells in the box around the
+        // frustum's corners are visited; cells wholly inside skip the per-object test.
+        template<typename Fn>
+        void QueryFrustum(const Frustum& frustum, Fn&& fn) const
+        {
+            if (m_Inserted == 0)
+                return;
+
+            float boxMin[3] = { m_BoundsMin[0], m_BoundsMin[1], m_BoundsMin[2] };
+            float boxMax[3] = { m_BoundsMax[0], m_BoundsMax[1], m_BoundsMax[2] };
+            float cornerMin[3];
+            float cornerMax[3];
+            if (frustum.CornerBounds(cornerMin, cornerMax))
+            {
+                for (int axis = 0; axis < 3; ++axis)
+                {
+                    boxMin[axis] = std::max(boxMin[axis], cornerMin[axis]);
+                    boxMax[axis] = std::min(boxMax[axis], cornerMax[axis]);
+                }
+            }
+
+            ForEachCell(boxMin, boxMax, &frustum, [&](uint32_t begin, uint32_t end, bool inside)
+                {
+                    for (uint32_t slot = begin; slot < end; ++slot)
+                    {
+                        const Entry& entry = m_Entries[slot];
+                        if (entry.id != kNone && (inside || frustum.ContainsPoint(entry.x, entry.y, entry.z)))
+                            fn(entry.id);
+                    }
+                });
+
+            for (uint32_t id : m_Loose)
+            {
+                if (frustum.ContainsPoint(m_X[id], m_Y[id], m_Z[id]))
+                    fn(id);
+            }
+        }
+
+        bool Contains(uint32_t id) const { return id < m_Count && (m_Slot[id] != kNone || m_LoosePos[id] != kNone); }
+        size_t Size() const { return m_Count; }
+        size_t InsertedCount() const { return m_Inserted; }
+        size_t CellCount() const { return m_CellKey.size(); }
+        size_t LooseCount() const { return m_Loose.size(); }
+        float CellSize() const { return m_CellSize; }
+
+        float DistanceSq(uint32_t id, const float* point) const
+        {
+            const float dx = m_X[id] - point[0];
+            const float dy = m_Y[id] - point[1];
+            const float dz = m_Z[id] - point[2];
+            return dx * dx + dy * dy + dz * dz;
+        }
+
+    private:
+        // Table cells lie within this many cells of the mean position on each axis, so one far
+        // outlier cannot widen every key; the objects beyond start out loose.
+        static constexpr int64_t kWindowHalf = int64_t{ 1 } << 20;
+        static constexpr int32_t kCellLimit = 1000000000; // CellOf clamps here; such cells are not exact
+        // One slot: the position copy and its id, kNone once the object moved out. Kept
+        // together so placing an object during a build touches one cache line.
+        struct Entry
+        {
+            float x, y, z;
+            uint32_t id;
+        };
+
+        static constexpr unsigned kDigitBits = 11;
+        static constexpr uint64_t kMinDenseCells = 4096;
+        static constexpr uint64_t kDenseCellsPerObject = 8; // beyond this the counting pass costs more than sorting
+        static constexpr size_t kMinLooseForRebuild = 256;
+        static constexpr size_t kLooseRebuildDivisor = 8;
+
+        // inf - inf and NaN both come out as NaN, which fails the comparison.
+        static bool IsFinite(float x, float y, float z)
+        {
+            return (x - x) + (y - y) + (z - z) == 0.0f;
+        }
+
+        static unsigned BitWidth(uint32_t value)
+        {
+            unsigned bits = 0;
+            while (value >> bits)
+                ++bits;
+            return bits;
+        }
+
+        // Truncate-and-adjust floor; std::floor is a library call without SSE4.1, and this
+        // runs for every object on every build.
+        int32_t CellOf(float value) const
+        {
+            constexpr float kLimit = static_cast<float>(kCellLimit);
+            const float scaled = std::min(std::max(value * m_InvCellSize, -kLimit), kLimit);
+            const int32_t truncated = static_cast<int32_t>(scaled);
+            return truncated - (scaled < static_cast<float>(truncated) ? 1 : 0);
+        }
+
+        uint64_t Key(uint32_t rx, uint32_t ry, uint32_t rz) const
+        {
+            return (static_cast<uint64_t>(rz) << m_ShiftZ) | (static_cast<uint64_t>(ry) << m_ShiftY) | rx;
+        }
+
+        // False when the position's cell lies outside the table.
+        bool KeyOf(float x, float y, float z, uint64_t* outKey) const
+        {
+            const int32_t cells[3] = { CellOf(x), CellOf(y), CellOf(z) };
+            uint32_t relative[3];
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                if (cells[axis] < m_CellMin[axis] || cells[axis] > m_CellMax[axis])
+                    return false;
+                relative[axis] = static_cast<uint32_t>(cells[axis] - m_CellMin[axis]);
+            }
+
+            *outKey = Key(relative[0], relative[1], relative[2]);
+            return true;
+        }
+
+        size_t CellOfSlot(uint32_t slot) const
+        {
+            return static_cast<size_t>(std::upper_bound(m_CellStart.begin(), m_CellStart.end(), slot) - m_CellStart.begin()) - 1U;
+        }
+
+        void CellBox(uint32_t rx, uint32_t ry, uint32_t rz, float* outMin, float* outMax) const
+        {
+            const uint32_t relative[3] = { rx, ry, rz };
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float low = static_cast<float>(m_CellMin[axis] + static_cast<int32_t>(relative[axis])) * m_CellSize;
+                outMin[axis] = low - m_CellMargin;
+                outMax[axis] = low + m_CellSize + m_CellMargin;
+            }
+        }
+
+        void AddLoose(uint32_t id)
+        {
+            m_LoosePos[id] = static_cast<uint32_t>(m_Loose.size());
+            m_Loose.push_back(id);
+        }
+
+        void CompactIfNeeded()
+        {
+            if (m_Loose.size() + m_DeadSlots <= std::max(kMinLooseForRebuild, m_Inserted / kLooseRebuildDivisor))
+                return;
+
+            Bitset indexed;
+            indexed.Resize(m_Count);
+            for (size_t id = 0; id < m_Count; ++id)
+            {
+                if (Contains(static_cast<uint32_t>(id)))
+                    indexed.Set(id);
+            }
+            Index(indexed);
+        }
+
+        void Index(const Bitset& valid)
+        {
+            m_Slot.assign(m_Count, kNone);
+            m_LoosePos.assign(m_Count, kNone);
+            m_Loose.clear();
+            m_DeadSlots = 0;
+            m_CellKey.clear();
+            m_CellStart.clear();
+            ResetBounds();
+
+            // Bounds and the mean position of what is indexed.
+            std::vector<uint32_t>& ids = m_SortIds;
+            ids.resize(m_Count);
+            size_t idCount = 0;
+            double sum[3]{};
+            float boundsMin[3] = { m_BoundsMin[0], m_BoundsMin[1], m_BoundsMin[2] };
+            float boundsMax[3] = { m_BoundsMax[0], m_BoundsMax[1], m_BoundsMax[2] };
+            valid.ForEachSet([&](size_t id)
+                {
+                    if (id >= m_Count)
+                        return;
+
+                    const float x = m_X[id];
+                    const float y = m_Y[id];
+                    const float z = m_Z[id];
+                    if (!IsFinite(x, y, z))
+                        return;
+
+                    ids[idCount++] = static_cast<uint32_t>(id);
+                    sum[0] += x;
+                    sum[1] += y;
+                    sum[2] += z;
+                    boundsMin[0] = std::min(boundsMin[0], x); boundsMax[0] = std::max(boundsMax[0], x);
+                    boundsMin[1] = std::min(boundsMin[1], y); boundsMax[1] = std::max(boundsMax[1], y);
+                    boundsMin[2] = std::min(boundsMin[2], z); boundsMax[2] = std::max(boundsMax[2], z);
+                });
+            ids.resize(idCount);
+
+            m_Inserted = ids.size();
+            m_CellStart.push_back(0);
+            if (ids.empty())
+                return;
+
+            float maxAbs = 0.0f;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                m_BoundsMin[axis] = boundsMin[axis];
+                m_BoundsMax[axis] = boundsMax[axis];
+                maxAbs = std::max(maxAbs, std::max(std::fabs(boundsMin[axis]), std::fabs(boundsMax[axis])));
+
+                const int64_t center = CellOf(static_cast<float>(sum[axis] / static_cast<double>(ids.size())));
+                m_CellMin[axis] = static_cast<int32_t>(std::max<int64_t>({ CellOf(boundsMin[axis]), center - kWindowHalf, -kCellLimit + 1 }));
+                m_CellMax[axis] = static_cast<int32_t>(std::min<int64_t>({ CellOf(boundsMax[axis]), center + kWindowHalf - 1, kCellLimit - 1 }));
+            }
+
+            // Cell boxes are padded so float rounding can only make frustum tests visit more.
+            m_CellMargin = m_CellSize * 1e-3f + maxAbs * 4e-6f;
+            const unsigned bitsX = BitWidth(static_cast<uint32_t>(m_CellMax[0] - m_CellMin[0]));
+            const unsigned bitsY = BitWidth(static_cast<uint32_t>(m_CellMax[1] - m_CellMin[1]));
+            const unsigned bitsZ = BitWidth(static_cast<uint32_t>(m_CellMax[2] - m_CellMin[2]));
+            m_ShiftY = bitsX;
+            m_ShiftZ = bitsX + bitsY;
+            m_MaskX = (uint64_t{ 1 } << bitsX) - 1U;
+            m_MaskY = (uint64_t{ 1 } << bitsY) - 1U;
+
+            const uint64_t cellRange = (static_cast<uint64_t>(m_CellMax[0] - m_CellMin[0]) + 1U)
+                * (static_cast<uint64_t>(m_CellMax[1] - m_CellMin[1]) + 1U)
+                * (static_cast<uint64_t>(m_CellMax[2] - m_CellMin[2]) + 1U);
+            if (cellRange <= std::max<uint64_t>(kMinDenseCells, ids.size() * kDenseCellsPerObject))
+                IndexDense(static_cast<uint32_t>(cellRange));
+            else
+                IndexSorted(bitsX + bitsY + bitsZ);
+        }
+
+        // Counting sort over every cell in range: one pass counts, one places. Slots within a
+        // cell stay in id order.
+        void IndexDense(uint32_t cellRange)
+        {
+            const uint32_t spanX = static_cast<uint32_t>(m_CellMax[0] - m_CellMin[0]) + 1U;
+            const uint32_t spanY = static_cast<uint32_t>(m_CellMax[1] - m_CellMin[1]) + 1U;
+            const uint32_t spanZ = static_cast<uint32_t>(m_CellMax[2] - m_CellMin[2]) + 1U;
+            std::vector<uint32_t>& cellOf = m_SortIdsSwap;
+            std::vector<uint32_t>& counts = m_DenseCounts;
+            cellOf.resize(m_SortIds.size());
+            counts.assign(cellRange, 0U);
+
+            size_t kept = 0;
+            for (size_t i = 0; i < m_SortIds.size(); ++i)
+            {
+                const uint32_t id = m_SortIds[i];
+                const int32_t cx = CellOf(m_X[id]) - m_CellMin[0];
+                const int32_t cy = CellOf(m_Y[id]) - m_CellMin[1];
+                const int32_t cz = CellOf(m_Z[id]) - m_CellMin[2];
+                if (static_cast<uint32_t>(cx) >= spanX || static_cast<uint32_t>(cy) >= spanY || static_cast<uint32_t>(cz) >= spanZ)
+                {
+                    cellOf[i] = kNone;
+                    AddLoose(id);
+                    continue;
+                }
+
+                const uint32_t cell = static_cast<uint32_t>(cx) + spanX * (static_cast<uint32_t>(cy) + spanY * static_cast<uint32_t>(cz));
+                cellOf[i] = cell;
+                ++counts[cell];
+                ++kept;
+            }
+
+            // Occupied cells come out in key order because the linear index shares its axis order.
+            m_CellKey.reserve(std::min<size_t>(kept, cellRange));
+            m_CellStart.reserve(std::min<size_t>(kept, cellRange) + 1U);
+            m_CellStart.clear();
+            uint32_t next = 0;
+            uint32_t cell = 0;
+            for (uint32_t rz = 0; rz < spanZ; ++rz)
+            {
+                for (uint32_t ry = 0; ry < spanY; ++ry)
+                {
+                    for (uint32_t rx = 0; rx < spanX; ++rx, ++cell)
+                    {
+                        const uint32_t cellCount = counts[cell];
+                        if (!cellCount)
+                            continue;
+
+                        m_CellKey.push_back(Key(rx, ry, rz));
+                        m_CellStart.push_back(next);
+                        counts[cell] = next;
+                        next += cellCount;
+                    }
+                }
+            }
+            m_CellStart.push_back(next);
+
+            m_Entries.resize(kept);
+            for (size_t i = 0; i < m_SortIds.size(); ++i)
+            {
+                if (cellOf[i] == kNone)
+                    continue;
+
+                const uint32_t id = m_SortIds[i];
+                const uint32_t slot = counts[cellOf[i]]++;
+                m_Entries[slot] = { m_X[id], m_Y[id], m_Z[id], id };
+                m_Slot[id] = slot;
+            }
+        }
+
+        // Sparse worlds: radix sort the packed keys, then gather cells from the sorted run.
+        void IndexSorted(unsigned keyBits)
+        {
+            std::vector<uint32_t>& ids = m_SortIds;
+            std::vector<uint64_t>& keys = m_SortKeys;
+            keys.resize(ids.size());
+            size_t kept = 0;
+            for (uint32_t id : ids)
+            {
+                uint64_t key = 0;
+                if (!KeyOf(m_X[id], m_Y[id], m_Z[id], &key))
+                {
+                    AddLoose(id);
+                    continue;
+                }
+
+                ids[kept] = id;
+                keys[kept] = key;
+                ++kept;
+            }
+            ids.resize(kept);
+            keys.resize(kept);
+            SortByKey(keyBits);
+
+            m_Entries.resize(kept);
+            m_CellKey.reserve(kept);
+            m_CellStart.reserve(kept + 1U);
+            m_CellStart.clear();
+            for (uint32_t slot = 0; slot < kept; ++slot)
+            {
+                const uint32_t id = ids[slot];
+                m_Entries[slot] = { m_X[id], m_Y[id], m_Z[id], id };
+                m_Slot[id] = slot;
+
+                if (slot == 0 || keys[slot] != keys[slot - 1U])
+                {
+                    m_CellKey.push_back(keys[slot]);
+                    m_CellStart.push_back(slot);
+                }
+            }
+            m_CellStart.push_back(static_cast<uint32_t>(kept));
+        }
+
+        // LSD radix sort of m_SortKeys (with m_SortIds alongside) on their low `bits` bits.
+        void SortByKey(unsigned bits)
+        {
+            const size_t count = m_SortKeys.size();
+            m_SortKeysSwap.resize(count);
+            m_SortIdsSwap.resize(count);
+
+            constexpr uint32_t kBuckets = 1U << kDigitBits;
+            uint32_t offsets[kBuckets];
+            for (unsigned shift = 0; shift < bits; shift += kDigitBits)
+            {
+                std::fill(offsets, offsets + kBuckets, 0U);
+                for (size_t i = 0; i < count; ++i)
+                    ++offsets[(m_SortKeys[i] >> shift) & (kBuckets - 1U)];
+
+                uint32_t total = 0;
+                for (uint32_t& offset : offsets)
+                {
+                    const uint32_t bucketCount = offset;
+                    offset = total;
+                    total += bucketCount;
+                }
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const uint32_t position = offsets[(m_SortKeys[i] >> shift) & (kBuckets - 1U)]++;
+                    m_SortKeysSwap[position] = m_SortKeys[i];
+                    m_SortIdsSwap[position] = m_SortIds[i];
+                }
+
+                m_SortKeys.swap(m_SortKeysSwap);
+                m_SortIds.swap(m_SortIdsSwap);
+            }
+        }
+
+        void ResetBounds()
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                m_BoundsMin[axis] = std::numeric_limits<float>::max();
+                m_BoundsMax[axis] = std::numeric_limits<float>::lowest();
+            }
+        }
+
+        // Bounds only grow between builds; they clip frustum and kNN searches, not results.
+        void GrowBounds(float x, float y, float z)
+        {
+            const float point[3] = { x, y, z };
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                m_BoundsMin[axis] = std::min(m_BoundsMin[axis], point[axis]);
+                m_BoundsMax[axis] = std::max(m_BoundsMax[axis], point[axis]);
+            }
+        }
+
+        // Distance from point to the farthest bounds corner: no object lies beyond it.
+        float BoundsReach(const float* point) const
+        {
+            float sum = 0.0f;
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float span = std::max(std::fabs(point[axis] - m_BoundsMin[axis]), std::fabs(m_BoundsMax[axis] - point[axis]));
+                sum += span * span;
+            }
+            return std::sqrt(sum);
+        }
+
+        // cellFn(slotBegin, slotEnd, inside) for every occupied table cell in the box's cell
+        // range. A frustum, when given, drops rows and cells it cannot touch; inside is true for
+        // cells it fully contains. Loose objects are the caller's.
+        template<typename CellFn>
+        void ForEachCell(const float* boxMin, const float* boxMax, const Frustum* frustum, CellFn&& cellFn) const
+        {
+            const size_t cellCount = m_CellKey.size();
+            if (cellCount == 0)
+                return;
+
+            uint32_t lo[3]{};
+            uint32_t hi[3]{};
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float clippedMin = std::max(boxMin[axis], m_BoundsMin[axis]);
+                const float clippedMax = std::min(boxMax[axis], m_BoundsMax[axis]);
+                if (!(clippedMin <= clippedMax))
+                    return;
+
+                const int32_t cellLo = std::max(CellOf(clippedMin), m_CellMin[axis]);
+                const int32_t cellHi = std::min(CellOf(clippedMax), m_CellMax[axis]);
+                if (cellLo > cellHi)
+                    return;
+
+                lo[axis] = static_cast<uint32_t>(cellLo - m_CellMin[axis]);
+                hi[axis] = static_cast<uint32_t>(cellHi - m_CellMin[axis]);
+            }
+
+            auto visit = [&](size_t cell, uint32_t rx, uint32_t ry, uint32_t rz)
+                {
+                    bool inside = false;
+                    if (frustum)
+                    {
+                        float cellMin[3];
+                        float cellMax[3];
+                        CellBox(rx, ry, rz, cellMin, cellMax);
+                        if (!frustum->IntersectsBox(cellMin, cellMax))
+                            return;
+                        inside = frustum->ContainsBox(cellMin, cellMax);
+                    }
+
+                    cellFn(m_CellStart[cell], m_CellStart[cell + 1U], inside);
+                };
+
+            // One search per row, unless that costs more than walking every occupied cell.
+            const double rows = (static_cast<double>(hi[1] - lo[1]) + 1.0) * (static_cast<double>(hi[2] - lo[2]) + 1.0);
+            if (rows * (std::log2(static_cast<double>(cellCount)) + 1.0) >= static_cast<double>(cellCount))
+            {
+                for (size_t cell = 0; cell < cellCount; ++cell)
+                {
+                    const uint64_t key = m_CellKey[cell];
+                    const uint32_t rx = static_cast<uint32_t>(key & m_MaskX);
+                    const uint32_t ry = static_cast<uint32_t>((key >> m_ShiftY) & m_MaskY);
+                    const uint32_t rz = static_cast<uint32_t>(key >> m_ShiftZ);
+                    if (rx >= lo[0] && rx <= hi[0] && ry >= lo[1] && ry <= hi[1] && rz >= lo[2] && rz <= hi[2])
+                        visit(cell, rx, ry, rz);
+                }
+                return;
+            }
+
+            // Rows come in key order, so each search starts where the last one ended.
+            auto cursor = m_CellKey.begin();
+            for (uint32_t rz = lo[2]; rz <= hi[2]; ++rz)
+            {
+                for (uint32_t ry = lo[1]; ry <= hi[1]; ++ry)
+                {
+                    if (frustum)
+                    {
+                        float rowMin[3];
+                        float rowMax[3];
+                        float unused[3];
+                        CellBox(lo[0], ry, rz, rowMin, unused);
+                        CellBox(hi[0], ry, rz, unused, rowMax);
+                        if (!frustum->IntersectsBox(rowMin, rowMax))
+                            continue;
+                    }
+
+                    const uint64_t last = Key(hi[0], ry, rz);
+                    cursor = std::lower_bound(cursor, m_CellKey.end(), Key(lo[0], ry, rz));
+                    for (; cursor != m_CellKey.end() && *cursor <= last; ++cursor)
+                    {
+                        const size_t cell = static_cast<size_t>(cursor - m_CellKey.begin());
+                        visit(cell, static_cast<uint32_t>(*cursor & m_MaskX), ry, rz);
+                    }
+                }
+            }
+        }
+
+        float m_CellSize = 1.0f;
+        float m_InvCellSize = 1.0f;
+        float m_CellMargin = 0.0f;
+        size_t m_Count = 0;
+        size_t m_Inserted = 0;
+        size_t m_DeadSlots = 0;
+        float m_BoundsMin[3]{};
+        float m_BoundsMax[3]{};
+
+        // Key layout: relative cell coordinates packed z | y | x, each as wide as its range.
+        int32_t m_CellMin[3]{};
+        int32_t m_CellMax[3]{};
+        unsigned m_ShiftY = 0;
+        unsigned m_ShiftZ = 0;
+        uint64_t m_MaskX = 0;
+        uint64_t m_MaskY = 0;
+
+        std::vector<float> m_X, m_Y, m_Z;     // by id
+        std::vector<uint64_t> m_CellKey;      // occupied cells, ascending
+        std::vector<uint32_t> m_CellStart;    // first slot per cell, plus the end
+        std::vector<Entry> m_Entries;         // by slot
+        std::vector<uint32_t> m_Slot;         // slot per id, kNone when not in the table
+        std::vector<uint32_t> m_Loose;        // indexed ids outside the table
+        std::vector<uint32_t> m_LoosePos;     // index into m_Loose per id, kNone when not loose
+
+        // Sort buffers, kept between builds.
+        std::vector<uint64_t> m_SortKeys, m_SortKeysSwap;
+        std::vector<uint32_t> m_SortIds, m_SortIdsSwap;
+        std::vector<uint32_t> m_DenseCounts;
+    };
+}
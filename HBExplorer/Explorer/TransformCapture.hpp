@@ -0,0 +1,197 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Bitset.hpp"
+
+namespace UExplorer
+{
+    // World-space pose of one transform as read from the runtime.
+    struct TransformSample
+    {
+        float position[3]{};
+        float rotation[4]{ 0.0f, 0.0f, 0.0f, 1.0f }; // x, y, z, w
+        float scale[3]{ 1.0f, 1.0f, 1.0f };
+    };
+
+    // Struct-of-arrays pose snapshot over object ids. A sweep walks every id once, possibly
+    // spread over several frames by a time budget; the change mask is published when a sweep
+    // completes, so consumers can update incrementally by watching sweepCount.
+    class TransformCapture
+    {
+    public:
+        static constexpr uint32_t kBudgetCheckInterval = 64; // items between clock reads
+
+        struct Stats
+        {
+            uint64_t sweepCount = 0;       // completed sweeps since the last Reset
+            size_t capturedLastFrame = 0;
+            size_t changedLastSweep = 0;
+            size_t failedLastSweep = 0;
+            double microsLastFrame = 0.0;
+            double microsLastSweep = 0.0;
+        };
+
+        // Component arrays, one slot per object id.
+        std::vector<float> px, py, pz;
+        std::vector<float> rx, ry, rz, rw;
+        std::vector<float> sx, sy, sz;
+        Bitset valid;   // slot holds a sample from some sweep
+        Bitset changed; // differed from the previous sweep, as of the last completed sweep
+
+        float positionEpsilon = 1e-4f;
+        float rotationEpsilon = 1e-5f;
+        float scaleEpsilon = 1e-5f;
+
+        // Start a new sweep only every Nth Step call; 1 captures continuously.
+        uint32_t frameInterval = 1;
+
+        void Reset(size_t count)
+        {
+            m_Count = count;
+            for (std::vector<float>* column : { &px, &py, &pz, &sx, &sy, &sz, &rx, &ry, &rz })
+                column->assign(count, 0.0f);
+            rw.assign(count, 1.0f);
+
+            valid.Resize(count);
+            changed.Resize(count);
+            m_Pending.Resize(count);
+            m_Cursor = 0;
+            m_FramesSinceSweep = 0;
+            m_SweepChanged = 0;
+            m_SweepFailed = 0;
+            m_SweepMicros = 0.0;
+            m_Stats = {};
+        }
+
+        // read(id, TransformSample*) -> bool; false leaves the slot invalid. Returns true when
+        // this call completed a sweep. budgetMicros == 0 captures the whole sweep in one call.
+        template<typename ReadFn>
+        bool Step(ReadFn&& read, uint32_t budgetMicros)
+        {
+            m_Stats.capturedLastFrame = 0;
+            m_Stats.microsLastFrame = 0.0;
+            if (m_Count == 0)
+                return false;
+
+            if (m_Cursor == 0)
+            {
+                if (++m_FramesSinceSweep < std::max<uint32_t>(frameInterval, 1U))
+                    return false;
+                m_FramesSinceSweep = 0;
+            }
+
+            using Clock = std::chrono::steady_clock;
+            const Clock::time_point start = Clock::now();
+            const Clock::time_point deadline = start + std::chrono::microseconds(budgetMicros);
+
+            size_t captured = 0;
+            TransformSample sample{};
+            while (m_Cursor < m_Count)
+            {
+                const size_t id = m_Cursor++;
+                if (read(static_cast<uint32_t>(id), &sample))
+                    Store(id, sample);
+                else
+                    Invalidate(id);
+
+                ++captured;
+                if (budgetMicros && (captured % kBudgetCheckInterval) == 0 && Clock::now() >= deadline)
+                    break;
+            }
+
+            const double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+            m_Stats.capturedLastFrame = captured;
+            m_Stats.microsLastFrame = micros;
+            m_SweepMicros += micros;
+
+            if (m_Cursor < m_Count)
+                return false;
+
+            std::swap(changed, m_Pending);
+            m_Pending.Resize(m_Count);
+            m_Stats.changedLastSweep = m_SweepChanged;
+            m_Stats.failedLastSweep = m_SweepFailed;
+            m_Stats.microsLastSweep = m_SweepMicros;
+            ++m_Stats.sweepCount;
+
+            m_Cursor = 0;
+            m_SweepChanged = 0;
+            m_SweepFailed = 0;
+            m_SweepMicros = 0.0;
+            return true;
+        }
+
+        TransformSample Sample(uint32_t id) const
+        {
+            TransformSample sample{};
+            sample.position[0] = px[id]; sample.position[1] = py[id]; sample.position[2] = pz[id];
+            sample.rotation[0] = rx[id]; sample.rotation[1] = ry[id]; sample.rotation[2] = rz[id]; sample.rotation[3] = rw[id];
+            sample.scale[0] = sx[id]; sample.scale[1] = sy[id]; sample.scale[2] = sz[id];
+            return sample;
+        }
+
+        size_t Size() const { return m_Count; }
+        size_t Cursor() const { return m_Cursor; }
+        const Stats& GetStats() const { return m_Stats; }
+
+    private:
+        static bool Moved(float before, float after, float epsilon)
+        {
+            return std::fabs(after - before) > epsilon;
+        }
+
+        void Store(size_t id, const TransformSample& sample)
+        {
+            bool differs = !valid.Test(id);
+            if (!differs)
+            {
+                differs = Moved(px[id], sample.position[0], positionEpsilon)
+                    || Moved(py[id], sample.position[1], positionEpsilon)
+                    || Moved(pz[id], sample.position[2], positionEpsilon)
+                    || Moved(rx[id], sample.rotation[0], rotationEpsilon)
+                    || Moved(ry[id], sample.rotation[1], rotationEpsilon)
+                    || Moved(rz[id], sample.rotation[2], rotationEpsilon)
+                    || Moved(rw[id], sample.rotation[3], rotationEpsilon)
+                    || Moved(sx[id], sample.scale[0], scaleEpsilon)
+                    || Moved(sy[id], sample.scale[1], scaleEpsilon)
+                    || Moved(sz[id], sample.scale[2], scaleEpsilon);
+            }
+
+            if (!differs)
+                return;
+
+            px[id] = sample.position[0]; py[id] = sample.position[1]; pz[id] = sample.position[2];
+            rx[id] = sample.rotation[0]; ry[id] = sample.rotation[1]; rz[id] = sample.rotation[2]; rw[id] = sample.rotation[3];
+            sx[id] = sample.scale[0]; sy[id] = sample.scale[1]; sz[id] = sample.scale[2];
+            valid.Set(id);
+            m_Pending.Set(id);
+            ++m_SweepChanged;
+        }
+
+        void Invalidate(size_t id)
+        {
+            ++m_SweepFailed;
+            if (!valid.Test(id))
+                return;
+
+            valid.Reset(id);
+            m_Pending.Set(id);
+            ++m_SweepChanged;
+        }
+
+        size_t m_Count = 0;
+        size_t m_Cursor = 0;
+        uint32_t m_FramesSinceSweep = 0;
+        size_t m_SweepChanged = 0;
+        size_t m_SweepFailed = 0;
+        double m_SweepMicros = 0.0;
+        Bitset m_Pending;
+        Stats m_Stats;
+    };
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Bitset.hpp"
+
+namespace UExplorer
+{
+    // Inverted index from an opaque type key to the ascending ids of the objects that carry
+    // that type. Keys and their labels are interned once and survive ClearPostings, so a
+    // rebuild only has to re-add ids.
+    struct TypeIndex
+    {
+        struct Entry
+        {
+            const void* key = nullptr;
+            std::string labelLower;
+            std::vector<uint32_t> ids;
+        };
+
+        std::vector<Entry> entries;
+        std::unordered_map<const void*, uint32_t> slotByKey;
+
+        void ClearPostings()
+        {
+            for (Entry& entry : entries)
+                entry.ids.clear();
+        }
+
+        uint32_t Find(const void* key) const
+        {
+            auto it = slotByKey.find(key);
+            return (it != slotByKey.end()) ? it->second : 0xFFFFFFFFU;
+        }
+
+        template<typename MakeLabel>
+        uint32_t Intern(const void* key, MakeLabel&& makeLabel)
+        {
+            auto it = slotByKey.find(key);
+            if (it != slotByKey.end())
+                return it->second;
+
+            const uint32_t slot = static_cast<uint32_t>(entries.size());
+            Entry entry{};
+            entry.key = key;
+            entry.labelLower = makeLabel();
+            entries.emplace_back(std::move(entry));
+            slotByKey.emplace(key, slot);
+            return slot;
+        }
+
+        // Ids must be added in ascending order within one build.
+        void Add(uint32_t slot, uint32_t id)
+        {
+            std::vector<uint32_t>& ids = entries[slot].ids;
+            if (ids.empty() || ids.back() != id)
+                ids.emplace_back(id);
+        }
+
+        // Adds one id outside a build, keeping the list ascending.
+        void Insert(uint32_t slot, uint32_t id)
+        {
+            std::vector<uint32_t>& ids = entries[slot].ids;
+            auto it = std::lower_bound(ids.begin(), ids.end(), id);
+            if (it == ids.end() || *it != id)
+                ids.insert(it, id);
+        }
+
+        // Drops one id outside a build.
+        void Remove(uint32_t slot, uint32_t id)
+        {
+            std::vector<uint32_t>& ids = entries[slot].ids;
+            auto it = std::lower_bound(ids.begin(), ids.end(), id);
+            if (it != ids.end() && *it == id)
+                ids.erase(it);
+        }
+
+        // Marks the ids carrying any type whose label contains needleLower.
+        void QueryLabelBitset(std::string_view needleLower, size_t idCount, Bitset* outHits) const
+        {
+            outHits->Resize(idCount);
+            for (const Entry& entry : entries)
+            {
+                if (entry.ids.empty() || entry.labelLower.find(needleLower) == std::string::npos)
+                    continue;
+
+                for (uint32_t id : entry.ids)
+                {
+                    if (id < idCount)
+                        outHits->Set(id);
+                }
+            }
+        }
+    };
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ParallelFor.hpp"
+
+#if defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UEXPLORER_SCAN_SSE2 1
+#endif
+
+namespace UExplorer
+{
+    enum class ScanCompare : uint8_t
+    {
+        Exact,     // |value - a| <= epsilon
+        Range,     // a <= value <= b
+        Changed,   // differs from the previous scan
+        Unchanged,
+        Increased,
+        Decreased,
+        Any        // keeps every readable candidate; seeds a changed/unchanged hunt
+    };
+
+    struct ScanPredicate
+    {
+        ScanCompare compare = ScanCompare::Exact;
+        double a = 0.0;
+        double b = 0.0;
+        double epsilon = 0.0;
+    };
+
+    inline bool ScanCompareNeedsPrevious(ScanCompare compare)
+    {
+        return compare == ScanCompare::Changed || compare == ScanCompare::Unchanged
+            || compare == ScanCompare::Increased || compare == ScanCompare::Decreased;
+    }
+
+    // keep[i] = predicate(current[i], previous[i]). Values are widened to double so one kernel
+    // serves every primitive type; 64-bit integers above 2^53 compare approximately.
+    inline void FilterScanColumn(const double* current, const double* previous, size_t count, const ScanPredicate& predicate, uint8_t* keep)
+    {
+        double lo = predicate.a;
+        double hi = predicate.b;
+        if (predicate.compare == ScanCompare::Exact)
+        {
+            lo = predicate.a - predicate.epsilon;
+            hi = predicate.a + predicate.epsilon;
+        }
+
+        size_t i = 0;
+#ifdef UEXPLORER_SCAN_SSE2
+        const __m128d vlo = _mm_set1_pd(lo);
+        const __m128d vhi = _mm_set1_pd(hi);
+        for (; i + 2 <= count; i += 2)
+        {
+            const __m128d value = _mm_loadu_pd(current + i);
+            __m128d mask;
+            switch (predicate.compare)
+            {
+            case ScanCompare::Exact:
+            case ScanCompare::Range:
+                mask = _mm_and_pd(_mm_cmpge_pd(value, vlo), _mm_cmple_pd(value, vhi));
+                break;
+            case ScanCompare::Changed:
+                mask = _mm_cmpneq_pd(value, _mm_loadu_pd(previous + i));
+                break;
+            case ScanCompare::Unchanged:
+                mask = _mm_cmpeq_pd(value, _mm_loadu_pd(previous + i));
+                break;
+            case ScanCompare::Increased:
+                mask = _mm_cmpgt_pd(value, _mm_loadu_pd(previous + i));
+                break;
+            case ScanCompare::Decreased:
+                mask = _mm_cmplt_pd(value, _mm_loadu_pd(previous + i));
+                break;
+            default:
+                mask = _mm_cmpeq_pd(value, value); // any non-NaN
+                break;
+            }
+
+            const int bits = _mm_movemask_pd(mask);
+            keep[i] = static_cast<uint8_t>(bits & 1);
+            keep[i + 1] = static_cast<uint8_t>((bits >> 1) & 1);
+        }
+#endif
+
+        for (; i < count; ++i)
+        {
+            const double value = current[i];
+            bool match = false;
+            switch (predicate.compare)
+            {
+            case ScanCompare::Exact:
+            case ScanCompare::Range: match = value >= lo && value <= hi; break;
+            case ScanCompare::Changed: match = value != previous[i]; break;
+            case ScanCompare::Unchanged: match = value == previous[i]; break;
+            case ScanCompare::Increased: match = value > previous[i]; break;
+            case ScanCompare::Decreased: match = value < previous[i]; break;
+            default: match = value == value; break;
+            }
+            keep[i] = match ? 1 : 0;
+        }
+    }
+
+    // Candidate set of (instance, field) pairs with their last-read values, narrowed in place by
+    // each rescan. The caller owns what instance and field indices mean; the scanner only gathers
+    // through the callback, filters and compacts.
+    class ValueScanner
+    {
+    public:
+        static constexpr size_t kMinChunk = 4096; // candidates per worker before threading pays off
+
+        struct Stats
+        {
+            size_t scanned = 0;
+            size_t kept = 0;
+            size_t unreadable = 0;
+            uint32_t threads = 0;
+            double gatherMs = 0.0; // wall time of the parallel gather + filter
+            double totalMs = 0.0;
+        };
+
+        std::vector<uint32_t> instances;
+        std::vector<uint16_t> fields;
+        std::vector<double> values; // as of the last scan
+
+        void Clear()
+        {
+            instances.clear();
+            fields.clear();
+            values.clear();
+            m_HasValues = false;
+            m_Stats = {};
+        }
+
+        void Add(uint32_t instance, uint16_t field)
+        {
+            instances.emplace_back(instance);
+            fields.emplace_back(field);
+        }
+
+        size_t Size() const { return instances.size(); }
+        bool HasValues() const { return m_HasValues; }
+        const Stats& GetStats() const { return m_Stats; }
+
+        // gather(instance, field, double*) -> bool must be safe to call from several threads.
+        // Unreadable candidates are dropped. Previous-value predicates need a prior scan.
+        template<typename GatherFn>
+        bool Scan(GatherFn&& gather, const ScanPredicate& predicate, uint32_t maxThreads)
+        {
+            if (ScanCompareNeedsPrevious(predicate.compare) && !m_HasValues)
+                return false;
+
+            using Clock = std::chrono::steady_clock;
+            const Clock::time_point start = Clock::now();
+            const size_t count = instances.size();
+            if (values.size() != count)
+                values.assign(count, 0.0);
+
+            m_Current.resize(count);
+            m_Keep.resize(count);
+
+            const uint32_t workers = ParallelWorkerCount(count, maxThreads, kMinChunk);
+            std::vector<size_t> unreadable(workers, 0);
+
+            ParallelFor(count, workers, [&](uint32_t worker, size_t begin, size_t end)
+                {
+                    size_t failed = 0;
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        if (!gather(instances[i], fields[i], &m_Current[i]))
+                        {
+                            m_Current[i] = std::nan("");
+                            ++failed;
+                        }
+                    }
+
+                    FilterScanColumn(m_Current.data() + begin, values.data() + begin, end - begin, predicate, m_Keep.data() + begin);
+                    for (size_t i = begin; i < end; ++i)
+                        m_Keep[i] &= static_cast<uint8_t>(m_Current[i] == m_Current[i]);
+                    unreadable[worker] = failed;
+                });
+
+            const Clock::time_point gathered = Clock::now();
+
+            size_t kept = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!m_Keep[i])
+                    continue;
+
+                instances[kept] = instances[i];
+                fields[kept] = fields[i];
+                values[kept] = m_Current[i];
+                ++kept;
+            }
+            instances.resize(kept);
+            fields.resize(kept);
+            values.resize(kept);
+            m_HasValues = true;
+
+            m_Stats.scanned = count;
+            m_Stats.kept = kept;
+            m_Stats.unreadable = 0;
+            for (size_t failed : unreadable)
+                m_Stats.unreadable += failed;
+            m_Stats.threads = workers;
+            m_Stats.gatherMs = std::chrono::duration<double, std::milli>(gathered - start).count();
+            m_Stats.totalMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+            return true;
+        }
+
+    private:
+        std::vector<double> m_Current;
+        std::vector<uint8_t> m_Keep;
+        bool m_HasValues = false;
+        Stats m_Stats;
+    };
+}
@@ -0,0 +1,368 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace UExplorer
+{
+    enum class WatchValueKind : uint8_t
+    {
+        Bool,
+        I8,
+        U8,
+        I16,
+        U16,
+        I32,
+        U32,
+        I64,
+        U64,
+        F32,
+        F64
+    };
+
+    static constexpr uint32_t kMaxWatchHops = 4;
+
+    // One resolved watch expression. offsets[i] is added to the current address; every hop but
+    // the last then dereferences a managed reference, so "a.b.c" with reference-typed a and b is
+    // three offsets. Value-type intermediates are folded into the next offset when resolving.
+    struct WatchProbe
+    {
+        uintptr_t base = 0; // managed object the path starts at
+        int32_t offsets[kMaxWatchHops]{};
+        uint8_t hopCount = 0;
+        WatchValueKind kind = WatchValueKind::F32;
+        uint16_t ring = 0;
+    };
+
+    // Follows a probe to the address of its value; 0 when an intermediate reference is null.
+    // Reads raw memory, so callers on the runtime side wrap it in a fault guard.
+    inline uintptr_t ResolveWatchAddress(const WatchProbe& probe)
+    {
+        uintptr_t address = probe.base;
+        for (uint32_t hop = 0; hop + 1 < probe.hopCount; ++hop)
+        {
+            address = *reinterpret_cast<const uintptr_t*>(address + static_cast<intptr_t>(probe.offsets[hop]));
+            if (!address)
+                return 0;
+        }
+        return address + static_cast<intptr_t>(probe.offsets[probe.hopCount - 1]);
+    }
+
+    inline double LoadWatchValue(uintptr_t address, WatchValueKind kind)
+    {
+        const void* p = reinterpret_cast<const void*>(address);
+        switch (kind)
+        {
+        case WatchValueKind::Bool: return *static_cast<const uint8_t*>(p) ? 1.0 : 0.0;
+        case WatchValueKind::I8: return static_cast<double>(*static_cast<const int8_t*>(p));
+        case WatchValueKind::U8: return static_cast<double>(*static_cast<const uint8_t*>(p));
+        case WatchValueKind::I16: return static_cast<double>(*static_cast<const int16_t*>(p));
+        case WatchValueKind::U16: return static_cast<double>(*static_cast<const uint16_t*>(p));
+        case WatchValueKind::I32: return static_cast<double>(*static_cast<const int32_t*>(p));
+        case WatchValueKind::U32: return static_cast<double>(*static_cast<const uint32_t*>(p));
+        case WatchValueKind::I64: return static_cast<double>(*static_cast<const int64_t*>(p));
+        case WatchValueKind::U64: return static_cast<double>(*static_cast<const uint64_t*>(p));
+        case WatchValueKind::F32: return static_cast<double>(*static_cast<const float*>(p));
+        case WatchValueKind::F64: return *static_cast<const double*>(p);
+        }
+        return 0.0;
+    }
+
+    struct WatchSummary
+    {
+        size_t count = 0;
+        float minimum = 0.0f;
+        float maximum = 0.0f;
+        float average = 0.0f;
+    };
+
+    inline WatchSummary SummarizeWatchHistory(const float* values, size_t count)
+    {
+        WatchSummary summary{};
+        if (!values || count == 0)
+            return summary;
+
+        float minimum = values[0];
+        float maximum = values[0];
+        double sum = 0.0;
+        for (size_t i = 0; i < count; ++i)
+        {
+            minimum = std::min(minimum, values[i]);
+            maximum = std::max(maximum, values[i]);
+            sum += values[i];
+        }
+
+        summary.count = count;
+        summary.minimum = minimum;
+        summary.maximum = maximum;
+        summary.average = static_cast<float>(sum / static_cast<double>(count));
+        return summary;
+    }
+
+    // Fixed-capacity sample history written by exactly one thread. The writer fills a slot and
+    // then publishes the running count; readers copy without locking and discard any slot the
+    // writer may have lapped while they were copying.
+    class SampleRing
+    {
+    public:
+        static constexpr uint32_t kCapacity = 256;
+
+        void Push(float value)
+        {
+            const uint32_t count = m_Count.load(std::memory_order_relaxed);
+            m_Values[count % kCapacity].store(value, std::memory_order_relaxed);
+            m_Count.store(count + 1, std::memory_order_release);
+        }
+
+        void MarkFailed()
+        {
+            m_Failures.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        // Copies the newest samples oldest-first into out (kCapacity slots); returns how many.
+        size_t Copy(float* out) const
+        {
+            const uint32_t end = m_Count.load(std::memory_order_acquire);
+            uint32_t begin = end > kCapacity ? end - kCapacity : 0;
+            for (uint32_t i = begin; i != end; ++i)
+                out[i - begin] = m_Values[i % kCapacity].load(std::memory_order_relaxed);
+
+            // Slots older than (now - capacity) may have been overwritten mid-copy.
+            const uint32_t now = m_Count.load(std::memory_order_acquire);
+            const uint32_t safeBegin = now > kCapacity ? now - kCapacity : 0;
+            if (safeBegin > begin)
+            {
+                const uint32_t lapped = std::min(safeBegin, end) - begin;
+                std::memmove(out, out + lapped, (end - begin - lapped) * sizeof(float));
+                begin += lapped;
+            }
+            return end - begin;
+        }
+
+        uint32_t TotalSamples() const { return m_Count.load(std::memory_order_acquire); }
+        uint32_t Failures() const { return m_Failures.load(std::memory_order_relaxed); }
+
+        // Only valid while no published plan references this ring.
+        void Clear()
+        {
+            m_Count.store(0, std::memory_order_relaxed);
+            m_Failures.store(0, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<uint32_t> m_Count{ 0 };
+        std::atomic<uint32_t> m_Failures{ 0 };
+        std::atomic<float> m_Values[kCapacity]{};
+    };
+
+    // Hands watch probes from the UI thread to a sampling thread (the game's update callback)
+    // and sample history back, without locks. The UI publishes immutable plans; the sampler
+    // reports which plan generation it last picked up, and plans or rings are only reclaimed
+    // once the sampler has moved past them.
+    class WatchSampler
+    {
+    public:
+        static constexpr uint32_t kMaxWatches = 1024;
+
+        struct Plan
+        {
+            uint64_t generation = 0;
+            std::vector<WatchProbe> probes; // sorted by base, then first offset
+        };
+
+        struct Stats
+        {
+            uint64_t ticks = 0;
+            uint32_t probesLastTick = 0;
+            uint32_t failedLastTick = 0;
+            double microsLastTick = 0.0;
+            double microsPeak = 0.0;
+        };
+
+        WatchSampler()
+            : m_Rings(new SampleRing[kMaxWatches])
+        {
+            m_FreeRings.reserve(kMaxWatches);
+            for (uint32_t ring = kMaxWatches; ring-- > 0;)
+                m_FreeRings.emplace_back(static_cast<uint16_t>(ring));
+        }
+
+        ~WatchSampler()
+        {
+            delete m_Plan.load(std::memory_order_acquire);
+            for (Plan* plan : m_RetiredPlans)
+                delete plan;
+        }
+
+        WatchSampler(const WatchSampler&) = delete;
+        WatchSampler& operator=(const WatchSampler&) = delete;
+
+        // ---- UI thread ----
+
+        bool AcquireRing(uint16_t* outRing)
+        {
+            Reclaim();
+            if (m_FreeRings.empty())
+                return false;
+
+            *outRing = m_FreeRings.back();
+            m_FreeRings.pop_back();
+            m_Rings[*outRing].Clear();
+            return true;
+        }
+
+        // The ring stays reserved until the sampler has seen a plan published after this call.
+        void ReleaseRing(uint16_t ring)
+        {
+            m_RetiredRings.push_back({ m_NextGeneration, ring });
+        }
+
+        void Publish(std::vector<WatchProbe> probes)
+        {
+            std::sort(probes.begin(), probes.end(), [](const WatchProbe& lhs, const WatchProbe& rhs)
+                {
+                    if (lhs.base != rhs.base)
+                        return lhs.base < rhs.base;
+                    return lhs.offsets[0] < rhs.offsets[0];
+                });
+
+            Plan* plan = new Plan();
+            plan->generation = m_NextGeneration++;
+            plan->probes = std::move(probes);
+
+            Plan* previous = m_Plan.exchange(plan, std::memory_order_acq_rel);
+            if (previous)
+                m_RetiredPlans.push_back(previous);
+            Reclaim();
+        }
+
+        void SetIntervalMicros(uint32_t micros)
+        {
+            m_IntervalMicros.store(micros, std::memory_order_relaxed);
+        }
+
+        const SampleRing& Ring(uint16_t ring) const { return m_Rings[ring]; }
+
+        Stats GetStats() const
+        {
+            Stats stats{};
+            stats.ticks = m_Ticks.load(std::memory_order_relaxed);
+            stats.probesLastTick = m_ProbesLastTick.load(std::memory_order_relaxed);
+            stats.failedLastTick = m_FailedLastTick.load(std::memory_order_relaxed);
+            stats.microsLastTick = m_MicrosLastTick.load(std::memory_order_relaxed);
+            stats.microsPeak = m_MicrosPeak.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+        void ResetPeak()
+        {
+            m_MicrosPeak.store(0.0, std::memory_order_relaxed);
+        }
+
+        // ---- sampling thread ----
+
+        // read(const WatchProbe&, double*) -> bool. Runs the current plan if the interval has
+        // elapsed; returns false when nothing was due.
+        template<typename ReadFn>
+        bool Tick(ReadFn&& read)
+        {
+            const Plan* plan = m_Plan.load(std::memory_order_acquire);
+            if (!plan)
+                return false;
+
+            using Clock = std::chrono::steady_clock;
+            const Clock::time_point start = Clock::now();
+            const uint32_t interval = m_IntervalMicros.load(std::memory_order_relaxed);
+            if (m_HasTicked && start - m_LastTick < std::chrono::microseconds(interval))
+                return false;
+            m_HasTicked = true;
+            m_LastTick = start;
+
+            // Published after the plan load: the UI only frees plans older than this.
+            m_SeenGeneration.store(plan->generation, std::memory_order_release);
+
+            const WatchProbe* probes = plan->probes.data();
+            const size_t probeCount = plan->probes.size();
+            uint32_t failed = 0;
+            for (size_t i = 0; i < probeCount; ++i)
+            {
+                double value = 0.0;
+                if (read(probes[i], &value) && std::isfinite(value))
+                {
+                    m_Rings[probes[i].ring].Push(static_cast<float>(value));
+                }
+                else
+                {
+                    m_Rings[probes[i].ring].MarkFailed();
+                    ++failed;
+                }
+            }
+
+            const double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+            m_ProbesLastTick.store(static_cast<uint32_t>(probeCount), std::memory_order_relaxed);
+            m_FailedLastTick.store(failed, std::memory_order_relaxed);
+            m_MicrosLastTick.store(micros, std::memory_order_relaxed);
+            if (micros > m_MicrosPeak.load(std::memory_order_relaxed))
+                m_MicrosPeak.store(micros, std::memory_order_relaxed);
+            m_Ticks.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+    private:
+        struct RetiredRing
+        {
+            uint64_t generation = 0; // first plan generation that no longer references the ring
+            uint16_t ring = 0;
+        };
+
+        void Reclaim()
+        {
+            const uint64_t seen = m_SeenGeneration.load(std::memory_order_acquire);
+
+            m_RetiredPlans.erase(std::remove_if(m_RetiredPlans.begin(), m_RetiredPlans.end(), [&](Plan* plan)
+                {
+                    if (plan->generation >= seen)
+                        return false;
+                    delete plan;
+                    return true;
+                }), m_RetiredPlans.end());
+
+            m_RetiredRings.erase(std::remove_if(m_RetiredRings.begin(), m_RetiredRings.end(), [&](const RetiredRing& retired)
+                {
+                    if (retired.generation > seen)
+                        return false;
+                    m_FreeRings.emplace_back(retired.ring);
+                    return true;
+                }), m_RetiredRings.end());
+        }
+
+        std::unique_ptr<SampleRing[]> m_Rings;
+
+        // UI-thread bookkeeping.
+        std::vector<uint16_t> m_FreeRings;
+        std::vector<RetiredRing> m_RetiredRings;
+        std::vector<Plan*> m_RetiredPlans;
+        uint64_t m_NextGeneration = 1;
+
+        // Shared.
+        alignas(64) std::atomic<Plan*> m_Plan{ nullptr };
+        std::atomic<uint64_t> m_SeenGeneration{ 0 };
+        std::atomic<uint32_t> m_IntervalMicros{ 0 };
+
+        // Sampling-thread state and published stats.
+        alignas(64) std::chrono::steady_clock::time_point m_LastTick{};
+        bool m_HasTicked = false;
+        std::atomic<uint64_t> m_Ticks{ 0 };
+        std::atomic<uint32_t> m_ProbesLastTick{ 0 };
+        std::atomic<uint32_t> m_FailedLastTick{ 0 };
+        std::atomic<double> m_MicrosLastTick{ 0.0 };
+        std::atomic<double> m_MicrosPeak{ 0.0 };
+    };
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace UExplorer
+{
+    // Generation-tagged 32-bit handle: the low bits pick a slot, the high bits must match the
+    // slot's generation. Reusing a slot bumps its generation, so stale handles fail cheaply.
+    // Zero is never a valid handle.
+    using ObjectHandle = uint32_t;
+
+    // Slot storage for weak object references. Creating and freeing the runtime's GC handles
+    // and testing the target for liveness are left to the caller; the table only maps handles
+    // to slots in one array load plus a generation compare.
+    struct WeakHandleTable
+    {
+        static constexpr uint32_t kIndexBits = 20;
+        static constexpr uint32_t kIndexMask = (1U << kIndexBits) - 1U;
+        static constexpr uint32_t kGenerationMask = (1U << (32U - kIndexBits)) - 1U;
+
+        struct Slot
+        {
+            const void* object = nullptr; // pointer at acquire time, for dedupe and fallback
+            uint32_t gcHandle = 0;        // 0 when the runtime offers no weak handles
+            uint32_t generation = 1;
+            bool used = false;
+            const void* target = nullptr; // last answer from the caller's resolver
+            int targetFrame = -1;         // frame that answer belongs to
+        };
+
+        std::vector<Slot> slots;
+        std::vector<uint32_t> freeSlots;
+        std::unordered_map<const void*, ObjectHandle> handleByObject;
+
+        const Slot* Get(ObjectHandle handle) const
+        {
+            const uint32_t index = handle & kIndexMask;
+            if (handle == 0 || index >= slots.size())
+                return nullptr;
+
+            const Slot& slot = slots[index];
+            return (slot.used && slot.generation == (handle >> kIndexBits)) ? &slot : nullptr;
+        }
+
+        ObjectHandle Find(const void* object) const
+        {
+            auto it = handleByObject.find(object);
+            return (it != handleByObject.end()) ? it->second : 0;
+        }
+
+        // Returns 0 when all slots are in use.
+        ObjectHandle Add(const void* object, uint32_t gcHandle)
+        {
+            uint32_t index = 0;
+            if (!freeSlots.empty())
+            {
+                index = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            else
+            {
+                if (slots.size() > kIndexMask)
+                    return 0;
+
+                index = static_cast<uint32_t>(slots.size());
+                slots.emplace_back();
+            }
+
+            Slot& slot = slots[index];
+            slot.object = object;
+            slot.gcHandle = gcHandle;
+            slot.used = true;
+            slot.targetFrame = -1;
+
+            const ObjectHandle handle = (slot.generation << kIndexBits) | index;
+            handleByObject[object] = handle;
+            return handle;
+        }
+
+        // resolve(slot) -> const void* is asked at most once per frame per handle; a handle shown
+        // in several places in one frame reuses that answer.
+        template<typename Resolve>
+        const void* Target(ObjectHandle handle, int frame, Resolve&& resolve)
+        {
+            if (!Get(handle))
+                return nullptr;
+
+            Slot& slot = slots[handle & kIndexMask];
+            if (slot.targetFrame != frame)
+            {
+                slot.target = resolve(static_cast<const Slot&>(slot));
+                slot.targetFrame = frame;
+            }
+
+            return slot.target;
+        }
+
+        // Frees the slot and returns the GC handle the caller must release (0 if none).
+        uint32_t Remove(ObjectHandle handle)
+        {
+            const Slot* found = Get(handle);
+            if (!found)
+                return 0;
+
+            const uint32_t index = handle & kIndexMask;
+            Slot& slot = slots[index];
+            const uint32_t gcHandle = slot.gcHandle;
+
+            auto it = handleByObject.find(slot.object);
+            if (it != handleByObject.end() && it->second == handle)
+                handleByObject.erase(it);
+
+            slot.object = nullptr;
+            slot.gcHandle = 0;
+            slot.used = false;
+
+            // Generations skip 0 so no live handle can ever equal the null handle.
+            slot.generation = (slot.generation & kGenerationMask) == kGenerationMask ? 1U : slot.generation + 1U;
+            freeSlots.emplace_back(index);
+            return gcHandle;
+        }
+
+        template<typename Fn>
+        void ForEachHandle(Fn&& fn) const
+        {
+            for (size_t index = 0; index < slots.size(); ++index)
+            {
+                const Slot& slot = slots[index];
+                if (slot.used)
+                    fn((slot.generation << kIndexBits) | static_cast<uint32_t>(index), slot);
+            }
+        }
+    };
+}
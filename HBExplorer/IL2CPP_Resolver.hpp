@@ -69,6 +69,7 @@
 #include "API/ResolveCall.hpp"
 #include "API/String.hpp"
 #include "API/Thread.hpp"
+#include "API/GCHandle.hpp"
 
 // IL2CPP Headers before Unity API
 #include "SystemTypeCache.hpp"
@@ -417,6 +418,9 @@ namespace IL2CPP
 			resolveOptional(&Functions.m_ClassFromIl2cppType, { IL2CPP_CLASS_FROM_IL2CPP_TYPE, IL2CPP_RStr("il2cpp_class_from_type") });
 			resolveOptional(&Functions.m_FieldStaticGetValue, { IL2CPP_FIELD_STATIC_GET_VALUE });
 			resolveOptional(&Functions.m_FieldStaticSetValue, { IL2CPP_FIELD_STATIC_SET_VALUE });
+			resolveOptional(&Functions.m_GCHandleNewWeakRef, { IL2CPP_GCHANDLE_NEW_WEAKREF });
+			resolveOptional(&Functions.m_GCHandleGetTarget, { IL2CPP_GCHANDLE_GET_TARGET });
+			resolveOptional(&Functions.m_GCHandleFree, { IL2CPP_GCHANDLE_FREE });
 
 			// Unity APIs
 			Unity::Camera::Initialize();
@@ -7,12 +7,98 @@ namespace UExplorer
         bool loaded = false;
         bool readFailed = false;
         uintptr_t pointerValue = 0;
+        ObjectHandle handle = 0; // weak handle to the value read, 0 if the table was full
+    };
+
+    // Everything the inspector shows about a field that cannot change at runtime.
+    struct FieldLayout
+    {
+        Unity::il2cppFieldInfo* field = nullptr;
+        Unity::il2cppClass* declaringClass = nullptr;
+        int offset = 0;
+        bool isStatic = false;
+        unsigned int typeEnum = 0;
+        std::string name;   // sanitized, with a field_<ptr> fallback
+        std::string header; // "<type> <name> [static|instance]"
+    };
+
+    struct MethodParamLayout
+    {
+        unsigned int typeCode = 0;
+        bool supported = false;
+        std::string label; // "argN: <type> <name>"
+    };
+
+    // Method row contents, resolved once per class: the draw path only formats and reads drafts.
+    struct MethodLayout
+    {
+        Unity::il2cppMethodInfo* method = nullptr;
+        Unity::il2cppClass* declaringClass = nullptr;
+        bool metadataValid = false;
+
+        std::string name;
+        std::string header; // "<return type> <signature>"
+        bool isStatic = false;
+        uint32_t rawArgCount = 0;
+        bool argCountCapped = false;     // more args than kMaxMethodArgsUi
+        bool suspiciousArgCount = false; // above kHardMethodArgsLimit; list hidden
+        bool invokable = false;          // arg count and every arg type supported
+
+        void* methodPointer = nullptr;
+        void* invokerPointer = nullptr;
+        uintptr_t methodRva = 0;
+        uintptr_t invokerRva = 0;
+        bool hasMethodRva = false;
+        bool hasInvokerRva = false;
+
+        std::vector<MethodParamLayout> params; // displayed args only
+    };
+
+    // Members declared by one class of the inheritance chain, as ranges into ClassLayout.
+    struct MemberGroup
+    {
+        Unity::il2cppClass* declaringClass = nullptr;
+        uint32_t firstField = 0;
+        uint32_t fieldCount = 0;
+        uint32_t firstMethod = 0;
+        uint32_t methodCount = 0;
+        std::string fieldHeader;  // "<class> (N)", unique per group
+        std::string methodHeader;
+    };
+
+    // Metadata of one class and all of its bases, built on first inspection and kept for the
+    // process lifetime (IL2CPP never unloads classes). Groups run from the class itself up to
+    // the root; within a group instance fields come first in offset order, then statics. A
+    // method overridden or hidden further down the chain is listed only once, where it is
+    // most derived.
+    struct ClassLayout
+    {
+        Unity::il2cppClass* klass = nullptr;
+        std::vector<MemberGroup> groups;
+        std::vector<FieldLayout> fields;
+        std::vector<MethodLayout> methods;
+        uint32_t fieldGroupCount = 0;  // groups declaring at least one field
+        uint32_t methodGroupCount = 0;
+        bool methodsResolved = false;
+        bool methodsFilled = false; // signatures and addresses, built on first draw of the methods
+
+        uint32_t instanceSize = 0;          // il2cpp_class_instance_size, header included
+        std::vector<FieldSpan> fieldSpans;  // instance fields by offset; field = index into fields
+
+        // Outgoing references for the graph walker.
+        std::string displayName;
+        std::vector<uint32_t> referenceFields; // instance fields holding a managed reference
+        bool isArray = false;
+        bool arrayOfReferences = false;
     };
 
     struct SceneEntry
     {
         Unity::Scene scene{};
+        std::string name;
         std::string label;
+        std::vector<Unity::CGameObject*> roots;
+        bool rootsResolved = false;
     };
 
     struct ObjectEntry
@@ -22,8 +108,367 @@ namespace UExplorer
         Unity::CTransform* parent = nullptr;
         int sceneHandle = 0;
         std::string name;
-        std::string nameLower;
-        std::vector<Unity::CTransform*> children;
+        std::vector<uint32_t> children; // indices into ExplorerState::objects, name-sorted
+        uint64_t stemHash = 0;          // HashNameStem(NameStem(name))
+        uint64_t fingerprint = 0;       // stem + component signature, for sibling grouping
+        uint32_t pathOrdinal = 0;       // earlier same-named siblings in transform order
+        bool activeSelf = false;
+    };
+
+    // Path ordinals a live child walk settled for one parent, reused while its cached children
+    // and live child count still hash the same.
+    struct PathOrdinalMemo
+    {
+        uint64_t membership = 0;
+        std::vector<std::pair<Unity::CTransform*, uint32_t>> ordinals; // sorted by transform
+    };
+
+    // History entries keep the canonical path so they can be re-resolved after a reload.
+    struct NavigationEntry
+    {
+        ObjectHandle handle = 0;
+        std::string path;
+    };
+
+    struct ComponentSnapshot
+    {
+        void* ownerCachedPtr = nullptr;
+        int ownerInstanceId = 0;
+
+        // Parallel arrays, one slot per component.
+        std::vector<Unity::CComponent*> components;
+        std::vector<Unity::il2cppClass*> classes;
+        std::vector<void*> cachedPtrs;
+        std::vector<int> instanceIds;
+
+        uint64_t signature = 0; // order-independent hash of the component classes
+        int layer = -1;         // GameObject layer, read on refresh without GetComponents
+        bool collected = false; // components fetched; empty until something needs them
+
+        uint32_t indexedId = kInvalidIndex; // object index the lookups were posted under
+        uint64_t seenGeneration = 0;        // last object cache generation that held the owner
+        bool stale = false;                 // to be fetched again; indexed under the old components until then
+    };
+
+    struct NameQueryCache
+    {
+        uint64_t generation = 0;
+        std::string filter;
+        std::vector<uint32_t> ids; // object indices, ascending
+    };
+
+    // Attribute filters of the search tab; each "any" setting adds no term.
+    struct AttributeFilterSettings
+    {
+        int active = 0;       // 0 = any, 1 = active in hierarchy, 2 = inactive
+        int layer = -1;       // -1 = any
+        int root = 0;         // 0 = any, 1 = roots only, 2 = children only
+        int depthBucket = -1; // -1 = any, else AttributeIndex::DepthBucketOf
+        std::string withComponent;
+        std::string withoutComponent;
+
+        bool operator==(const AttributeFilterSettings&) const = default;
+    };
+
+    // Per-candidate verdicts of one filter predicate: which objects it has tested, and which
+    // of those passed (before negation).
+    struct QueryFilterVerdicts
+    {
+        Bitset tested;
+        Bitset passed;
+    };
+
+    // Parsed and planned once per query text; the hits are re-evaluated per object generation.
+    // Filter verdicts outlive text edits within a generation, so refining a query only tests
+    // the candidates no earlier evaluation has seen.
+    struct ObjectQueryCache
+    {
+        std::string text;
+        bool valid = false;
+        std::string error;
+        QueryPlan plan;
+
+        uint64_t generation = 0;
+        uint64_t componentGeneration = 0; // ExplorerState::componentIndexGeneration of the hits
+        Bitset hits;
+        std::vector<size_t> stageCounts; // candidates left after each indexed, then filter stage
+        double evalMicros = 0.0;
+        size_t filterTests = 0; // candidates actually tested by the last evaluation
+
+        uint64_t verdictGeneration = 0;
+        std::unordered_map<std::string, QueryFilterVerdicts> verdicts; // by QueryPredicateKey
+    };
+
+    struct ObjectSearchCache
+    {
+        uint64_t generation = 0;
+        uint64_t componentGeneration = 0;
+        int sceneHandle = 0;
+        std::string nameFilter;
+        std::string classFilter;
+        AttributeFilterSettings attributeFilter;
+        std::string queryText;
+        ObjectQueryCache query;
+        NameQueryCache nameQuery;
+        std::vector<uint32_t> matches;
+
+        bool attributeFiltered = false;
+        size_t attributeHitCount = 0;
+        double attributeEvalMicros = 0.0;
+
+        // Display rows over matches; kGroupRowFlag rows index into groups.
+        bool rowsDirty = true;
+        bool builtGrouped = false;
+        std::vector<uint32_t> rows;
+        std::vector<std::vector<uint32_t>> groups; // object indices per group, in match order
+        std::vector<uint64_t> groupFingerprints;
+        std::unordered_set<uint64_t> expandedGroups; // by fingerprint, so they survive refreshes
+    };
+
+    struct HierarchyViewCache
+    {
+        uint64_t builtGeneration = 0;
+        int builtSceneHandle = 0;
+        std::string builtFilter;
+        bool filtered = false;
+        bool rowsDirty = true;
+
+        Bitset visible;  // by layout position, only meaningful while filtered
+        Bitset expanded; // by layout position
+        std::vector<uint32_t> rows;
+        NameQueryCache nameQuery;
+
+        // Expansion survives refreshes keyed by transform and is remapped onto the new layout.
+        // The lazy view shares the set, so toggling there only marks the bitset for a remap.
+        std::unordered_set<Unity::CTransform*> expandedTransforms;
+        bool expansionDirty = false;
+
+        // Sibling runs the user opened, keyed by the first member like expandedTransforms.
+        bool builtGrouped = false;
+        Bitset groupExpanded; // by layout position of the run head
+        std::unordered_set<Unity::CTransform*> expandedGroups;
+    };
+
+    struct LazyHierarchyNode
+    {
+        Unity::CGameObject* gameObject = nullptr;
+        Unity::CTransform* transform = nullptr;
+        int sceneHandle = 0;
+        uint32_t depth = 0;
+        int childCount = 0;           // live count when last seen, drives the arrow
+        uint64_t childrenVersion = 0; // LazyHierarchyCache::version the children were checked at, 0 = never fetched
+        std::string name;
+        std::vector<uint32_t> children; // indices into LazyHierarchyCache::nodes, name-sorted
+        uint64_t stemHash = 0;
+        uint32_t runLength = 0; // siblings from here on sharing stemHash, 0 unless a group head
+        uint32_t parent = kInvalidIndex; // node index, none for roots
+        int siblingIndex = 0;          // GetChild index, or position in the scene's root list
+    };
+
+    // Top-down hierarchy that only touches scene roots and the children of expanded nodes.
+    // Any refresh bumps version; each expanded node then revalidates its own children on next use.
+    struct LazyHierarchyCache
+    {
+        uint64_t version = 1;
+        uint64_t builtVersion = 0;
+        int builtSceneHandle = 0;
+        bool builtIncludeInactive = true;
+        bool rowsDirty = true;
+
+        std::vector<LazyHierarchyNode> nodes;
+        std::vector<uint32_t> roots;
+        std::vector<uint32_t> rows;
+        std::unordered_map<Unity::CGameObject*, uint32_t> nodeByObject;
+    };
+
+    // Spawn/destroy profiler fed from the Instantiate/Destroy change events. The game thread
+    // only pays for the queue push; classification and counting happen when events are drained.
+    struct ChurnState
+    {
+        bool recording = false;
+        int groupBy = 0; // 0 = name stem, 1 = component signature
+        int windowSeconds = 4;
+        uint64_t selectedKey = 0;
+
+        ChurnProfiler byStem;
+        ChurnProfiler bySignature;
+
+        SpawnAttributionTable spawned;
+        std::unordered_map<uint64_t, uint64_t> signatureByStem; // collected once per prefab stem
+        std::unordered_map<Unity::il2cppClass*, bool> isGameObjectClass;
+
+        uint64_t eventsRecorded = 0;
+        uint64_t eventsDropped = 0;
+        std::vector<ChurnProfiler::Rate> rates;
+    };
+
+    // Proximity and in-view queries over the captured transforms. The grid follows the capture:
+    // rebuilt on a new object snapshot or a busy sweep, patched from the change mask otherwise.
+    struct NearbyState
+    {
+        bool tabVisible = false; // drawn last frame; keeps the capture running
+        int mode = 0;            // 0 = radius, 1 = k nearest, 2 = in view of the main camera
+        int center = 0;          // 0 = selected object, 1 = main camera, 2 = custom point
+        float customCenter[3]{};
+        float radius = 25.0f;
+        int nearestCount = 32;
+        float cellSize = 4.0f;
+
+        SpatialGrid grid;
+        uint64_t builtGeneration = 0;
+        uint64_t builtSweep = 0;
+        float builtCellSize = 0.0f;
+        size_t lastPatched = 0;
+        double lastSyncMs = 0.0;
+        bool lastSyncRebuilt = false;
+
+        std::vector<SpatialGrid::Neighbor> results;
+        double lastQueryMs = 0.0;
+        bool centerValid = false;
+        float lastCenter[3]{};
+    };
+
+    // A field path sampled into a history ring. The probe's base is re-resolved from the handle
+    // every frame; the sampler only ever sees raw addresses.
+    struct WatchEntry
+    {
+        ObjectHandle handle = 0;
+        std::string label; // "<GameObject>.<Component>.<path>"
+        std::string typeName;
+        WatchProbe probe;  // base is filled in when publishing
+        uintptr_t publishedBase = 0;
+    };
+
+    struct WatchListState
+    {
+        std::vector<WatchEntry> entries;
+        float rateHz = 60.0f;
+        std::atomic<bool> updateHookActive{ false }; // sampling on the game's update; otherwise from Present
+        bool planDirty = false;
+        ULONGLONG lastResolveTick = 0;
+        std::unordered_map<uint64_t, std::string> pathDrafts; // per field row, sub-path input
+        std::string lastError;
+        std::vector<float> history; // scratch for plotting
+    };
+
+    // Raw-byte baseline of one component, or of every known instance of its class, diffed later
+    // to find the fields that changed. Instances are matched by address and revalidated by
+    // their class pointer, so a collected and reused address reads as lost, not as changed.
+    struct SnapshotDiffState
+    {
+        Unity::il2cppClass* klass = nullptr;
+        bool allInstances = false;
+        uint32_t instanceSize = 0;
+        std::vector<uintptr_t> objects;
+        std::vector<uint8_t> baseline; // objects.size() * instanceSize
+        std::vector<uint8_t> current;
+        ULONGLONG baselineTick = 0;
+
+        bool hasDiff = false;
+        std::unordered_set<uint64_t> changedFields; // BuildFieldKey(object, field)
+        std::vector<uint32_t> changeCounts;         // per layout field span: instances it changed in
+        size_t changedInstances = 0;
+        size_t lostInstances = 0;
+        double lastDiffMs = 0.0;
+
+        std::vector<ByteRange> ranges;    // scratch
+        std::vector<uint8_t> spanChanged; // scratch
+    };
+
+    // Bounded BFS over outgoing references from one root. Node types are ClassLayout pointers;
+    // classLayouts and walkLayouts are node-based, so they stay valid for the life of the graph.
+    struct ReferenceWalkState
+    {
+        uintptr_t root = 0;
+        std::string rootLabel;
+        int maxDepth = 8;
+        int maxNodes = 1 << 20;
+        int maxEdges = 1 << 22;
+        int maxArrayElements = 65536;
+
+        ReferenceGraph graph;
+        std::unordered_map<Unity::il2cppClass*, const ClassLayout*> validClasses; // nullptr = rejected
+        std::unordered_set<const void*> images; // of every loaded assembly, collected per walk
+        std::vector<uintptr_t> scratch;
+        uint32_t rejected = 0;
+        std::string status;
+
+        char search[128]{};
+        std::vector<uint32_t> matches;
+        uint32_t focused = ReferenceGraph::kNoNode;
+        std::vector<uint32_t> focusedPath;
+        std::unordered_map<uint32_t, std::vector<float>> childRowHeights; // by opened node, for DrawVirtualRows
+    };
+
+    // One background refresh. The worker owns everything in here until done is set; the job is
+    // shared with the (detached) worker so it stays valid even if the explorer goes away first.
+    struct ReverseReferenceJob
+    {
+        ReverseReferenceIndex index;
+        std::vector<ReverseReferenceIndex::Owner> owners;
+        std::vector<Unity::CGameObject*> ownerObjects;
+        uint64_t generation = 0;
+        std::atomic<bool> done{ false };
+    };
+
+    // Who references what, over the reference fields of every cached component. Owner types are
+    // ClassLayout pointers and slot s of an owner is layout->referenceFields[s]. The panel reads
+    // index while a job refreshes the other buffer; finished jobs are swapped in on the next
+    // tick, so the index is at most one refresh behind.
+    struct ReverseReferenceState
+    {
+        ReverseReferenceIndex index;
+        std::vector<Unity::CGameObject*> ownerObjects; // per owner index of index
+        ReverseReferenceIndex spare;                   // back buffer, handed to the next job
+        std::shared_ptr<ReverseReferenceJob> job;      // in flight, or null
+        uint64_t builtGeneration = 0;
+        bool built = false;
+        bool autoRefresh = true;
+        bool hideSelf = true;
+        ULONGLONG lastRefreshTick = 0;
+        std::string status;
+    };
+
+    // Live instances of one class (subclasses included) found by il2cpp's liveness walk from
+    // static roots; the same walk the Unity memory profiler uses.
+    struct HeapInstancesState
+    {
+        char className[256]{}; // Namespace.Name
+        bool exactClass = false;
+        int capacity = 1 << 20;
+
+        Unity::il2cppClass* klass = nullptr;
+        InstanceSink sink;
+        LivenessArena arena; // the walk's own arrays; reserved once, decommitted after each walk
+        size_t arenaPeak = 0;
+        std::vector<uintptr_t> instances;
+        size_t overflow = 0;
+        std::string status;
+    };
+
+    struct ScanInstance
+    {
+        uintptr_t object = 0;
+        Unity::il2cppClass* klass = nullptr;
+        const ClassLayout* layout = nullptr; // classLayouts is node-based, so this stays valid
+        Unity::CGameObject* owner = nullptr;
+    };
+
+    // Value scanner over component fields. A new scan seeds candidates from every instance field
+    // of the chosen type; later scans narrow them. Workers only read raw memory.
+    struct ValueScanState
+    {
+        char classFilter[128]{}; // class or base class; empty = MonoBehaviour
+        int valueKind = 5;       // index into kScanValueKinds
+        int compare = 0;         // ScanCompare
+        double value = 0.0;
+        double valueHigh = 0.0;
+        double epsilon = 0.0;
+
+        std::vector<ScanInstance> instances;
+        WatchValueKind kind = WatchValueKind::I32;
+        ValueScanner scanner;
+        std::string status;
     };
 
     struct ExplorerState
@@ -35,10 +480,26 @@ namespace UExplorer
         bool autoRefresh = false;
         bool includeInactive = true;
 
+        // Lazy mode defers the full object walk until search or a name filter needs it.
+        bool lazyHierarchy = true;
+        bool objectCacheStale = true;
+
+        // Collapse runs of look-alike siblings (same name stem and components) into one row.
+        bool groupRepeatedSiblings = true;
+
         ULONGLONG refreshIntervalMs = 2500;
         ULONGLONG lastObjectRefreshTick = 0;
         ULONGLONG lastSceneRefreshTick = 0;
 
+        // Event-driven refresh fed by the scene/instantiate/destroy hooks in main.cpp.
+        bool refreshOnChanges = true;
+        bool changeHooksActive = false;
+        size_t pendingChangeEvents = 0;  // drained since the last refresh
+        bool pendingSceneChange = false; // load, unload or active scene switch
+        bool pendingObjectChange = false; // an Instantiate/Destroy that touched what is cached
+        bool pendingChangeOverflow = false;
+        int activeSceneHandle = 0; // where clones without a parent land
+
         size_t lastObjectCountLogged = 0;
         int lastSceneCountLogged = 0;
 
@@ -46,16 +507,72 @@ namespace UExplorer
         std::vector<ObjectEntry> objects;
 
         std::unordered_map<Unity::CTransform*, size_t> indexByTransform;
-        std::vector<Unity::CTransform*> rootTransforms;
-        std::unordered_set<Unity::CGameObject*> aliveObjects;
-
-        std::unordered_map<Unity::CGameObject*, std::string> classBlobCacheLower;
-
+        std::vector<uint32_t> rootIndices;
+        std::unordered_map<Unity::CTransform*, PathOrdinalMemo> pathOrdinalMemos; // by parent, only parents that needed a live walk
+
+        uint64_t objectCacheGeneration = 0;
+        HierarchyLayout hierarchyLayout;
+
+        // Roots are ordered by scene before the layout is built, so every scene owns one
+        // contiguous [begin, end) range of layout positions.
+        std::unordered_map<int, std::pair<uint32_t, uint32_t>> sceneLayoutRanges;
+        HierarchyViewCache hierarchyView;
+        SiblingGroups siblingGroups;
+        LazyHierarchyCache lazyTree;
+        NameIndex nameIndex; // ids match indices into objects
+        AttributeIndex attributeIndex; // ids match indices into objects
+        ObjectSearchCache objectSearch;
+        ChurnState churn;
+
+        // World poses of every cached object, captured in budgeted sweeps while enabled.
+        bool captureTransforms = false;
+        int captureBudgetMicros = 1500;
+        uint64_t transformCaptureGeneration = 0;
+        TransformCapture transformCapture; // ids match indices into objects
+        NearbyState nearby;
+        WatchListState watches;
+        SnapshotDiffState snapshotDiff;
+        ValueScanState valueScan;
+        ReferenceWalkState referenceWalk;
+        ReverseReferenceState reverseReferences;
+        HeapInstancesState heapInstances;
+
+        // Component lists survive refreshes and are fetched on demand; a rotating slice of the
+        // fetched ones is asked for GetComponents again on each refresh.
+        std::unordered_map<Unity::CGameObject*, ComponentSnapshot> componentsByObject;
+        std::unordered_map<Unity::il2cppClass*, std::vector<uint32_t>> classChainSlots;
+        TypeIndex componentTypeIndex; // object indices per component class, parents included
+
+        // Reverse lookups to the owning object index, patched on each object refresh. Managed
+        // pointers cover both GameObjects and their components.
+        std::unordered_map<const void*, uint32_t> ownerByManagedObject;
+        std::unordered_map<const void*, uint32_t> ownerByCachedPtr;
+        std::unordered_map<int, uint32_t> ownerByInstanceId;
+        size_t componentRescanCursor = 0;
+        size_t pendingComponentSnapshots = 0; // objects whose components were never fetched, or are stale
+
+        // Never-fetched snapshots are filled a time-boxed slice per frame. The lookups take each
+        // one at once; filter caches see them in batches, via componentIndexGeneration.
+        size_t componentFillCursor = 0;
+        uint64_t componentIndexGeneration = 0;
+        bool componentFillUnpublished = false;
+        ULONGLONG lastComponentPublishTick = 0;
+
+        // Selection and history hold weak handles; selectedObject is only the pointer the
+        // handle last resolved to, kept for cheap row highlighting.
+        WeakHandleTable objectHandles;
+        ObjectHandle selectedHandle = 0;
         Unity::CGameObject* selectedObject = nullptr;
         int selectedSceneHandle = 0; // 0 = all scenes
-        std::vector<Unity::CGameObject*> navigationHistory;
+        std::string selectedPath;
+        uint64_t selectedPathRetryStamp = 0;
+        std::vector<NavigationEntry> navigationHistory;
+
+        uint64_t sceneCacheGeneration = 0;
+        ObjectPathTrie pathTrie;
+        char pathToResolve[256]{};
 
-        Unity::CGameObject* transformEditTarget = nullptr;
+        ObjectHandle transformEditTarget = 0;
         float editLocalPosition[3]{};
         float editEuler[3]{};
         float editLocalScale[3]{ 1.0f, 1.0f, 1.0f };
@@ -63,16 +580,42 @@ namespace UExplorer
         char hierarchyFilter[128]{};
         char classFilter[128]{};
         char nameFilter[128]{};
+        char queryText[256]{};
+        AttributeFilterSettings attributeFilter;
+        char withComponentFilter[128]{};
+        char withoutComponentFilter[128]{};
         char sceneToLoad[128]{};
 
         void* fnObjectGetInstanceId = nullptr;
 
         std::unordered_map<uint64_t, std::string> fieldValueDrafts;
         std::unordered_map<uint64_t, FieldReferencePreview> fieldReferencePreviews;
+        std::unordered_map<Unity::il2cppClass*, ClassLayout> classLayouts; // node-based: entries never move
+        std::unordered_map<Unity::il2cppClass*, ClassLayout> walkLayouts;  // reference fields only; see GetWalkLayout
+        std::unordered_map<uint64_t, std::vector<float>> memberRowHeights; // per component member group, reset on selection
         std::unordered_map<uint64_t, std::string> methodInvokeResults;
         std::unordered_map<uint64_t, std::vector<std::string>> methodArgDrafts;
 
+        // Query field predicates: field name -> class -> field (nullptr when the class lacks it).
+        std::unordered_map<std::string, std::unordered_map<Unity::il2cppClass*, Unity::il2cppFieldInfo*>> queryFieldsByName;
+
         void* fnRuntimeInvoke = nullptr;
+        void* fnClassInstanceSize = nullptr;
+        void* fnClassGetRank = nullptr;
+        void* fnClassGetElementClass = nullptr;
+        void* fnClassIsValueType = nullptr;
+
+        // Liveness API: begin/end before Unity 2021.2, allocate/finalize/free with explicit
+        // world stops after it. Either set may be missing.
+        void* fnLivenessBegin = nullptr;
+        void* fnLivenessEnd = nullptr;
+        void* fnLivenessAllocateStruct = nullptr;
+        void* fnLivenessFinalize = nullptr;
+        void* fnLivenessFreeStruct = nullptr;
+        void* fnLivenessFromStatics = nullptr;
+        void* fnStopGcWorld = nullptr;
+        void* fnStartGcWorld = nullptr;
+        size_t gameAssemblyImageSize = 0; // PE SizeOfImage, read once at init for RVA checks
 
         bool logAutoScroll = true;
         char logFilter[128]{};
@@ -89,7 +632,24 @@ namespace UExplorer
         return s_State;
     }
 
+    static ChangeEventQueue& GetChangeQueue()
+    {
+        static ChangeEventQueue s_Queue;
+        return s_Queue;
+    }
+
+    // Shared with the game-thread update hook, so it lives outside ExplorerState.
+    static WatchSampler& GetWatchSampler()
+    {
+        static WatchSampler s_Sampler;
+        return s_Sampler;
+    }
+
     static std::string SanitizeMemberName(const char* rawName);
+    static void EnsureComponentSnapshots(ExplorerState& state);
+    static void EnsureObjectComponents(ExplorerState& state, Unity::CGameObject* gameObject);
+    template<typename T>
+    static bool ReadFieldValue(Unity::CComponent* component, Unity::il2cppFieldInfo* field, bool isStatic, T* outValue);
     static bool SafeCopyAsciiLabel(const char* source, char* destination, size_t destinationSize);
     static bool SafeReadClassMetadata(
         Unity::il2cppClass* klass,
@@ -277,11 +837,15 @@ namespace UExplorer
         TypeCode_U2 = 7,
         TypeCode_I4 = 8,
         TypeCode_U4 = 9,
+        TypeCode_I8 = 10,
+        TypeCode_U8 = 11,
         TypeCode_R4 = 12,
         TypeCode_R8 = 13,
         TypeCode_String = 14,
         TypeCode_Class = 18,
+        TypeCode_GenericInst = 21,
         TypeCode_Object = 28,
+        TypeCode_SzArray = 29,
     };
 
     enum class EditableValueType : int
@@ -300,6 +864,7 @@ namespace UExplorer
     static const ImVec4 kColorMethod = ImVec4(1.00f, 0.58f, 0.10f, 1.00f);
     static const ImVec4 kColorField = ImVec4(0.72f, 0.42f, 0.96f, 1.00f);
     static const ImVec4 kColorClass = ImVec4(0.32f, 0.86f, 0.92f, 1.00f);
+    static const ImVec4 kColorChanged = ImVec4(1.00f, 0.86f, 0.24f, 1.00f);
 
     struct AnimatedButtonState
     {
@@ -588,6 +1153,8 @@ namespace UExplorer
         if (std::strcmp(name, "UInt16") == 0) return TypeCode_U2;
         if (std::strcmp(name, "Int32") == 0) return TypeCode_I4;
         if (std::strcmp(name, "UInt32") == 0) return TypeCode_U4;
+        if (std::strcmp(name, "Int64") == 0) return TypeCode_I8;
+        if (std::strcmp(name, "UInt64") == 0) return TypeCode_U8;
         if (std::strcmp(name, "Single") == 0) return TypeCode_R4;
         if (std::strcmp(name, "Double") == 0) return TypeCode_R8;
         if (std::strcmp(name, "String") == 0) return TypeCode_String;
@@ -638,6 +1205,8 @@ namespace UExplorer
         case TypeCode_U2: return "ushort";
         case TypeCode_I4: return "int";
         case TypeCode_U4: return "uint";
+        case TypeCode_I8: return "long";
+        case TypeCode_U8: return "ulong";
         case TypeCode_R4: return "float";
         case TypeCode_R8: return "double";
         case TypeCode_String: return "string";
@@ -658,6 +1227,30 @@ namespace UExplorer
         }
     }
 
+    static size_t SafeGetModuleImageSize(HMODULE module)
+    {
+        if (!module)
+            return 0;
+
+        __try
+        {
+            const IMAGE_DOS_HEADER* dos = reinterpret_cast<const IMAGE_DOS_HEADER*>(module);
+            if (dos->e_magic != IMAGE_DOS_SIGNATURE)
+                return 0;
+
+            const IMAGE_NT_HEADERS* nt = reinterpret_cast<const IMAGE_NT_HEADERS*>(
+                reinterpret_cast<uintptr_t>(module) + static_cast<uintptr_t>(dos->e_lfanew));
+            if (nt->Signature != IMAGE_NT_SIGNATURE)
+                return 0;
+
+            return static_cast<size_t>(nt->OptionalHeader.SizeOfImage);
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return 0;
+        }
+    }
+
     static void ResolveRuntimeMethods(ExplorerState& state)
     {
         if (!state.fnObjectGetInstanceId)
@@ -677,40 +1270,43 @@ namespace UExplorer
             state.fnRuntimeInvoke = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_runtime_invoke");
         }
 
-        if (!state.methodResolvePrinted)
+        if (!state.fnClassInstanceSize && IL2CPP::Globals.m_GameAssembly)
+            state.fnClassInstanceSize = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_class_instance_size");
+
+        if (!state.fnClassGetRank && IL2CPP::Globals.m_GameAssembly)
         {
-            HBLog::Printf("[UExplorer] Method resolve: Object.GetInstanceID=%p il2cpp_runtime_invoke=%p\n",
-                state.fnObjectGetInstanceId,
-                state.fnRuntimeInvoke);
-            state.methodResolvePrinted = true;
+            state.fnClassGetRank = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_class_get_rank");
+            state.fnClassGetElementClass = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_class_get_element_class");
+            state.fnClassIsValueType = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_class_is_valuetype");
         }
-    }
-
-    static size_t SafeGetModuleImageSize(HMODULE module)
-    {
-        if (!module)
-            return 0;
 
-        __try
+        if (!state.fnLivenessFromStatics && IL2CPP::Globals.m_GameAssembly)
         {
-            const IMAGE_DOS_HEADER* dos = reinterpret_cast<const IMAGE_DOS_HEADER*>(module);
-            if (dos->e_magic != IMAGE_DOS_SIGNATURE)
-                return 0;
+            state.fnLivenessBegin = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_unity_liveness_calculation_begin");
+            state.fnLivenessEnd = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_unity_liveness_calculation_end");
+            state.fnLivenessAllocateStruct = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_unity_liveness_allocate_struct");
+            state.fnLivenessFinalize = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_unity_liveness_finalize");
+            state.fnLivenessFreeStruct = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_unity_liveness_free_struct");
+            state.fnLivenessFromStatics = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_unity_liveness_calculation_from_statics");
+            state.fnStopGcWorld = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_stop_gc_world");
+            state.fnStartGcWorld = GetProcAddress(IL2CPP::Globals.m_GameAssembly, "il2cpp_start_gc_world");
+        }
 
-            const IMAGE_NT_HEADERS* nt = reinterpret_cast<const IMAGE_NT_HEADERS*>(
-                reinterpret_cast<uintptr_t>(module) + static_cast<uintptr_t>(dos->e_lfanew));
-            if (nt->Signature != IMAGE_NT_SIGNATURE)
-                return 0;
+        if (!state.gameAssemblyImageSize && IL2CPP::Globals.m_GameAssembly)
+            state.gameAssemblyImageSize = SafeGetModuleImageSize(IL2CPP::Globals.m_GameAssembly);
 
-            return static_cast<size_t>(nt->OptionalHeader.SizeOfImage);
-        }
-        __except (EXCEPTION_EXECUTE_HANDLER)
+        if (!state.methodResolvePrinted)
         {
-            return 0;
+            HBLog::Printf("[UExplorer] Method resolve: Object.GetInstanceID=%p il2cpp_runtime_invoke=%p il2cpp_class_instance_size=%p\n",
+                state.fnObjectGetInstanceId,
+                state.fnRuntimeInvoke,
+                state.fnClassInstanceSize);
+            state.methodResolvePrinted = true;
         }
     }
 
-    static bool TryGetGameAssemblyRva(void* address, uintptr_t* outRva)
+    // imageSize 0 (unknown) accepts any address above the module base.
+    static bool TryGetGameAssemblyRva(void* address, size_t imageSize, uintptr_t* outRva)
     {
         if (outRva)
             *outRva = 0;
@@ -724,7 +1320,6 @@ namespace UExplorer
             return false;
 
         const uintptr_t rva = target - moduleBase;
-        const size_t imageSize = SafeGetModuleImageSize(IL2CPP::Globals.m_GameAssembly);
         if (imageSize != 0 && rva >= imageSize)
             return false;
 
@@ -797,18 +1392,38 @@ namespace UExplorer
         }
     }
 
-    static bool SafeFetchMethods(Unity::CComponent* component, std::vector<Unity::il2cppMethodInfo*>* outMethods)
+    static bool SafeFetchFields(Unity::il2cppClass* klass, std::vector<Unity::il2cppFieldInfo*>* outFields)
+    {
+        if (!outFields)
+            return false;
+
+        outFields->clear();
+        if (!klass)
+            return false;
+
+        __try
+        {
+            IL2CPP::Class::FetchFields(klass, outFields);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    static bool SafeFetchMethods(Unity::il2cppClass* klass, std::vector<Unity::il2cppMethodInfo*>* outMethods)
     {
         if (!outMethods)
             return false;
 
         outMethods->clear();
-        if (!component)
+        if (!klass)
             return false;
 
         __try
         {
-            component->FetchMethods(outMethods);
+            IL2CPP::Class::FetchMethods(klass, outMethods);
             return true;
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
@@ -859,8 +1474,14 @@ namespace UExplorer
 
     static int GetSceneHandleForGameObject(ExplorerState& state, Unity::CGameObject* gameObject)
     {
-        (void)state;
-        (void)gameObject;
+        auto it = state.ownerByManagedObject.find(gameObject);
+        if (it != state.ownerByManagedObject.end() && it->second < state.objects.size())
+            return state.objects[it->second].sceneHandle;
+
+        auto nodeIt = state.lazyTree.nodeByObject.find(gameObject);
+        if (nodeIt != state.lazyTree.nodeByObject.end())
+            return state.lazyTree.nodes[nodeIt->second].sceneHandle;
+
         return 0;
     }
 
@@ -909,106 +1530,115 @@ namespace UExplorer
         }
     }
 
-    static Unity::il2cppArray<Unity::CComponent*>* SafeGetComponents(Unity::CGameObject* gameObject, Unity::il2cppObject* componentType)
+    static int SafeGetChildCount(Unity::CTransform* transform)
     {
-        if (!gameObject || !componentType)
-            return nullptr;
+        if (!transform)
+            return 0;
 
         __try
         {
-            return gameObject->GetComponents(componentType);
+            return transform->GetChildCount();
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
-            HBLog::Printf("[UExplorer] EXCEPTION: GameObject::GetComponents failed for %p.\n", gameObject);
-            return nullptr;
+            HBLog::Printf("[UExplorer] EXCEPTION: Transform::GetChildCount failed for %p.\n", transform);
+            return 0;
         }
     }
 
-    static Unity::CGameObject* SafeArrayGetGameObject(Unity::il2cppArray<Unity::CGameObject*>* array, unsigned int index)
+    static Unity::CTransform* SafeGetChild(Unity::CTransform* transform, int index)
     {
-        if (!array)
+        if (!transform)
             return nullptr;
 
         __try
         {
-            return array->operator[](index);
+            return transform->GetChild(index);
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
-            HBLog::Printf("[UExplorer] EXCEPTION: GameObject array access failed at index %u.\n", index);
+            HBLog::Printf("[UExplorer] EXCEPTION: Transform::GetChild(%d) failed for %p.\n", index, transform);
             return nullptr;
         }
     }
 
-    static bool SafeReadObjectClass(Unity::il2cppObject* object, Unity::il2cppClass** outClass)
+    static Unity::CGameObject* SafeGetComponentGameObject(Unity::CComponent* component)
     {
-        if (outClass)
-            *outClass = nullptr;
-
-        if (!object || !outClass)
-            return false;
+        if (!component)
+            return nullptr;
 
         __try
         {
-            *outClass = object->m_pClass;
-            return true;
+            return component->GetGameObject();
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
-            HBLog::Printf("[UExplorer] EXCEPTION: reading object class failed for %p.\n", object);
-            return false;
+            HBLog::Printf("[UExplorer] EXCEPTION: Component::get_gameObject failed for %p.\n", component);
+            return nullptr;
         }
     }
 
-    static Unity::CComponent* SafeArrayGetComponent(Unity::il2cppArray<Unity::CComponent*>* array, unsigned int index)
+    static Unity::CGameObject* SafeGetTransformGameObject(Unity::CTransform* transform)
     {
-        if (!array)
-            return nullptr;
+        return SafeGetComponentGameObject(reinterpret_cast<Unity::CComponent*>(transform));
+    }
+
+    static int SafeGetLayer(Unity::CGameObject* gameObject)
+    {
+        if (!gameObject)
+            return -1;
 
         __try
         {
-            return array->operator[](index);
+            return static_cast<int>(gameObject->GetLayer());
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
-            return nullptr;
+            return -1;
         }
     }
 
-    static bool SafeReadUnityObjectCachedPtr(Unity::il2cppObject* object, void** outCachedPtr)
+    static bool SafeReadTransformSample(Unity::CTransform* transform, TransformSample* outSample)
     {
-        if (outCachedPtr)
-            *outCachedPtr = nullptr;
-
-        if (!object || !outCachedPtr)
+        if (!transform || !outSample)
             return false;
 
+        Unity::Vector3 position{};
+        Unity::Quaternion rotation{};
+        Unity::Vector3 scale{};
+
         __try
         {
-            *outCachedPtr = *reinterpret_cast<void**>(
-                reinterpret_cast<uintptr_t>(object) + sizeof(Unity::il2cppObject));
-            return true;
+            // A destroyed transform keeps its wrapper but loses m_CachedPtr; its sample is not valid.
+            if (!transform->GetPositionAndRotation(position, rotation) || !transform->GetLossyScale(scale))
+                return false;
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
             return false;
         }
+
+        outSample->position[0] = position.x;
+        outSample->position[1] = position.y;
+        outSample->position[2] = position.z;
+        outSample->rotation[0] = rotation.x;
+        outSample->rotation[1] = rotation.y;
+        outSample->rotation[2] = rotation.z;
+        outSample->rotation[3] = rotation.w;
+        outSample->scale[0] = scale.x;
+        outSample->scale[1] = scale.y;
+        outSample->scale[2] = scale.z;
+        return true;
     }
 
-    static bool SafeGetObjectInstanceId(ExplorerState& state, Unity::il2cppObject* object, int* outInstanceId)
+    static bool SafeGetActiveSelf(Unity::CGameObject* gameObject)
     {
-        if (outInstanceId)
-            *outInstanceId = 0;
-
-        if (!object || !outInstanceId || !state.fnObjectGetInstanceId)
+        if (!gameObject)
             return false;
 
         __try
         {
-            *outInstanceId = reinterpret_cast<int(UNITY_CALLING_CONVENTION)(void*)>(
-                state.fnObjectGetInstanceId)(object);
-            return true;
+            return gameObject->GetActive();
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
@@ -1016,38 +1646,315 @@ namespace UExplorer
         }
     }
 
-    static bool SafeReadClassMetadata(
-        Unity::il2cppClass* klass,
-        const char** outName,
-        const char** outNamespace,
-        Unity::il2cppClass** outParent)
+    static Unity::il2cppArray<Unity::CGameObject*>* SafeGetSceneRoots(Unity::Scene scene)
     {
-        if (outName) *outName = nullptr;
-        if (outNamespace) *outNamespace = nullptr;
-        if (outParent) *outParent = nullptr;
-
-        if (!klass)
-            return false;
-
         __try
         {
-            if (outName) *outName = klass->m_pName;
-            if (outNamespace) *outNamespace = klass->m_pNamespace;
-            if (outParent) *outParent = klass->m_pParentClass;
-            return true;
+            return Unity::SceneManager::GetRootGameObjects(scene);
         }
         __except (EXCEPTION_EXECUTE_HANDLER)
         {
-            return false;
+            HBLog::Printf("[UExplorer] EXCEPTION: Scene::GetRootGameObjects failed for handle %d.\n", scene.m_Handle);
+            return nullptr;
         }
     }
 
-    static bool SafeCopyAsciiLabel(const char* source, char* destination, size_t destinationSize)
+    static Unity::System_String* SafeGetSceneNameRaw(Unity::Scene scene)
     {
-        if (!destination || destinationSize == 0)
-            return false;
-
-        destination[0] = '\0';
+        __try
+        {
+            return Unity::SceneManager::GetSceneName(scene);
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return nullptr;
+        }
+    }
+
+    static int SafeGetActiveSceneHandle()
+    {
+        __try
+        {
+            return Unity::SceneManager::GetActiveScene().m_Handle;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return 0;
+        }
+    }
+
+    static Unity::il2cppArray<Unity::CComponent*>* SafeGetComponents(Unity::CGameObject* gameObject, Unity::il2cppObject* componentType)
+    {
+        if (!gameObject || !componentType)
+            return nullptr;
+
+        __try
+        {
+            return gameObject->GetComponents(componentType);
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            HBLog::Printf("[UExplorer] EXCEPTION: GameObject::GetComponents failed for %p.\n", gameObject);
+            return nullptr;
+        }
+    }
+
+    static Unity::CGameObject* SafeArrayGetGameObject(Unity::il2cppArray<Unity::CGameObject*>* array, unsigned int index)
+    {
+        if (!array)
+            return nullptr;
+
+        __try
+        {
+            return array->operator[](index);
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            HBLog::Printf("[UExplorer] EXCEPTION: GameObject array access failed at index %u.\n", index);
+            return nullptr;
+        }
+    }
+
+    static bool SafeReadObjectClass(Unity::il2cppObject* object, Unity::il2cppClass** outClass)
+    {
+        if (outClass)
+            *outClass = nullptr;
+
+        if (!object || !outClass)
+            return false;
+
+        __try
+        {
+            *outClass = object->m_pClass;
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            HBLog::Printf("[UExplorer] EXCEPTION: reading object class failed for %p.\n", object);
+            return false;
+        }
+    }
+
+    static Unity::CComponent* SafeArrayGetComponent(Unity::il2cppArray<Unity::CComponent*>* array, unsigned int index)
+    {
+        if (!array)
+            return nullptr;
+
+        __try
+        {
+            return array->operator[](index);
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return nullptr;
+        }
+    }
+
+    static Unity::il2cppObject* GetComponentSystemType()
+    {
+        Unity::il2cppObject* componentType = IL2CPP::SystemTypeCache::Get(UNITY_COMPONENT_CLASS);
+        if (!componentType)
+            componentType = IL2CPP::Class::GetSystemType(UNITY_COMPONENT_CLASS);
+
+        return componentType;
+    }
+
+    static bool SafeReadUnityObjectCachedPtr(Unity::il2cppObject* object, void** outCachedPtr)
+    {
+        if (outCachedPtr)
+            *outCachedPtr = nullptr;
+
+        if (!object || !outCachedPtr)
+            return false;
+
+        __try
+        {
+            *outCachedPtr = *reinterpret_cast<void**>(
+                reinterpret_cast<uintptr_t>(object) + sizeof(Unity::il2cppObject));
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    // UnityEngine.Object wrappers outlive their native object; Destroy clears m_CachedPtr.
+    static bool SafeIsNativeObjectAlive(Unity::il2cppObject* object)
+    {
+        void* cachedPtr = nullptr;
+        return SafeReadUnityObjectCachedPtr(object, &cachedPtr) && cachedPtr;
+    }
+
+    // The GC's view of a handle: nullptr once the managed object was collected. Without the
+    // weak-handle exports the pointer captured at acquire time is all there is.
+    //
+    // The runtime's handle table is not read directly: it is a non-exported static whose
+    // layout changes between Unity versions, and weak entries are hidden pointers the collector
+    // clears under its allocation lock, which il2cpp_gchandle_get_target takes for us. Instead
+    // the answer is kept for the rest of the frame.
+    static Unity::il2cppObject* GetObjectHandleTarget(ExplorerState& state, ObjectHandle handle)
+    {
+        const void* target = state.objectHandles.Target(handle, ImGui::GetFrameCount(), [](const WeakHandleTable::Slot& slot) -> const void*
+            {
+                if (slot.gcHandle)
+                    return IL2CPP::GCHandle::GetTarget(slot.gcHandle);
+
+                return slot.object;
+            });
+
+        return reinterpret_cast<Unity::il2cppObject*>(const_cast<void*>(target));
+    }
+
+    static Unity::CGameObject* ResolveGameObjectHandle(ExplorerState& state, ObjectHandle handle)
+    {
+        Unity::il2cppObject* object = GetObjectHandleTarget(state, handle);
+        if (!object || !SafeIsNativeObjectAlive(object))
+            return nullptr;
+
+        return reinterpret_cast<Unity::CGameObject*>(object);
+    }
+
+    static ObjectHandle AcquireObjectHandle(ExplorerState& state, void* object)
+    {
+        if (!object)
+            return 0;
+
+        WeakHandleTable& table = state.objectHandles;
+        if (const ObjectHandle existing = table.Find(object))
+        {
+            if (GetObjectHandleTarget(state, existing) == object)
+                return existing;
+
+            // The address was reused by a different object after the old one was collected.
+            IL2CPP::GCHandle::Free(table.Remove(existing));
+        }
+
+        const uint32_t gcHandle = IL2CPP::GCHandle::NewWeakRef(object, false);
+        const ObjectHandle handle = table.Add(object, gcHandle);
+        if (!handle)
+            IL2CPP::GCHandle::Free(gcHandle);
+
+        return handle;
+    }
+
+    // Handles are few (selection, history, reference previews), so they are swept on refresh
+    // rather than reference counted.
+    static void ReleaseUnreferencedObjectHandles(ExplorerState& state)
+    {
+        std::unordered_set<ObjectHandle> referenced;
+        referenced.insert(state.selectedHandle);
+        referenced.insert(state.transformEditTarget);
+        for (const NavigationEntry& entry : state.navigationHistory)
+            referenced.insert(entry.handle);
+        for (const auto& [key, preview] : state.fieldReferencePreviews)
+            referenced.insert(preview.handle);
+        for (const WatchEntry& watch : state.watches.entries)
+            referenced.insert(watch.handle);
+
+        std::vector<ObjectHandle> unreferenced;
+        state.objectHandles.ForEachHandle([&](ObjectHandle handle, const WeakHandleTable::Slot&)
+            {
+                if (referenced.find(handle) == referenced.end())
+                    unreferenced.emplace_back(handle);
+            });
+
+        for (ObjectHandle handle : unreferenced)
+            IL2CPP::GCHandle::Free(state.objectHandles.Remove(handle));
+    }
+
+    static bool SafeGetObjectInstanceId(ExplorerState& state, Unity::il2cppObject* object, int* outInstanceId)
+    {
+        if (outInstanceId)
+            *outInstanceId = 0;
+
+        if (!object || !outInstanceId || !state.fnObjectGetInstanceId)
+            return false;
+
+        __try
+        {
+            *outInstanceId = reinterpret_cast<int(UNITY_CALLING_CONVENTION)(void*)>(
+                state.fnObjectGetInstanceId)(object);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    static bool SafeCollectComponents(ExplorerState& state, Unity::CGameObject* gameObject, ComponentSnapshot* outSnapshot)
+    {
+        *outSnapshot = ComponentSnapshot{};
+
+        Unity::il2cppObject* componentType = GetComponentSystemType();
+        if (!gameObject || !componentType)
+            return false;
+
+        Unity::il2cppObject* ownerObject = reinterpret_cast<Unity::il2cppObject*>(gameObject);
+        SafeReadUnityObjectCachedPtr(ownerObject, &outSnapshot->ownerCachedPtr);
+        SafeGetObjectInstanceId(state, ownerObject, &outSnapshot->ownerInstanceId);
+
+        Unity::il2cppArray<Unity::CComponent*>* components = SafeGetComponents(gameObject, componentType);
+        if (!components)
+            return false;
+
+        for (uintptr_t i = 0; i < components->m_uMaxLength; ++i)
+        {
+            Unity::CComponent* component = SafeArrayGetComponent(components, static_cast<unsigned int>(i));
+            Unity::il2cppObject* componentObject = reinterpret_cast<Unity::il2cppObject*>(component);
+
+            Unity::il2cppClass* componentClass = nullptr;
+            if (!SafeReadObjectClass(componentObject, &componentClass) || !componentClass)
+                continue;
+
+            void* cachedPtr = nullptr;
+            SafeReadUnityObjectCachedPtr(componentObject, &cachedPtr);
+
+            int instanceId = 0;
+            SafeGetObjectInstanceId(state, componentObject, &instanceId);
+
+            outSnapshot->components.emplace_back(component);
+            outSnapshot->classes.emplace_back(componentClass);
+            outSnapshot->cachedPtrs.emplace_back(cachedPtr);
+            outSnapshot->instanceIds.emplace_back(instanceId);
+        }
+
+        return true;
+    }
+
+    static bool SafeReadClassMetadata(
+        Unity::il2cppClass* klass,
+        const char** outName,
+        const char** outNamespace,
+        Unity::il2cppClass** outParent)
+    {
+        if (outName) *outName = nullptr;
+        if (outNamespace) *outNamespace = nullptr;
+        if (outParent) *outParent = nullptr;
+
+        if (!klass)
+            return false;
+
+        __try
+        {
+            if (outName) *outName = klass->m_pName;
+            if (outNamespace) *outNamespace = klass->m_pNamespace;
+            if (outParent) *outParent = klass->m_pParentClass;
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    static bool SafeCopyAsciiLabel(const char* source, char* destination, size_t destinationSize)
+    {
+        if (!destination || destinationSize == 0)
+            return false;
+
+        destination[0] = '\0';
         if (!source)
             return false;
 
@@ -1166,94 +2073,372 @@ namespace UExplorer
         if (!object)
             return nullptr;
 
+        auto lookupOwner = [&](const auto& map, const auto& key) -> Unity::CGameObject*
+            {
+                auto it = map.find(key);
+                if (it == map.end() || it->second >= state.objects.size())
+                    return nullptr;
+
+                return state.objects[it->second].gameObject;
+            };
+
+        if (Unity::CGameObject* owner = lookupOwner(state.ownerByManagedObject, object))
+            return owner;
+
+        // A different managed wrapper can still point at a cached native object; only trust
+        // m_CachedPtr and GetInstanceID on things that really derive from UnityEngine.Object.
         Unity::il2cppClass* objectClass = nullptr;
         if (!SafeReadObjectClass(object, &objectClass) || !objectClass)
             return nullptr;
 
-        const bool isUnityObject = IsClassOrParent(objectClass, "UnityEngine", "Object");
-        if (!isUnityObject)
+        if (!IsClassOrParent(objectClass, "UnityEngine", "Object"))
             return nullptr;
 
-        const bool isGameObject = IsClassOrParent(objectClass, "UnityEngine", "GameObject");
-        const bool isComponent = IsClassOrParent(objectClass, "UnityEngine", "Component");
-
         void* targetCachedPtr = nullptr;
-        const bool hasTargetCachedPtr = SafeReadUnityObjectCachedPtr(object, &targetCachedPtr) && (targetCachedPtr != nullptr);
+        if (SafeReadUnityObjectCachedPtr(object, &targetCachedPtr) && targetCachedPtr)
+        {
+            if (Unity::CGameObject* owner = lookupOwner(state.ownerByCachedPtr, targetCachedPtr))
+                return owner;
+        }
 
-        int targetInstanceId = 0;
-        const bool hasTargetInstanceId = SafeGetObjectInstanceId(state, object, &targetInstanceId) && (targetInstanceId != 0);
+        // Components of objects whose snapshots are not filled yet are not in the lookups, but
+        // their GameObject is: one get_gameObject settles it.
+        if (IsClassOrParent(objectClass, "UnityEngine", "Component"))
+        {
+            Unity::CGameObject* gameObject = SafeGetComponentGameObject(reinterpret_cast<Unity::CComponent*>(object));
+            if (Unity::CGameObject* owner = lookupOwner(state.ownerByManagedObject, gameObject))
+                return owner;
 
-        Unity::CGameObject* asGameObject = reinterpret_cast<Unity::CGameObject*>(object);
-        if (isGameObject && state.aliveObjects.find(asGameObject) != state.aliveObjects.end())
-            return asGameObject;
+            void* ownerCachedPtr = nullptr;
+            if (gameObject && SafeReadUnityObjectCachedPtr(reinterpret_cast<Unity::il2cppObject*>(gameObject), &ownerCachedPtr) && ownerCachedPtr)
+            {
+                if (Unity::CGameObject* owner = lookupOwner(state.ownerByCachedPtr, ownerCachedPtr))
+                    return owner;
+            }
+        }
 
-        if (isGameObject)
+        int targetInstanceId = 0;
+        if (SafeGetObjectInstanceId(state, object, &targetInstanceId) && targetInstanceId != 0)
         {
-            for (const ObjectEntry& entry : state.objects)
-            {
-                Unity::CGameObject* gameObject = entry.gameObject;
-                if (!gameObject)
-                    continue;
+            if (Unity::CGameObject* owner = lookupOwner(state.ownerByInstanceId, targetInstanceId))
+                return owner;
+        }
 
-                if (gameObject == asGameObject)
-                    return gameObject;
+        return nullptr;
+    }
 
-                if (hasTargetCachedPtr && gameObject->m_CachedPtr == targetCachedPtr)
-                    return gameObject;
+    // Changes whenever anything a cached path resolution depends on may have moved.
+    static uint64_t GetHierarchyStamp(const ExplorerState& state)
+    {
+        return state.sceneCacheGeneration + state.objectCacheGeneration + state.lazyTree.version;
+    }
 
-                if (hasTargetInstanceId && state.fnObjectGetInstanceId)
-                {
-                    const int candidateId = GetInstanceId(state, gameObject);
-                    if (candidateId == targetInstanceId)
-                        return gameObject;
-                }
+    static const SceneEntry* FindSceneByRoot(const ExplorerState& state, Unity::CGameObject* root)
+    {
+        for (const SceneEntry& scene : state.scenes)
+        {
+            for (Unity::CGameObject* sceneRoot : scene.roots)
+            {
+                if (sceneRoot == root)
+                    return &scene;
             }
         }
 
-        if (!isComponent)
-            return nullptr;
-
-        Unity::il2cppObject* componentType = IL2CPP::SystemTypeCache::Get(UNITY_COMPONENT_CLASS);
-        if (!componentType)
-            componentType = IL2CPP::Class::GetSystemType(UNITY_COMPONENT_CLASS);
-        if (!componentType)
-            return nullptr;
+        return nullptr;
+    }
 
-        for (const ObjectEntry& entry : state.objects)
+    static bool AssignSceneSegment(const ExplorerState& state, int sceneHandle, ObjectPathSegment* outSegment)
+    {
+        for (size_t i = 0; sceneHandle != 0 && i < state.scenes.size(); ++i)
         {
-            Unity::CGameObject* gameObject = entry.gameObject;
-            if (!gameObject)
+            if (state.scenes[i].scene.m_Handle != sceneHandle)
                 continue;
 
-            Unity::il2cppArray<Unity::CComponent*>* components = SafeGetComponents(gameObject, componentType);
-            if (!components)
-                continue;
+            uint32_t ordinal = 0;
+            for (size_t j = 0; j < i; ++j)
+                ordinal += (state.scenes[j].name == state.scenes[i].name) ? 1U : 0U;
+
+            outSegment->name = state.scenes[i].name;
+            outSegment->ordinal = ordinal;
+            return true;
+        }
+
+        return false;
+    }
+
+    // Scene segment first, from cached names and the ordinals AssignPathOrdinals stored.
+    // Returns false (with an unnamed scene segment) when the root is under no listed scene.
+    static bool BuildCachedPathSegments(const ExplorerState& state, uint32_t id, std::vector<ObjectPathSegment>* outSegments)
+    {
+        const HierarchyLayout& layout = state.hierarchyLayout;
+        outSegments->clear();
+        outSegments->emplace_back();
+        for (uint32_t pos = layout.position[id]; pos != kInvalidIndex; pos = layout.parent[pos])
+        {
+            const ObjectEntry& entry = state.objects[layout.order[pos]];
+            outSegments->push_back({ entry.name, entry.pathOrdinal });
+        }
+        std::reverse(outSegments->begin() + 1, outSegments->end());
+
+        return AssignSceneSegment(state, state.objects[id].sceneHandle, &outSegments->front());
+    }
+
+    // Lazy-mode counterpart. Gives up as soon as a parent's cached child list is out of date or
+    // filtered, or a root is not in the lazy tree; the caller then walks the live hierarchy.
+    static bool BuildLazyPathSegments(const ExplorerState& state, Unity::CGameObject* gameObject, std::vector<ObjectPathSegment>* outSegments)
+    {
+        const LazyHierarchyCache& lazy = state.lazyTree;
+        auto nodeIt = lazy.nodeByObject.find(gameObject);
+        if (nodeIt == lazy.nodeByObject.end())
+            return false;
 
-            for (uintptr_t i = 0; i < components->m_uMaxLength; ++i)
+        outSegments->clear();
+        uint32_t index = nodeIt->second;
+        for (int depth = 0; depth < 512; ++depth)
+        {
+            const LazyHierarchyNode& node = lazy.nodes[index];
+            uint32_t ordinal = 0;
+            if (node.parent == kInvalidIndex)
             {
-                Unity::CComponent* component = SafeArrayGetComponent(components, static_cast<unsigned int>(i));
-                if (!component)
-                    continue;
+                const SceneEntry* scene = FindSceneByRoot(state, node.gameObject);
+                if (!scene)
+                    return false;
+
+                for (Unity::CGameObject* root : scene->roots)
+                {
+                    if (root == node.gameObject)
+                        break;
+
+                    auto rootIt = lazy.nodeByObject.find(root);
+                    if (rootIt == lazy.nodeByObject.end())
+                        return false;
+                    if (lazy.nodes[rootIt->second].name == node.name)
+                        ++ordinal;
+                }
+
+                outSegments->push_back({ node.name, ordinal });
+                outSegments->emplace_back();
+                if (!AssignSceneSegment(state, scene->scene.m_Handle, &outSegments->back()))
+                    return false;
+
+                std::reverse(outSegments->begin(), outSegments->end());
+                return true;
+            }
+
+            const LazyHierarchyNode& parent = lazy.nodes[node.parent];
+            if (parent.childrenVersion != lazy.version || parent.children.size() != static_cast<size_t>(parent.childCount))
+                return false;
+
+            for (uint32_t sibling : parent.children)
+            {
+                if (lazy.nodes[sibling].siblingIndex < node.siblingIndex && lazy.nodes[sibling].name == node.name)
+                    ++ordinal;
+            }
+
+            outSegments->push_back({ node.name, ordinal });
+            index = node.parent;
+        }
+
+        return false;
+    }
+
+    // Canonical "Scene/Root/Child[1]/Leaf" path, the same format the path: query matches.
+    // Ordinals count earlier siblings with the same name, so the path survives reloads as long
+    // as names and sibling order do. Objects that are not under a listed scene (e.g.
+    // DontDestroyOnLoad) have no path.
+    static std::string BuildObjectPath(ExplorerState& state, Unity::CGameObject* gameObject)
+    {
+        std::vector<ObjectPathSegment> cached;
+        bool fromCache = false;
+        if (!state.objectCacheStale)
+        {
+            auto indexIt = state.indexByTransform.find(SafeGetTransform(gameObject));
+            if (indexIt != state.indexByTransform.end() && state.objects[indexIt->second].gameObject == gameObject)
+            {
+                if (!BuildCachedPathSegments(state, static_cast<uint32_t>(indexIt->second), &cached))
+                    return {};
+                fromCache = true;
+            }
+        }
+
+        if (fromCache || (state.lazyHierarchy && BuildLazyPathSegments(state, gameObject, &cached)))
+        {
+            std::string path;
+            for (const ObjectPathSegment& segment : cached)
+                AppendObjectPathSegment(&path, segment.name, segment.ordinal);
+            return path;
+        }
 
-                if (reinterpret_cast<Unity::il2cppObject*>(component) == object)
-                    return gameObject;
+        // Not in either cache: walk the live hierarchy.
+        std::vector<std::pair<std::string, uint32_t>> segments;
+        bool reachedScene = false;
 
-                if (hasTargetCachedPtr && component->m_CachedPtr == targetCachedPtr)
-                    return gameObject;
+        Unity::CGameObject* currentObject = gameObject;
+        Unity::CTransform* current = SafeGetTransform(gameObject);
+        for (int depth = 0; current && depth < 512; ++depth)
+        {
+            std::string name = SafeGetObjectName(currentObject);
+            uint32_t ordinal = 0;
+
+            Unity::CTransform* parent = SafeGetParent(current);
+            if (!parent)
+            {
+                const SceneEntry* scene = FindSceneByRoot(state, currentObject);
+                if (!scene)
+                    return {};
 
-                if (hasTargetInstanceId)
+                for (Unity::CGameObject* root : scene->roots)
                 {
-                    int componentInstanceId = 0;
-                    if (SafeGetObjectInstanceId(state, reinterpret_cast<Unity::il2cppObject*>(component), &componentInstanceId))
-                    {
-                        if (componentInstanceId == targetInstanceId)
-                            return gameObject;
-                    }
+                    if (root == currentObject)
+                        break;
+                    if (SafeGetObjectName(root) == name)
+                        ++ordinal;
+                }
+
+                segments.emplace_back(std::move(name), ordinal);
+
+                uint32_t sceneOrdinal = 0;
+                for (const SceneEntry& other : state.scenes)
+                {
+                    if (&other == scene)
+                        break;
+                    if (other.name == scene->name)
+                        ++sceneOrdinal;
                 }
+
+                segments.emplace_back(scene->name, sceneOrdinal);
+                reachedScene = true;
+                break;
+            }
+
+            const int childCount = SafeGetChildCount(parent);
+            for (int i = 0; i < childCount; ++i)
+            {
+                Unity::CTransform* sibling = SafeGetChild(parent, i);
+                if (sibling == current)
+                    break;
+                if (SafeGetObjectName(SafeGetTransformGameObject(sibling)) == name)
+                    ++ordinal;
             }
+
+            segments.emplace_back(std::move(name), ordinal);
+            current = parent;
+            currentObject = SafeGetTransformGameObject(parent);
         }
 
-        return nullptr;
+        if (!reachedScene)
+            return {};
+
+        std::string path;
+        for (auto it = segments.rbegin(); it != segments.rend(); ++it)
+            AppendObjectPathSegment(&path, it->first, it->second);
+
+        return path;
+    }
+
+    // Depth 0 handles are scene handles; deeper ones are GameObject pointers.
+    static Unity::CGameObject* ResolveObjectPath(ExplorerState& state, const std::string& path)
+    {
+        std::vector<ObjectPathSegment> segments;
+        if (!ParseObjectPath(path, &segments) || segments.size() < 2U)
+            return nullptr;
+
+        auto findScene = [&](uintptr_t handle) -> const SceneEntry*
+            {
+                for (const SceneEntry& scene : state.scenes)
+                {
+                    if (static_cast<uintptr_t>(static_cast<uint32_t>(scene.scene.m_Handle)) == handle)
+                        return &scene;
+                }
+
+                return nullptr;
+            };
+
+        auto validate = [&](size_t depth, uintptr_t parent, uintptr_t handle, const ObjectPathSegment& segment) -> bool
+            {
+                if (depth == 0)
+                {
+                    const SceneEntry* scene = findScene(handle);
+                    return scene && scene->name == segment.name;
+                }
+
+                Unity::CGameObject* gameObject = reinterpret_cast<Unity::CGameObject*>(handle);
+                Unity::CTransform* transform = SafeGetTransform(gameObject);
+                if (!transform || SafeGetObjectName(gameObject) != segment.name)
+                    return false;
+
+                Unity::CTransform* actualParent = SafeGetParent(transform);
+                if (depth == 1)
+                    return !actualParent && FindSceneByRoot(state, gameObject) == findScene(parent);
+
+                return actualParent && actualParent == SafeGetTransform(reinterpret_cast<Unity::CGameObject*>(parent));
+            };
+
+        auto resolveChild = [&](size_t depth, uintptr_t parent, const ObjectPathSegment& segment) -> uintptr_t
+            {
+                uint32_t seen = 0;
+                if (depth == 0)
+                {
+                    for (const SceneEntry& scene : state.scenes)
+                    {
+                        if (scene.name == segment.name && seen++ == segment.ordinal)
+                            return static_cast<uintptr_t>(static_cast<uint32_t>(scene.scene.m_Handle));
+                    }
+
+                    return 0;
+                }
+
+                if (depth == 1)
+                {
+                    const SceneEntry* scene = findScene(parent);
+                    if (!scene)
+                        return 0;
+
+                    for (Unity::CGameObject* root : scene->roots)
+                    {
+                        if (SafeGetObjectName(root) == segment.name && seen++ == segment.ordinal)
+                            return reinterpret_cast<uintptr_t>(root);
+                    }
+
+                    return 0;
+                }
+
+                Unity::CTransform* parentTransform = SafeGetTransform(reinterpret_cast<Unity::CGameObject*>(parent));
+                const int childCount = SafeGetChildCount(parentTransform);
+                for (int i = 0; i < childCount; ++i)
+                {
+                    Unity::CGameObject* child = SafeGetTransformGameObject(SafeGetChild(parentTransform, i));
+                    if (child && SafeGetObjectName(child) == segment.name && seen++ == segment.ordinal)
+                        return reinterpret_cast<uintptr_t>(child);
+                }
+
+                return 0;
+            };
+
+        return reinterpret_cast<Unity::CGameObject*>(
+            state.pathTrie.Resolve(segments, GetHierarchyStamp(state), validate, resolveChild));
+    }
+
+    static void AssignSelection(ExplorerState& state, Unity::CGameObject* targetObject, std::string path)
+    {
+        state.selectedHandle = AcquireObjectHandle(state, targetObject);
+        state.selectedObject = state.selectedHandle ? targetObject : nullptr;
+        state.selectedPath = std::move(path);
+        state.transformEditTarget = 0;
+        state.memberRowHeights.clear();
+        state.watches.pathDrafts.clear();
+        if (state.selectedObject)
+            EnsureObjectComponents(state, state.selectedObject);
+    }
+
+    static void ClearSelection(ExplorerState& state)
+    {
+        state.selectedHandle = 0;
+        state.selectedObject = nullptr;
+        state.selectedPath.clear();
+        state.transformEditTarget = 0;
+        state.memberRowHeights.clear();
+        state.watches.pathDrafts.clear();
     }
 
     static void SelectObjectDirect(ExplorerState& state, Unity::CGameObject* targetObject)
@@ -1262,8 +2447,7 @@ namespace UExplorer
             return;
 
         state.navigationHistory.clear();
-        state.selectedObject = targetObject;
-        state.transformEditTarget = nullptr;
+        AssignSelection(state, targetObject, BuildObjectPath(state, targetObject));
     }
 
     static void NavigateToReferencedObject(ExplorerState& state, Unity::CGameObject* targetObject)
@@ -1271,23 +2455,50 @@ namespace UExplorer
         if (!targetObject)
             return;
 
-        if (state.selectedObject && state.selectedObject != targetObject)
-            state.navigationHistory.emplace_back(state.selectedObject);
+        if (state.selectedHandle && state.selectedObject != targetObject)
+            state.navigationHistory.push_back({ state.selectedHandle, state.selectedPath });
+
+        AssignSelection(state, targetObject, BuildObjectPath(state, targetObject));
+    }
+
+    // A selection that died with a reload is looked up again by path, once per hierarchy change.
+    static bool TryRecoverSelectionByPath(ExplorerState& state)
+    {
+        if (state.selectedPath.empty())
+            return false;
+
+        const uint64_t stamp = GetHierarchyStamp(state);
+        if (stamp == state.selectedPathRetryStamp)
+            return false;
+
+        state.selectedPathRetryStamp = stamp;
+        Unity::CGameObject* recovered = ResolveObjectPath(state, state.selectedPath);
+        if (!recovered || !SafeIsNativeObjectAlive(reinterpret_cast<Unity::il2cppObject*>(recovered)))
+            return false;
 
-        state.selectedObject = targetObject;
-        state.transformEditTarget = nullptr;
+        AssignSelection(state, recovered, std::move(state.selectedPath));
+        HBLog::Printf("[UExplorer] Selection re-resolved by path: %s\n", state.selectedPath.c_str());
+        return true;
     }
 
     static bool NavigateBack(ExplorerState& state)
     {
         while (!state.navigationHistory.empty())
         {
-            Unity::CGameObject* previous = state.navigationHistory.back();
+            NavigationEntry entry = std::move(state.navigationHistory.back());
             state.navigationHistory.pop_back();
-            if (previous && state.aliveObjects.find(previous) != state.aliveObjects.end())
+
+            Unity::CGameObject* previous = ResolveGameObjectHandle(state, entry.handle);
+            if (!previous && !entry.path.empty())
+            {
+                previous = ResolveObjectPath(state, entry.path);
+                if (previous && !SafeIsNativeObjectAlive(reinterpret_cast<Unity::il2cppObject*>(previous)))
+                    previous = nullptr;
+            }
+
+            if (previous)
             {
-                state.selectedObject = previous;
-                state.transformEditTarget = nullptr;
+                AssignSelection(state, previous, std::move(entry.path));
                 HBLog::Printf("[UExplorer] Navigate back -> %s\n", SafeGetObjectName(previous).c_str());
                 return true;
             }
@@ -1611,7 +2822,7 @@ namespace UExplorer
 
     static void SyncTransformEditor(ExplorerState& state, Unity::CGameObject* gameObject)
     {
-        state.transformEditTarget = gameObject;
+        state.transformEditTarget = state.objectHandles.Find(gameObject);
 
         if (!gameObject)
             return;
@@ -1661,10 +2872,26 @@ namespace UExplorer
             SceneEntry entry{};
             entry.scene = scene;
 
-            char labelBuffer[64]{};
-            std::snprintf(labelBuffer, sizeof(labelBuffer), "Scene %d [handle=%d]", i, scene.m_Handle);
+            const std::string sceneName = UnityStringToUtf8(SafeGetSceneNameRaw(scene));
+            char labelBuffer[160]{};
+            if (!sceneName.empty())
+                std::snprintf(labelBuffer, sizeof(labelBuffer), "%s [handle=%d]", sceneName.c_str(), scene.m_Handle);
+            else
+                std::snprintf(labelBuffer, sizeof(labelBuffer), "Scene %d [handle=%d]", i, scene.m_Handle);
+            entry.name = sceneName;
             entry.label = labelBuffer;
 
+            if (Unity::il2cppArray<Unity::CGameObject*>* roots = SafeGetSceneRoots(scene))
+            {
+                entry.rootsResolved = true;
+                entry.roots.reserve(static_cast<size_t>(roots->m_uMaxLength));
+                for (uintptr_t r = 0; r < roots->m_uMaxLength; ++r)
+                {
+                    if (Unity::CGameObject* root = SafeArrayGetGameObject(roots, static_cast<unsigned int>(r)))
+                        entry.roots.emplace_back(root);
+                }
+            }
+
             state.scenes.emplace_back(std::move(entry));
         }
 
@@ -1684,1107 +2911,5689 @@ namespace UExplorer
         if (!selectedSceneExists)
             state.selectedSceneHandle = 0;
 
+        state.activeSceneHandle = SafeGetActiveSceneHandle();
+
         if (state.lastSceneCountLogged != sceneCount)
         {
             HBLog::Printf("[UExplorer] Scene cache refreshed: %d scene(s).\n", sceneCount);
             state.lastSceneCountLogged = sceneCount;
         }
 
+        ++state.sceneCacheGeneration;
         state.lastSceneRefreshTick = GetTickCount64();
     }
 
-    static void RefreshObjectCache(ExplorerState& state)
+    static void SyncHierarchyExpansion(ExplorerState& state)
     {
-        state.objects.clear();
-        state.indexByTransform.clear();
-        state.rootTransforms.clear();
-        state.aliveObjects.clear();
-        state.classBlobCacheLower.clear();
-
-        Unity::il2cppArray<Unity::CGameObject*>* allGameObjects = SafeFindGameObjects(state.includeInactive);
-
-        if (!allGameObjects)
-        {
-            state.lastObjectRefreshTick = GetTickCount64();
-            return;
-        }
-
-        state.objects.reserve(static_cast<size_t>(allGameObjects->m_uMaxLength));
+        HierarchyViewCache& view = state.hierarchyView;
+        const HierarchyLayout& layout = state.hierarchyLayout;
 
-        for (uintptr_t i = 0; i < allGameObjects->m_uMaxLength; ++i)
+        view.expanded.Resize(layout.Size());
+        for (auto it = view.expandedTransforms.begin(); it != view.expandedTransforms.end();)
         {
-            const unsigned int idx = static_cast<unsigned int>(i);
-            Unity::CGameObject* gameObject = SafeArrayGetGameObject(allGameObjects, idx);
-            if (!gameObject)
-                continue;
+            auto indexIt = state.indexByTransform.find(*it);
+            const uint32_t pos = (indexIt != state.indexByTransform.end())
+                ? layout.position[indexIt->second]
+                : kInvalidIndex;
 
-            Unity::CTransform* transform = SafeGetTransform(gameObject);
-            if (!transform)
+            if (pos == kInvalidIndex)
+            {
+                it = view.expandedTransforms.erase(it);
                 continue;
+            }
 
-            ObjectEntry entry{};
-            entry.gameObject = gameObject;
-            entry.transform = transform;
-            entry.parent = SafeGetParent(transform);
-            entry.sceneHandle = GetSceneHandleForGameObject(state, gameObject);
-            entry.name = SafeGetObjectName(gameObject);
-            entry.nameLower = ToLowerCopy(entry.name);
-
-            state.aliveObjects.insert(gameObject);
-            state.indexByTransform[entry.transform] = state.objects.size();
-            state.objects.emplace_back(std::move(entry));
+            view.expanded.Set(pos);
+            ++it;
         }
 
-        state.rootTransforms.clear();
-        for (size_t i = 0; i < state.objects.size(); ++i)
+        view.groupExpanded.Resize(layout.Size());
+        for (auto it = view.expandedGroups.begin(); it != view.expandedGroups.end();)
         {
-            ObjectEntry& entry = state.objects[i];
-            auto parentIt = state.indexByTransform.find(entry.parent);
-            if (entry.parent && parentIt != state.indexByTransform.end())
-            {
-                state.objects[parentIt->second].children.emplace_back(entry.transform);
-            }
-            else
+            auto indexIt = state.indexByTransform.find(*it);
+            const uint32_t pos = (indexIt != state.indexByTransform.end())
+                ? layout.position[indexIt->second]
+                : kInvalidIndex;
+
+            if (pos == kInvalidIndex || state.siblingGroups.runLength[pos] == 0)
             {
-                state.rootTransforms.emplace_back(entry.transform);
+                it = view.expandedGroups.erase(it);
+                continue;
             }
+
+            view.groupExpanded.Set(pos);
+            ++it;
         }
 
-        auto nameLess = [&](Unity::CTransform* left, Unity::CTransform* right)
-            {
-                auto l = state.indexByTransform.find(left);
-                auto r = state.indexByTransform.find(right);
-                if (l == state.indexByTransform.end() || r == state.indexByTransform.end())
-                    return left < right;
+        view.rowsDirty = true;
+    }
 
-                return _stricmp(state.objects[l->second].name.c_str(), state.objects[r->second].name.c_str()) < 0;
-            };
+    static constexpr size_t kComponentRescanPerRefresh = 1024U;
 
-        std::sort(state.rootTransforms.begin(), state.rootTransforms.end(), nameLess);
-        for (ObjectEntry& entry : state.objects)
-            std::sort(entry.children.begin(), entry.children.end(), nameLess);
+    // Past objects / kComponentRebuildDivisor changed objects, patching the sorted postings one
+    // id at a time costs more than rebuilding them.
+    static constexpr size_t kComponentRebuildDivisor = 8U;
+    static constexpr double kComponentFillBudgetMicros = 1000.0;
+    static constexpr ULONGLONG kComponentPublishIntervalMs = 250;
 
-        if (state.selectedObject && state.aliveObjects.find(state.selectedObject) == state.aliveObjects.end())
-        {
-            state.selectedObject = nullptr;
-            state.transformEditTarget = nullptr;
-        }
+    // Type-index slots for a class and all of its parents, resolved once per class.
+    static const std::vector<uint32_t>& GetClassChainSlots(ExplorerState& state, Unity::il2cppClass* klass)
+    {
+        auto it = state.classChainSlots.find(klass);
+        if (it != state.classChainSlots.end())
+            return it->second;
 
-        if (state.lastObjectCountLogged != state.objects.size())
+        std::vector<uint32_t> slots;
+        Unity::il2cppClass* current = klass;
+        for (int depth = 0; depth < 64 && current; ++depth)
         {
-            HBLog::Printf("[UExplorer] Object cache refreshed: %zu object(s).\n", state.objects.size());
-            state.lastObjectCountLogged = state.objects.size();
-        }
+            const char* unusedName = nullptr;
+            const char* unusedNamespace = nullptr;
+            Unity::il2cppClass* parent = nullptr;
+            if (!SafeReadClassMetadata(current, &unusedName, &unusedNamespace, &parent))
+                break;
 
-        state.lastObjectRefreshTick = GetTickCount64();
-    }
+            slots.emplace_back(state.componentTypeIndex.Intern(current, [&]()
+                {
+                    return ToLowerCopy(GetClassDisplayName(current));
+                }));
 
-    static void ForceRefresh(ExplorerState& state)
-    {
-        RefreshSceneCache(state);
-        RefreshObjectCache(state);
+            if (parent == current)
+                break;
+            current = parent;
+        }
+
+        return state.classChainSlots.emplace(klass, std::move(slots)).first->second;
     }
 
-    static void TickRefresh(ExplorerState& state)
+    static uint64_t HashComponentClass(Unity::il2cppClass* componentClass)
     {
-        if (!state.fnObjectGetInstanceId)
-            ResolveRuntimeMethods(state);
-
-        if (!state.autoRefresh)
-            return;
-
-        const ULONGLONG now = GetTickCount64();
-        if ((now - state.lastSceneRefreshTick) >= state.refreshIntervalMs)
-            RefreshSceneCache(state);
-
-        if ((now - state.lastObjectRefreshTick) >= state.refreshIntervalMs)
-            RefreshObjectCache(state);
+        uint64_t value = reinterpret_cast<uintptr_t>(componentClass);
+        value ^= value >> 31;
+        value *= 0x7FB5D329728EA185ULL;
+        value ^= value >> 27;
+        return value;
     }
 
-    static bool SceneFilterPasses(const ExplorerState& state, const ObjectEntry& entry)
+    static uint64_t ComputeComponentSignature(const ComponentSnapshot& snapshot)
     {
-        if (state.selectedSceneHandle == 0 || entry.sceneHandle == 0)
-            return true;
+        // Summing per-class hashes keeps the signature independent of component order.
+        uint64_t signature = snapshot.classes.size();
+        for (Unity::il2cppClass* componentClass : snapshot.classes)
+            signature += HashComponentClass(componentClass);
 
-        return entry.sceneHandle == state.selectedSceneHandle;
+        return signature;
     }
 
-    static bool ContainsLower(const std::string& haystackLower, const std::string& needleLower)
+    static void CollectComponentSnapshot(ExplorerState& state, Unity::CGameObject* gameObject, ComponentSnapshot* snapshot)
     {
-        if (needleLower.empty())
-            return true;
-
-        return haystackLower.find(needleLower) != std::string::npos;
+        const int layer = snapshot->layer;
+        const uint32_t indexedId = snapshot->indexedId;
+        const uint64_t seenGeneration = snapshot->seenGeneration;
+        SafeCollectComponents(state, gameObject, snapshot);
+        snapshot->signature = ComputeComponentSignature(*snapshot);
+        snapshot->layer = layer;
+        snapshot->indexedId = indexedId;
+        snapshot->seenGeneration = seenGeneration;
+        snapshot->collected = true;
     }
 
-    static bool HierarchyNodeVisibleRecursive(
-        ExplorerState& state,
-        Unity::CTransform* transform,
-        const std::string& nameFilterLower,
-        std::unordered_map<Unity::CTransform*, bool>& visibilityCache)
+    // Folds one object's snapshot into the fingerprint, type postings and owner lookups.
+    static void AddComponentLookups(ExplorerState& state, uint32_t index, ComponentSnapshot& snapshot, bool sortedInsert)
     {
-        auto cacheIt = visibilityCache.find(transform);
-        if (cacheIt != visibilityCache.end())
-            return cacheIt->second;
+        snapshot.indexedId = index;
 
-        auto it = state.indexByTransform.find(transform);
-        if (it == state.indexByTransform.end())
+        ObjectEntry& entry = state.objects[index];
+        entry.fingerprint = MixFingerprint(entry.stemHash, snapshot.signature);
+        for (Unity::il2cppClass* componentClass : snapshot.classes)
         {
-            visibilityCache[transform] = false;
-            return false;
+            for (uint32_t slot : GetClassChainSlots(state, componentClass))
+            {
+                if (sortedInsert)
+                    state.componentTypeIndex.Insert(slot, index);
+                else
+                    state.componentTypeIndex.Add(slot, index);
+            }
         }
 
-        ObjectEntry& entry = state.objects[it->second];
-        const bool selfVisible = SceneFilterPasses(state, entry) && ContainsLower(entry.nameLower, nameFilterLower);
-        if (selfVisible)
-        {
-            visibilityCache[transform] = true;
-            return true;
-        }
+        state.ownerByManagedObject[entry.gameObject] = index;
+        if (snapshot.ownerCachedPtr)
+            state.ownerByCachedPtr[snapshot.ownerCachedPtr] = index;
+        if (snapshot.ownerInstanceId != 0)
+            state.ownerByInstanceId[snapshot.ownerInstanceId] = index;
 
-        for (Unity::CTransform* childTransform : entry.children)
+        for (size_t c = 0; c < snapshot.components.size(); ++c)
         {
-            if (HierarchyNodeVisibleRecursive(state, childTransform, nameFilterLower, visibilityCache))
-            {
-                visibilityCache[transform] = true;
-                return true;
-            }
+            state.ownerByManagedObject[snapshot.components[c]] = index;
+            if (snapshot.cachedPtrs[c])
+                state.ownerByCachedPtr[snapshot.cachedPtrs[c]] = index;
+            if (snapshot.instanceIds[c] != 0)
+                state.ownerByInstanceId[snapshot.instanceIds[c]] = index;
         }
-
-        visibilityCache[transform] = false;
-        return false;
     }
 
-    static void DrawHierarchyNode(
-        ExplorerState& state,
-        Unity::CTransform* transform,
-        const std::string& nameFilterLower,
-        std::unordered_map<Unity::CTransform*, bool>& visibilityCache)
+    // Takes down what AddComponentLookups posted for the snapshot's current contents. Owner
+    // entries are only erased while they still name the posted id; a component can have moved
+    // to another object since.
+    static void RemoveComponentLookups(ExplorerState& state, Unity::CGameObject* gameObject, ComponentSnapshot& snapshot)
     {
-        auto it = state.indexByTransform.find(transform);
-        if (it == state.indexByTransform.end())
+        const uint32_t id = snapshot.indexedId;
+        if (id == kInvalidIndex)
             return;
 
-        ObjectEntry& entry = state.objects[it->second];
-        if (!HierarchyNodeVisibleRecursive(state, transform, nameFilterLower, visibilityCache))
-            return;
-
-        ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick;
-        if (entry.children.empty())
-            flags |= ImGuiTreeNodeFlags_Leaf;
+        snapshot.indexedId = kInvalidIndex;
+        for (Unity::il2cppClass* componentClass : snapshot.classes)
+        {
+            for (uint32_t slot : GetClassChainSlots(state, componentClass))
+                state.componentTypeIndex.Remove(slot, id);
+        }
 
-        if (state.selectedObject == entry.gameObject)
-            flags |= ImGuiTreeNodeFlags_Selected;
+        auto eraseOwned = [id](auto& map, const auto& key)
+            {
+                auto it = map.find(key);
+                if (it != map.end() && it->second == id)
+                    map.erase(it);
+            };
 
-        const bool opened = ImGui::TreeNodeEx(reinterpret_cast<void*>(entry.transform), flags, "%s", entry.name.c_str());
-        if (ImGui::IsItemClicked(ImGuiMouseButton_Left))
-            SelectObjectDirect(state, entry.gameObject);
+        eraseOwned(state.ownerByManagedObject, gameObject);
+        if (snapshot.ownerCachedPtr)
+            eraseOwned(state.ownerByCachedPtr, snapshot.ownerCachedPtr);
+        if (snapshot.ownerInstanceId != 0)
+            eraseOwned(state.ownerByInstanceId, snapshot.ownerInstanceId);
 
-        if (opened)
+        for (size_t c = 0; c < snapshot.components.size(); ++c)
         {
-            for (Unity::CTransform* childTransform : entry.children)
-                DrawHierarchyNode(state, childTransform, nameFilterLower, visibilityCache);
-
-            ImGui::TreePop();
+            eraseOwned(state.ownerByManagedObject, snapshot.components[c]);
+            if (snapshot.cachedPtrs[c])
+                eraseOwned(state.ownerByCachedPtr, snapshot.cachedPtrs[c]);
+            if (snapshot.instanceIds[c] != 0)
+                eraseOwned(state.ownerByInstanceId, snapshot.instanceIds[c]);
         }
     }
 
-    static std::string BuildClassBlobLower(Unity::CGameObject* gameObject)
+    // From scratch, for the first refresh or one that changed too many ids to patch.
+    static void RebuildComponentLookups(ExplorerState& state)
     {
-        if (!gameObject)
-            return {};
+        const size_t objectCount = state.objects.size();
+        state.componentTypeIndex.ClearPostings();
+        state.ownerByManagedObject.clear();
+        state.ownerByCachedPtr.clear();
+        state.ownerByInstanceId.clear();
+        state.ownerByManagedObject.reserve(objectCount * 4U);
+        state.ownerByCachedPtr.reserve(objectCount * 4U);
+        state.ownerByInstanceId.reserve(objectCount * 4U);
 
-        Unity::il2cppObject* componentType = IL2CPP::SystemTypeCache::Get(UNITY_COMPONENT_CLASS);
-        if (!componentType)
-            componentType = IL2CPP::Class::GetSystemType(UNITY_COMPONENT_CLASS);
+        for (size_t i = 0; i < objectCount; ++i)
+        {
+            auto snapshotIt = state.componentsByObject.find(state.objects[i].gameObject);
+            if (snapshotIt != state.componentsByObject.end())
+                AddComponentLookups(state, static_cast<uint32_t>(i), snapshotIt->second, false);
+        }
+    }
 
-        if (!componentType)
-            return {};
+    // GetComponents is a managed call that allocates an array, so a refresh only asks again for
+    // a rotating slice of the fetched objects. New objects start with empty snapshots that
+    // TickComponentSnapshots fills over the next frames (a selection fetches its own at once).
+    // Lookups are patched for the objects whose id or components changed, all removals before
+    // any additions so an id that changed hands is never taken down after it was re-posted.
+    static void RefreshObjectLookups(ExplorerState& state)
+    {
+        const size_t objectCount = state.objects.size();
+        if (state.componentRescanCursor >= objectCount)
+            state.componentRescanCursor = 0;
 
-        Unity::il2cppArray<Unity::CComponent*>* components = SafeGetComponents(gameObject, componentType);
-        if (!components)
-            return {};
+        const size_t rescanBegin = state.componentRescanCursor;
+        const size_t rescanCount = std::min(kComponentRescanPerRefresh, objectCount);
+        state.componentRescanCursor = objectCount ? (rescanBegin + rescanCount) % objectCount : 0;
 
-        std::string classBlob;
-        for (uintptr_t i = 0; i < components->m_uMaxLength; ++i)
+        const uint64_t generation = state.objectCacheGeneration + 1; // the one this refresh publishes
+        const size_t repostLimit = objectCount / kComponentRebuildDivisor;
+        std::vector<std::pair<uint32_t, ComponentSnapshot*>> reposted;
+        bool rebuild = false;
+
+        state.pendingComponentSnapshots = 0;
+        for (size_t i = 0; i < objectCount; ++i)
         {
-            Unity::CComponent* component = components->operator[](static_cast<unsigned int>(i));
-            if (!component || !component->m_Object.m_pClass)
+            ObjectEntry& entry = state.objects[i];
+            auto [snapshotIt, inserted] = state.componentsByObject.try_emplace(entry.gameObject);
+            ComponentSnapshot& snapshot = snapshotIt->second;
+            snapshot.seenGeneration = generation;
+
+            const size_t rotated = (i + objectCount - rescanBegin) % objectCount;
+            const bool rescan = rotated < rescanCount;
+            if (inserted || rescan)
+                snapshot.layer = SafeGetLayer(entry.gameObject);
+
+            bool changed = snapshot.indexedId != i;
+            if (snapshot.collected && rescan)
+            {
+                ComponentSnapshot previous = snapshot;
+                CollectComponentSnapshot(state, entry.gameObject, &snapshot);
+                if (changed || previous.components != snapshot.components || previous.classes != snapshot.classes)
+                {
+                    changed = true;
+                    snapshot.indexedId = kInvalidIndex;
+                    if (!rebuild)
+                        RemoveComponentLookups(state, entry.gameObject, previous);
+                }
+            }
+            else if (changed && !rebuild)
+            {
+                RemoveComponentLookups(state, entry.gameObject, snapshot);
+            }
+
+            if (changed)
+            {
+                reposted.emplace_back(static_cast<uint32_t>(i), &snapshot);
+                rebuild = rebuild || reposted.size() > repostLimit;
+            }
+
+            if (!snapshot.collected || snapshot.stale)
+                ++state.pendingComponentSnapshots;
+            entry.fingerprint = MixFingerprint(entry.stemHash, snapshot.signature);
+        }
+
+        // Every survivor was seen above, so the rest of the map is gone.
+        rebuild = rebuild || reposted.size() + (state.componentsByObject.size() - objectCount) > repostLimit;
+        for (auto it = state.componentsByObject.begin(); it != state.componentsByObject.end();)
+        {
+            if (it->second.seenGeneration == generation)
+            {
+                ++it;
                 continue;
+            }
 
-            if (!classBlob.empty())
-                classBlob.push_back(' ');
+            if (!rebuild)
+                RemoveComponentLookups(state, it->first, it->second);
+            it = state.componentsByObject.erase(it);
+        }
 
-            classBlob += ToLowerCopy(GetClassDisplayName(component->m_Object.m_pClass));
+        if (rebuild)
+        {
+            RebuildComponentLookups(state);
+            return;
         }
 
-        return classBlob;
+        for (const auto& [id, snapshot] : reposted)
+            AddComponentLookups(state, id, *snapshot, true);
     }
 
-    static bool MatchesClassFilter(ExplorerState& state, Unity::CGameObject* gameObject, const std::string& classFilterLower)
+    struct CollectedObject
     {
-        if (classFilterLower.empty())
-            return true;
+        Unity::CGameObject* gameObject = nullptr;
+        Unity::CTransform* transform = nullptr;
+        Unity::CTransform* parent = nullptr;
+        int siblingIndex = -1; // -1 when collected in no particular order
+        int childCount = -1;   // live count, -1 when not read
+    };
 
-        auto cachedIt = state.classBlobCacheLower.find(gameObject);
-        if (cachedIt == state.classBlobCacheLower.end())
+    static const SceneEntry* FindSceneEntry(const ExplorerState& state, int sceneHandle)
+    {
+        for (const SceneEntry& scene : state.scenes)
         {
-            std::string classBlob = BuildClassBlobLower(gameObject);
-            cachedIt = state.classBlobCacheLower.emplace(gameObject, std::move(classBlob)).first;
+            if (scene.scene.m_Handle == sceneHandle)
+                return &scene;
         }
 
-        return ContainsLower(cachedIt->second, classFilterLower);
+        return nullptr;
     }
 
-    static void DrawSceneLoader(ExplorerState& state)
+    static bool CollectAllObjects(ExplorerState& state, std::vector<CollectedObject>* outObjects)
     {
-        ImGui::SeparatorText("Scene Loader");
-        ImGui::InputText("Scene name", state.sceneToLoad, IM_ARRAYSIZE(state.sceneToLoad));
+        Unity::il2cppArray<Unity::CGameObject*>* allGameObjects = SafeFindGameObjects(state.includeInactive);
+        if (!allGameObjects)
+            return false;
 
-        if (AnimatedButton("Load (Single)", ImVec2(-1.0f, 0.0f)))
+        outObjects->reserve(static_cast<size_t>(allGameObjects->m_uMaxLength));
+        for (uintptr_t i = 0; i < allGameObjects->m_uMaxLength; ++i)
         {
-            if (state.sceneToLoad[0] != '\0')
-            {
-                Unity::SceneManager::LoadScene(state.sceneToLoad, Unity::LoadSceneMode::Single);
-                HBLog::Printf("[UExplorer] LoadScene single: %s\n", state.sceneToLoad);
-                ForceRefresh(state);
-            }
+            Unity::CGameObject* gameObject = SafeArrayGetGameObject(allGameObjects, static_cast<unsigned int>(i));
+            if (!gameObject)
+                continue;
+
+            Unity::CTransform* transform = SafeGetTransform(gameObject);
+            if (!transform)
+                continue;
+
+            outObjects->push_back({ gameObject, transform, SafeGetParent(transform) });
         }
 
-        if (AnimatedButton("Load (Additive)", ImVec2(-1.0f, 0.0f)))
+        return true;
+    }
+
+    // Walks one scene top-down from its roots, so only that scene's objects are touched. An
+    // inactive object hides its whole subtree, matching FindObjectsOfType(includeInactive=false).
+    static void CollectSceneObjects(ExplorerState& state, const SceneEntry& scene, std::vector<CollectedObject>* outObjects)
+    {
+        std::vector<CollectedObject> stack;
+        stack.reserve(scene.roots.size() + 64U);
+        for (auto it = scene.roots.rbegin(); it != scene.roots.rend(); ++it)
         {
-            if (state.sceneToLoad[0] != '\0')
+            if (Unity::CTransform* transform = SafeGetTransform(*it))
+                stack.push_back({ *it, transform, nullptr });
+        }
+
+        while (!stack.empty())
+        {
+            const CollectedObject current = stack.back();
+            stack.pop_back();
+
+            if (!state.includeInactive && !SafeGetActiveSelf(current.gameObject))
+                continue;
+
+            const int childCount = SafeGetChildCount(current.transform);
+            outObjects->emplace_back(current);
+            outObjects->back().childCount = childCount;
+
+            for (int i = childCount - 1; i >= 0; --i)
             {
-                Unity::SceneManager::LoadScene(state.sceneToLoad, Unity::LoadSceneMode::Additive);
-                HBLog::Printf("[UExplorer] LoadScene additive: %s\n", state.sceneToLoad);
-                ForceRefresh(state);
+                Unity::CTransform* child = SafeGetChild(current.transform, i);
+                Unity::CGameObject* childObject = SafeGetTransformGameObject(child);
+                if (child && childObject)
+                    stack.push_back({ childObject, child, current.transform, i });
             }
         }
     }
 
-    static void DrawSceneExplorerTab(ExplorerState& state)
+    // Pre-order over layout positions [begin, end), so activeInHierarchy is the parent's value
+    // (read back from the index) AND activeSelf. Only objects whose attributes differ from what
+    // their id held touch a bitmap. Returns how many did.
+    static size_t SyncAttributeRange(ExplorerState& state, uint32_t begin, uint32_t end)
     {
-        ImGui::Checkbox("Auto refresh", &state.autoRefresh);
-        ImGui::SameLine();
-        if (ImGui::Checkbox("Include inactive", &state.includeInactive))
-            ForceRefresh(state);
+        const HierarchyLayout& layout = state.hierarchyLayout;
+        AttributeIndex& index = state.attributeIndex;
 
-        int refreshMs = static_cast<int>(state.refreshIntervalMs);
-        if (ImGui::SliderInt("Refresh (ms)", &refreshMs, 250, 5000))
-            state.refreshIntervalMs = static_cast<ULONGLONG>(refreshMs);
+        size_t changed = 0;
+        for (uint32_t pos = begin; pos < end; ++pos)
+        {
+            const uint32_t id = layout.order[pos];
+            const ObjectEntry& entry = state.objects[id];
+            const uint32_t parentPos = layout.parent[pos];
+            const bool active = entry.activeSelf && (parentPos == kInvalidIndex || index.IsActive(layout.order[parentPos]));
 
-        if (AnimatedButton("Refresh now"))
-            ForceRefresh(state);
+            auto snapshotIt = state.componentsByObject.find(entry.gameObject);
+            const int layer = (snapshotIt != state.componentsByObject.end()) ? snapshotIt->second.layer : -1;
+            changed += index.SetObject(id, active, entry.activeSelf, parentPos == kInvalidIndex, layer, layout.depth[pos]) ? 1U : 0U;
+        }
 
-        const char* selectedSceneLabel = "All scenes";
-        for (const SceneEntry& scene : state.scenes)
+        return changed;
+    }
+
+    // After a refresh most ids still name the same object with the same attributes, so the
+    // bitmaps are patched in place rather than rebuilt.
+    static void SyncAttributeIndex(ExplorerState& state)
+    {
+        state.attributeIndex.Resize(state.objects.size());
+        SyncAttributeRange(state, 0, state.hierarchyLayout.Size());
+    }
+
+    // An inspector edit of one object: its own attributes and, for activeSelf, the
+    // activeInHierarchy of its subtree. Cached filter results are dropped if anything moved.
+    static void SyncObjectAttributes(ExplorerState& state, Unity::CGameObject* gameObject, bool subtree)
+    {
+        auto ownerIt = state.ownerByManagedObject.find(gameObject);
+        if (state.objectCacheStale || ownerIt == state.ownerByManagedObject.end() || ownerIt->second >= state.objects.size())
+            return;
+
+        const HierarchyLayout& layout = state.hierarchyLayout;
+        const uint32_t pos = layout.position[ownerIt->second];
+        if (SyncAttributeRange(state, pos, subtree ? layout.subtreeEnd[pos] : pos + 1U) == 0)
+            return;
+
+        state.objectSearch.generation = 0;
+        state.objectSearch.query.generation = 0;
+    }
+
+    static void RebuildSiblingGroups(ExplorerState& state)
+    {
+        const HierarchyLayout& layout = state.hierarchyLayout;
+        std::vector<uint64_t> fingerprintByPosition(layout.Size());
+        for (uint32_t pos = 0; pos < layout.Size(); ++pos)
+            fingerprintByPosition[pos] = state.objects[layout.order[pos]].fingerprint;
+        BuildSiblingGroups(layout, fingerprintByPosition, kMinSiblingGroupRun, &state.siblingGroups);
+
+        state.hierarchyView.rowsDirty = true;
+        state.objectSearch.rowsDirty = true;
+    }
+
+    // Fetches one snapshot (again) and moves its postings from the old components to the new.
+    static void RecollectComponentSnapshot(ExplorerState& state, uint32_t id, ComponentSnapshot* snapshot)
+    {
+        Unity::CGameObject* gameObject = state.objects[id].gameObject;
+        RemoveComponentLookups(state, gameObject, *snapshot);
+        CollectComponentSnapshot(state, gameObject, snapshot);
+        AddComponentLookups(state, id, *snapshot, true);
+    }
+
+    // After lost change events any snapshot may be out of date. Each keeps serving its old
+    // components until the budgeted fill (or a refresh's rescan slice) fetches it again.
+    static void MarkComponentSnapshotsForRescan(ExplorerState& state)
+    {
+        for (auto& [gameObject, snapshot] : state.componentsByObject)
         {
-            if (scene.scene.m_Handle == state.selectedSceneHandle)
+            if (snapshot.collected && !snapshot.stale)
             {
-                selectedSceneLabel = scene.label.c_str();
-                break;
+                snapshot.stale = true;
+                ++state.pendingComponentSnapshots;
             }
         }
+    }
 
-        if (ImGui::BeginCombo("Scene", selectedSceneLabel))
-        {
-            if (ImGui::Selectable("All scenes", state.selectedSceneHandle == 0))
-                state.selectedSceneHandle = 0;
+    // Filled snapshots reach the sibling groups and the filter caches here, not one by one.
+    static void PublishComponentSnapshots(ExplorerState& state)
+    {
+        RebuildSiblingGroups(state);
+        ++state.componentIndexGeneration;
+        state.componentFillUnpublished = false;
+        state.lastComponentPublishTick = GetTickCount64();
+    }
 
-            for (const SceneEntry& scene : state.scenes)
-            {
-                const bool selected = (state.selectedSceneHandle == scene.scene.m_Handle);
-                if (ImGui::Selectable(scene.label.c_str(), selected))
-                    state.selectedSceneHandle = scene.scene.m_Handle;
-            }
+    // Fetches every snapshot still missing, for one-shot tools (scans, diffs, the reverse
+    // reference index) that need all components now. Filters never call it: they query what
+    // TickComponentSnapshots has indexed so far.
+    static void EnsureComponentSnapshots(ExplorerState& state)
+    {
+        if (state.pendingComponentSnapshots == 0)
+            return;
 
-            ImGui::EndCombo();
+        const bool rebuild = state.pendingComponentSnapshots > state.objects.size() / kComponentRebuildDivisor;
+        for (size_t i = 0; i < state.objects.size(); ++i)
+        {
+            Unity::CGameObject* gameObject = state.objects[i].gameObject;
+            auto snapshotIt = state.componentsByObject.find(gameObject);
+            if (snapshotIt == state.componentsByObject.end() || (snapshotIt->second.collected && !snapshotIt->second.stale))
+                continue;
+
+            if (rebuild)
+                CollectComponentSnapshot(state, gameObject, &snapshotIt->second);
+            else
+                RecollectComponentSnapshot(state, static_cast<uint32_t>(i), &snapshotIt->second);
         }
 
-        ImGui::InputTextWithHint("##hierarchy_filter", "Search object...", state.hierarchyFilter, IM_ARRAYSIZE(state.hierarchyFilter));
+        HBLog::Printf("[UExplorer] Fetched components for %zu object(s) on demand\n", state.pendingComponentSnapshots);
+        state.pendingComponentSnapshots = 0;
+        if (rebuild)
+            RebuildComponentLookups(state);
+        PublishComponentSnapshots(state);
+    }
 
-        const std::string filterLower = ToLowerCopy(state.hierarchyFilter);
-        std::unordered_map<Unity::CTransform*, bool> visibilityCache;
-        visibilityCache.reserve(state.objects.size());
-        const bool unfilteredView = (filterLower.empty() && state.selectedSceneHandle == 0);
+    // Fills never-fetched and stale snapshots until the frame's budget is spent, resuming where the last
+    // frame stopped. Runs only against a fresh object cache; a refresh recounts what is left.
+    static void TickComponentSnapshots(ExplorerState& state)
+    {
+        const size_t objectCount = state.objects.size();
+        if (state.objectCacheStale || state.pendingComponentSnapshots == 0 || objectCount == 0)
+        {
+            if (state.componentFillUnpublished)
+                PublishComponentSnapshots(state);
+            return;
+        }
 
-        ImGui::BeginChild("HierarchyTree", ImVec2(0.0f, -140.0f), true);
-        if (unfilteredView)
+        const auto start = std::chrono::steady_clock::now();
+        auto overBudget = [&]()
+            {
+                return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() >= kComponentFillBudgetMicros;
+            };
+
+        for (size_t visited = 0; visited < objectCount && state.pendingComponentSnapshots > 0; ++visited)
         {
-            ImGuiListClipper clipper;
-            clipper.Begin(static_cast<int>(state.rootTransforms.size()));
-            while (clipper.Step())
+            if (state.componentFillCursor >= objectCount)
+                state.componentFillCursor = 0;
+
+            const uint32_t id = static_cast<uint32_t>(state.componentFillCursor++);
+            auto snapshotIt = state.componentsByObject.find(state.objects[id].gameObject);
+            if (snapshotIt == state.componentsByObject.end() || (snapshotIt->second.collected && !snapshotIt->second.stale))
             {
-                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
-                {
-                    DrawHierarchyNode(state, state.rootTransforms[static_cast<size_t>(row)], filterLower, visibilityCache);
-                }
+                if ((visited & 255U) == 255U && overBudget())
+                    break;
+                continue;
             }
+
+            RecollectComponentSnapshot(state, id, &snapshotIt->second);
+            --state.pendingComponentSnapshots;
+            state.componentFillUnpublished = true;
+            if (overBudget())
+                break;
         }
-        else
+
+        if (state.componentFillUnpublished
+            && (state.pendingComponentSnapshots == 0 || (GetTickCount64() - state.lastComponentPublishTick) >= kComponentPublishIntervalMs))
         {
-            for (Unity::CTransform* rootTransform : state.rootTransforms)
-                DrawHierarchyNode(state, rootTransform, filterLower, visibilityCache);
+            PublishComponentSnapshots(state);
         }
-        ImGui::EndChild();
-
-        DrawSceneLoader(state);
     }
 
-    static void DrawObjectSearchTab(ExplorerState& state)
+    static void EnsureObjectComponents(ExplorerState& state, Unity::CGameObject* gameObject)
     {
-        ImGui::InputTextWithHint("Class filter", "e.g. UnityEngine.Camera", state.classFilter, IM_ARRAYSIZE(state.classFilter));
-        ImGui::InputTextWithHint("Name contains", "e.g. Main", state.nameFilter, IM_ARRAYSIZE(state.nameFilter));
+        auto snapshotIt = state.componentsByObject.find(gameObject);
+        auto ownerIt = state.ownerByManagedObject.find(gameObject);
+        if (snapshotIt == state.componentsByObject.end() || (snapshotIt->second.collected && !snapshotIt->second.stale)
+            || ownerIt == state.ownerByManagedObject.end() || ownerIt->second >= state.objects.size())
+        {
+            return;
+        }
 
-        if (AnimatedButton("Refresh results"))
-            ForceRefresh(state);
+        RecollectComponentSnapshot(state, ownerIt->second, &snapshotIt->second);
+        if (state.pendingComponentSnapshots > 0)
+            --state.pendingComponentSnapshots;
+        PublishComponentSnapshots(state);
+    }
 
-        const std::string classFilterLower = ToLowerCopy(state.classFilter);
-        const std::string nameFilterLower = ToLowerCopy(state.nameFilter);
+    // Order-independent, like ComputeComponentSignature: the live count plus a hash per cached child.
+    static uint64_t ComputePathMembership(const ExplorerState& state, const ObjectEntry& parent, int childCount)
+    {
+        uint64_t membership = static_cast<uint64_t>(static_cast<uint32_t>(childCount));
+        for (uint32_t child : parent.children)
+        {
+            const ObjectEntry& entry = state.objects[child];
+            uint64_t value = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(entry.transform)) ^ std::hash<std::string>{}(entry.name);
+            value ^= value >> 31;
+            value *= 0x7FB5D329728EA185ULL;
+            value ^= value >> 27;
+            membership += value;
+        }
+
+        return membership;
+    }
 
-        std::vector<size_t> matches;
-        matches.reserve(state.objects.size());
+    // Path ordinals count earlier same-named siblings in transform order, filtered-out ones
+    // included, so cached paths agree with what ResolveObjectPath walks. A complete child list
+    // collected in GetChild order settles them from cache alone. A parent whose list is partial
+    // or unordered reuses the ordinals its last live walk produced, and is walked live again
+    // only once its membership hash moves.
+    static void AssignPathOrdinals(ExplorerState& state, const std::vector<CollectedObject>& collected)
+    {
+        std::unordered_map<std::string, uint32_t> seen;
+        std::unordered_map<Unity::CTransform*, PathOrdinalMemo> memos;
+        auto nameOf = [&](Unity::CGameObject* gameObject, size_t index)
+            {
+                return (index < state.objects.size()) ? state.objects[index].name : SafeGetObjectName(gameObject);
+            };
 
+        size_t liveWalks = 0;
         for (size_t i = 0; i < state.objects.size(); ++i)
         {
-            ObjectEntry& entry = state.objects[i];
+            const ObjectEntry& parent = state.objects[i];
+            if (parent.children.empty())
+                continue;
+
+            // The scene walk reads the count and appends children in GetChild order; the global
+            // query does neither, but with inactive objects included it holds every child.
+            int childCount = collected[i].childCount;
+            const bool ordered = childCount >= 0 && collected[parent.children.front()].siblingIndex >= 0;
+            if (childCount < 0 && state.includeInactive)
+                childCount = static_cast<int>(parent.children.size());
+
+            bool unique = true;
+            seen.clear();
+            for (uint32_t child : parent.children)
+                unique = seen.emplace(state.objects[child].name, 0U).second && unique;
 
-            if (!SceneFilterPasses(state, entry))
+            const bool complete = childCount == static_cast<int>(parent.children.size());
+            if (unique && complete)
                 continue;
 
-            if (!ContainsLower(entry.nameLower, nameFilterLower))
+            if (ordered && complete)
+            {
+                seen.clear();
+                for (uint32_t child : parent.children)
+                    state.objects[child].pathOrdinal = seen[state.objects[child].name]++;
                 continue;
+            }
+
+            if (childCount < 0)
+                childCount = SafeGetChildCount(parent.transform);
+
+            const uint64_t membership = ComputePathMembership(state, parent, childCount);
+            auto memoIt = state.pathOrdinalMemos.find(parent.transform);
+            if (memoIt != state.pathOrdinalMemos.end() && memoIt->second.membership == membership)
+            {
+                const auto& ordinals = memoIt->second.ordinals;
+                for (uint32_t child : parent.children)
+                {
+                    const std::pair<Unity::CTransform*, uint32_t> key{ state.objects[child].transform, 0U };
+                    auto ordinalIt = std::lower_bound(ordinals.begin(), ordinals.end(), key,
+                        [](const auto& left, const auto& right) { return left.first < right.first; });
+                    state.objects[child].pathOrdinal = (ordinalIt != ordinals.end() && ordinalIt->first == key.first) ? ordinalIt->second : 0U;
+                }
 
-            if (!MatchesClassFilter(state, entry.gameObject, classFilterLower))
+                memos.emplace(parent.transform, std::move(memoIt->second));
                 continue;
+            }
+
+            PathOrdinalMemo memo;
+            memo.membership = membership;
+            seen.clear();
+            for (int c = 0; c < childCount; ++c)
+            {
+                Unity::CTransform* child = SafeGetChild(parent.transform, c);
+                if (!child)
+                    continue;
+
+                auto indexIt = state.indexByTransform.find(child);
+                const size_t index = (indexIt != state.indexByTransform.end()) ? indexIt->second : state.objects.size();
+                const uint32_t ordinal = seen[nameOf(SafeGetTransformGameObject(child), index)]++;
+                if (index < state.objects.size())
+                {
+                    state.objects[index].pathOrdinal = ordinal;
+                    memo.ordinals.emplace_back(child, ordinal);
+                }
+            }
 
-            matches.emplace_back(i);
+            std::sort(memo.ordinals.begin(), memo.ordinals.end());
+            memos.emplace(parent.transform, std::move(memo));
+            ++liveWalks;
         }
 
-        ImGui::Text("Results: %zu", matches.size());
-        ImGui::Separator();
+        // Parents that no longer need a walk drop out with the swap.
+        state.pathOrdinalMemos.swap(memos);
+        if (liveWalks > 0)
+            HBLog::Printf("[UExplorer] Walked %zu parent(s) live for path ordinals\n", liveWalks);
 
-        ImGui::BeginChild("ObjectSearchResults", ImVec2(0.0f, 0.0f), true);
-        ImGuiListClipper clipper;
-        clipper.Begin(static_cast<int>(matches.size()));
+        std::unordered_map<Unity::CGameObject*, size_t> rootIndexByObject;
+        for (uint32_t rootIndex : state.rootIndices)
+            rootIndexByObject.emplace(state.objects[rootIndex].gameObject, rootIndex);
 
-        while (clipper.Step())
+        for (const SceneEntry& scene : state.scenes)
         {
-            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            seen.clear();
+            for (Unity::CGameObject* root : scene.roots)
             {
-                ObjectEntry& entry = state.objects[matches[static_cast<size_t>(row)]];
-                const bool selected = (state.selectedObject == entry.gameObject);
-
-                std::string label = entry.name + "##" + std::to_string(reinterpret_cast<uintptr_t>(entry.gameObject));
-                if (ImGui::Selectable(label.c_str(), selected))
-                    SelectObjectDirect(state, entry.gameObject);
+                auto indexIt = rootIndexByObject.find(root);
+                const size_t index = (indexIt != rootIndexByObject.end()) ? indexIt->second : state.objects.size();
+                const uint32_t ordinal = seen[nameOf(root, index)]++;
+                if (index < state.objects.size())
+                    state.objects[index].pathOrdinal = ordinal;
             }
         }
-
-        ImGui::EndChild();
     }
 
-    template<typename T>
-    static bool ReadFieldValue(Unity::CComponent* component, Unity::il2cppFieldInfo* field, bool isStatic, T* outValue)
+    // Everything drained so far is covered by the refresh that just ran.
+    static void ClearPendingChanges(ExplorerState& state)
     {
-        if (!component || !field || !outValue)
-            return false;
+        state.pendingChangeEvents = 0;
+        state.pendingSceneChange = false;
+        state.pendingObjectChange = false;
+        state.pendingChangeOverflow = false;
+        state.lastObjectRefreshTick = GetTickCount64();
+    }
 
-        if (isStatic)
-            return TryGetStaticFieldValue(field, outValue);
+    static void RefreshObjectCache(ExplorerState& state)
+    {
+        state.objectCacheStale = false;
+        state.objects.clear();
+        state.indexByTransform.clear();
+        state.rootIndices.clear();
+        state.nameIndex.Clear();
 
-        __try
+        // With a scene selected only that scene is walked; "All scenes" needs the global query.
+        std::vector<CollectedObject> collected;
+        const SceneEntry* scopedScene = FindSceneEntry(state, state.selectedSceneHandle);
+        if (scopedScene && scopedScene->rootsResolved)
         {
-            *outValue = component->GetMemberValue<T>(field);
-            return true;
+            CollectSceneObjects(state, *scopedScene, &collected);
         }
-        __except (EXCEPTION_EXECUTE_HANDLER)
+        else if (!CollectAllObjects(state, &collected))
         {
-            return false;
+            ClearPendingChanges(state);
+            return;
         }
-    }
 
-    template<typename T>
-    static bool WriteFieldValue(Unity::CComponent* component, Unity::il2cppFieldInfo* field, bool isStatic, T value)
-    {
-        if (!component || !field)
-            return false;
+        state.objects.reserve(collected.size());
+        state.nameIndex.Reserve(collected.size(), collected.size() * 24U);
 
-        if (isStatic)
-            return TrySetStaticFieldValue(field, &value);
+        for (const CollectedObject& object : collected)
+        {
+            ObjectEntry entry{};
+            entry.gameObject = object.gameObject;
+            entry.transform = object.transform;
+            entry.parent = object.parent;
+            entry.name = SafeGetObjectName(object.gameObject);
+            entry.stemHash = HashNameStem(NameStem(entry.name));
+            entry.activeSelf = SafeGetActiveSelf(object.gameObject);
 
-        __try
+            state.indexByTransform[entry.transform] = state.objects.size();
+            state.nameIndex.Add(ToLowerCopy(entry.name));
+            state.objects.emplace_back(std::move(entry));
+        }
+
+        for (size_t i = 0; i < state.objects.size(); ++i)
         {
-            component->SetMemberValue<T>(field, value);
-            return true;
+            ObjectEntry& entry = state.objects[i];
+            auto parentIt = state.indexByTransform.find(entry.parent);
+            if (entry.parent && parentIt != state.indexByTransform.end())
+            {
+                state.objects[parentIt->second].children.emplace_back(static_cast<uint32_t>(i));
+            }
+            else
+            {
+                state.rootIndices.emplace_back(static_cast<uint32_t>(i));
+            }
         }
-        __except (EXCEPTION_EXECUTE_HANDLER)
+
+        std::unordered_map<Unity::CGameObject*, int> sceneByRoot;
+        std::unordered_map<int, size_t> sceneRank;
+        for (size_t i = 0; i < state.scenes.size(); ++i)
         {
-            return false;
+            const SceneEntry& scene = state.scenes[i];
+            sceneRank.emplace(scene.scene.m_Handle, i);
+            for (Unity::CGameObject* root : scene.roots)
+                sceneByRoot.emplace(root, scene.scene.m_Handle);
         }
-    }
 
-    static bool IsSupportedEditableType(unsigned int typeCode)
-    {
-        switch (typeCode)
+        for (uint32_t rootIndex : state.rootIndices)
         {
-        case TypeCode_Boolean:
-        case TypeCode_String:
-        case TypeCode_R4:
-        case TypeCode_R8:
-        case TypeCode_I4:
-        case TypeCode_U4:
-        case TypeCode_I2:
-        case TypeCode_U2:
-        case TypeCode_I1:
-        case TypeCode_U1:
-        case TypeCode_Char:
-            return true;
-        default:
-            return false;
+            auto sceneIt = sceneByRoot.find(state.objects[rootIndex].gameObject);
+            state.objects[rootIndex].sceneHandle = (sceneIt != sceneByRoot.end()) ? sceneIt->second : 0;
         }
-    }
 
-    static std::string BuildFieldDraftFromCurrentValue(
-        Unity::CComponent* component,
-        Unity::il2cppFieldInfo* field,
-        bool isStatic,
-        unsigned int typeCode)
-    {
-        char buffer[128]{};
+        AssignPathOrdinals(state, collected);
 
-        switch (typeCode)
+        auto rankOf = [&](int sceneHandle)
+            {
+                auto rankIt = sceneRank.find(sceneHandle);
+                return (rankIt != sceneRank.end()) ? rankIt->second : state.scenes.size();
+            };
+
+        auto nameLess = [&](uint32_t left, uint32_t right)
+            {
+                return _stricmp(state.objects[left].name.c_str(), state.objects[right].name.c_str()) < 0;
+            };
+
+        auto rootLess = [&](uint32_t left, uint32_t right)
+            {
+                const size_t leftRank = rankOf(state.objects[left].sceneHandle);
+                const size_t rightRank = rankOf(state.objects[right].sceneHandle);
+                if (leftRank != rightRank)
+                    return leftRank < rightRank;
+
+                return nameLess(left, right);
+            };
+
+        std::sort(state.rootIndices.begin(), state.rootIndices.end(), rootLess);
+        for (ObjectEntry& entry : state.objects)
+            std::sort(entry.children.begin(), entry.children.end(), nameLess);
+
+        BuildHierarchyLayout(
+            state.objects.size(),
+            state.rootIndices,
+            [&](uint32_t node) -> const std::vector<uint32_t>& { return state.objects[node].children; },
+            &state.hierarchyLayout);
+
+        // Scene membership flows from each root down its subtree in one pre-order pass.
+        const HierarchyLayout& layout = state.hierarchyLayout;
+        state.sceneLayoutRanges.clear();
+        for (uint32_t pos = 0; pos < layout.Size(); ++pos)
         {
-        case TypeCode_Boolean:
+            ObjectEntry& entry = state.objects[layout.order[pos]];
+            const uint32_t parentPos = layout.parent[pos];
+            if (parentPos != kInvalidIndex)
+            {
+                entry.sceneHandle = state.objects[layout.order[parentPos]].sceneHandle;
+                continue;
+            }
+
+            if (entry.sceneHandle == 0)
+                continue;
+
+            auto [rangeIt, inserted] = state.sceneLayoutRanges.try_emplace(entry.sceneHandle, pos, layout.subtreeEnd[pos]);
+            if (!inserted)
+                rangeIt->second.second = layout.subtreeEnd[pos];
+        }
+
+        RefreshObjectLookups(state);
+        RebuildSiblingGroups(state);
+        SyncAttributeIndex(state);
+
+        ++state.objectCacheGeneration;
+        SyncHierarchyExpansion(state);
+
+        if (state.selectedHandle && !ResolveGameObjectHandle(state, state.selectedHandle) && !TryRecoverSelectionByPath(state))
+            ClearSelection(state);
+
+        if (state.lastObjectCountLogged != state.objects.size())
         {
-            bool value = false;
-            ReadFieldValue(component, field, isStatic, &value);
-            return value ? "true" : "false";
+            HBLog::Printf("[UExplorer] Object cache refreshed: %zu object(s).\n", state.objects.size());
+            state.lastObjectCountLogged = state.objects.size();
         }
-        case TypeCode_I4:
+
+        ClearPendingChanges(state);
+    }
+
+    // Lazy-mode counterpart of RefreshObjectCache: drops the snapshot without walking anything.
+    static void InvalidateObjectCache(ExplorerState& state)
+    {
+        state.objectCacheStale = true;
+        ++state.lazyTree.version;
+        ClearPendingChanges(state);
+    }
+
+    static void RefreshObjects(ExplorerState& state)
+    {
+        ReleaseUnreferencedObjectHandles(state);
+
+        if (state.lazyHierarchy)
+            InvalidateObjectCache(state);
+        else
+            RefreshObjectCache(state);
+    }
+
+    // Views that need every object (search, filtered hierarchy, reference lookups) call this
+    // first; in lazy mode it is the only place the full walk happens.
+    static void EnsureObjectCache(ExplorerState& state)
+    {
+        if (state.objectCacheStale)
+            RefreshObjectCache(state);
+    }
+
+    static void ForceRefresh(ExplorerState& state)
+    {
+        RefreshSceneCache(state);
+        RefreshObjects(state);
+    }
+
+    static constexpr ULONGLONG kChangeHookPollIntervalMs = 30000;
+
+    static bool IsGameObjectClassCached(ChurnState& churn, Unity::il2cppClass* klass)
+    {
+        auto [it, inserted] = churn.isGameObjectClass.try_emplace(klass, false);
+        if (inserted)
+            it->second = IsClassOrParent(klass, "UnityEngine", "GameObject");
+        return it->second;
+    }
+
+    static constexpr size_t kChurnMaxSignatureStems = 4096U;
+
+    static std::string BuildSignatureLabel(const ComponentSnapshot& snapshot)
+    {
+        std::string label;
+        for (size_t i = 0; i < snapshot.classes.size(); ++i)
         {
-            int value = 0;
-            ReadFieldValue(component, field, isStatic, &value);
-            std::snprintf(buffer, sizeof(buffer), "%d", value);
-            return buffer;
+            if (i == 4U)
+            {
+                label += " +" + std::to_string(snapshot.classes.size() - i);
+                break;
+            }
+
+            if (!label.empty())
+                label += ", ";
+            label += SafeGetClassDisplayName(snapshot.classes[i]);
         }
-        case TypeCode_U4:
+
+        return label.empty() ? std::string("(no components)") : label;
+    }
+
+    template<typename MakeLabel>
+    static void RecordChurn(ChurnProfiler& profiler, uint64_t key, bool created, uint64_t tick, MakeLabel&& makeLabel)
+    {
+        ChurnProfiler::Series* series = profiler.Acquire(key);
+        if (!series)
+            return;
+
+        if (series->label.empty())
+            series->label = makeLabel();
+        profiler.Record(*series, created, tick);
+    }
+
+    // A clone can be destroyed again before its event is drained, so its native object is
+    // checked before the name and (once per stem) components are read. Clones already gone
+    // count as untracked.
+    static ChurnAttribution ClassifySpawnedObject(ExplorerState& state, Unity::il2cppObject* object, uint64_t tick)
+    {
+        ChurnState& churn = state.churn;
+        ChurnAttribution attribution{};
+
+        Unity::il2cppClass* klass = nullptr;
+        if (!SafeReadObjectClass(object, &klass) || !klass || !SafeIsNativeObjectAlive(object))
         {
-            uint32_t value = 0;
-            ReadFieldValue(component, field, isStatic, &value);
-            std::snprintf(buffer, sizeof(buffer), "%u", value);
-            return buffer;
+            RecordChurn(churn.byStem, 0, true, tick, []() { return std::string("(untracked)"); });
+            RecordChurn(churn.bySignature, 0, true, tick, []() { return std::string("(untracked)"); });
+            return attribution;
         }
-        case TypeCode_R4:
+
+        const std::string name = SafeGetObjectName(reinterpret_cast<Unity::CObject*>(object));
+        const std::string_view stem = NameStem(name);
+        attribution.stemHash = HashNameStem(stem);
+
+        std::string signatureLabel;
+        if (IsGameObjectClassCached(churn, klass))
         {
-            float value = 0.0f;
-            ReadFieldValue(component, field, isStatic, &value);
-            std::snprintf(buffer, sizeof(buffer), "%.6f", value);
-            return buffer;
+            auto it = churn.signatureByStem.find(attribution.stemHash);
+            if (it != churn.signatureByStem.end())
+            {
+                attribution.signature = it->second;
+            }
+            else
+            {
+                ComponentSnapshot snapshot{};
+                SafeCollectComponents(state, reinterpret_cast<Unity::CGameObject*>(object), &snapshot);
+                attribution.signature = ComputeComponentSignature(snapshot);
+                signatureLabel = BuildSignatureLabel(snapshot);
+
+                if (churn.signatureByStem.size() >= kChurnMaxSignatureStems)
+                    churn.signatureByStem.clear();
+                churn.signatureByStem.emplace(attribution.stemHash, attribution.signature);
+            }
         }
-        case TypeCode_R8:
+        else
         {
-            double value = 0.0;
-            ReadFieldValue(component, field, isStatic, &value);
-            std::snprintf(buffer, sizeof(buffer), "%.9f", value);
-            return buffer;
+            // Instantiate(component) returns the component; count it under its own class.
+            attribution.signature = 1U + HashComponentClass(klass);
+            signatureLabel = SafeGetClassDisplayName(klass);
         }
-        case TypeCode_I2:
+
+        RecordChurn(churn.byStem, attribution.stemHash, true, tick, [&]() { return stem.empty() ? std::string("(unnamed)") : std::string(stem); });
+        RecordChurn(churn.bySignature, attribution.signature, true, tick, [&]() { return signatureLabel.empty() ? std::string(stem) : signatureLabel; });
+        return attribution;
+    }
+
+    // Destroyed objects may already be gone natively, so they are only looked up, never read.
+    static void RecordDestroyedObject(ExplorerState& state, uintptr_t subject, uint64_t tick)
+    {
+        ChurnState& churn = state.churn;
+        ChurnAttribution attribution{};
+        std::string stemLabel = "(untracked)";
+        std::string signatureLabel = "(untracked)";
+
+        auto ownerIt = state.ownerByManagedObject.find(reinterpret_cast<const void*>(subject));
+        if (!churn.spawned.Take(subject, &attribution)
+            && ownerIt != state.ownerByManagedObject.end() && ownerIt->second < state.objects.size())
         {
-            short value = 0;
-            ReadFieldValue(component, field, isStatic, &value);
-            std::snprintf(buffer, sizeof(buffer), "%d", static_cast<int>(value));
-            return buffer;
+            const ObjectEntry& owner = state.objects[ownerIt->second];
+            attribution.stemHash = owner.stemHash;
+            stemLabel = std::string(NameStem(owner.name));
+
+            auto snapshotIt = state.componentsByObject.find(owner.gameObject);
+            if (reinterpret_cast<uintptr_t>(owner.gameObject) != subject)
+            {
+                Unity::il2cppClass* klass = nullptr;
+                SafeReadObjectClass(reinterpret_cast<Unity::il2cppObject*>(subject), &klass);
+                attribution.signature = 1U + HashComponentClass(klass);
+                signatureLabel = SafeGetClassDisplayName(klass);
+            }
+            else if (snapshotIt != state.componentsByObject.end() && snapshotIt->second.collected)
+            {
+                attribution.signature = snapshotIt->second.signature;
+                signatureLabel = BuildSignatureLabel(snapshotIt->second);
+            }
         }
-        case TypeCode_U2:
+
+        RecordChurn(churn.byStem, attribution.stemHash, false, tick, [&]() { return stemLabel; });
+        RecordChurn(churn.bySignature, attribution.signature, false, tick, [&]() { return signatureLabel; });
+    }
+
+    static void RecordChurnEvent(ExplorerState& state, const ChangeEvent& changeEvent)
+    {
+        ChurnState& churn = state.churn;
+        if (changeEvent.kind == ChangeEventKind::ObjectInstantiated)
         {
-            uint16_t value = 0;
-            ReadFieldValue(component, field, isStatic, &value);
-            std::snprintf(buffer, sizeof(buffer), "%u", static_cast<unsigned int>(value));
-            return buffer;
+            const ChurnAttribution attribution = ClassifySpawnedObject(state, reinterpret_cast<Unity::il2cppObject*>(changeEvent.subject), changeEvent.tick);
+            churn.spawned.Remember(changeEvent.subject, attribution);
         }
-        case TypeCode_I1:
+        else if (changeEvent.kind == ChangeEventKind::ObjectDestroyed)
         {
-            int8_t value = 0;
-            ReadFieldValue(component, field, isStatic, &value);
-            std::snprintf(buffer, sizeof(buffer), "%d", static_cast<int>(value));
-            return buffer;
+            RecordDestroyedObject(state, changeEvent.subject, changeEvent.tick);
         }
-        case TypeCode_U1:
+        else
         {
-            unsigned char value = 0;
-            ReadFieldValue(component, field, isStatic, &value);
-            std::snprintf(buffer, sizeof(buffer), "%u", static_cast<unsigned int>(value));
-            return buffer;
+            return;
         }
-        case TypeCode_Char:
+
+        ++churn.eventsRecorded;
+    }
+
+    static bool IsCachedObject(const ExplorerState& state, Unity::il2cppObject* object)
+    {
+        return object
+            && (object == reinterpret_cast<Unity::il2cppObject*>(state.selectedObject)
+                || state.ownerByManagedObject.find(object) != state.ownerByManagedObject.end()
+                || state.lazyTree.nodeByObject.find(reinterpret_cast<Unity::CGameObject*>(object)) != state.lazyTree.nodeByObject.end());
+    }
+
+    // An Instantiate or Destroy only warrants a refresh when it lands in what the explorer
+    // shows: a cached object or component, a child of one, or a new root of the scene in view.
+    // Pooled effects parented elsewhere and non-GameObject clones do not.
+    static bool IsRelevantObjectEvent(ExplorerState& state, const ChangeEvent& changeEvent)
+    {
+        Unity::il2cppObject* object = reinterpret_cast<Unity::il2cppObject*>(changeEvent.subject);
+        if (changeEvent.kind == ChangeEventKind::ObjectDestroyed)
+            return IsCachedObject(state, object);
+
+        Unity::il2cppClass* klass = nullptr;
+        if (!SafeReadObjectClass(object, &klass) || !klass || !SafeIsNativeObjectAlive(object))
+            return false;
+
+        Unity::CGameObject* gameObject = nullptr;
+        if (IsGameObjectClassCached(state.churn, klass))
+            gameObject = reinterpret_cast<Unity::CGameObject*>(object);
+        else if (IsClassOrParent(klass, "UnityEngine", "Component"))
+            gameObject = SafeGetComponentGameObject(reinterpret_cast<Unity::CComponent*>(object));
+        if (!gameObject)
+            return false;
+
+        Unity::CTransform* parent = SafeGetParent(SafeGetTransform(gameObject));
+        if (!parent)
+            return state.selectedSceneHandle == 0 || state.selectedSceneHandle == state.activeSceneHandle;
+
+        return IsCachedObject(state, reinterpret_cast<Unity::il2cppObject*>(SafeGetTransformGameObject(parent)));
+    }
+
+    // Object events are only classified while the overlay is shown; showing it refreshes anyway.
+    static void DrainChangeEvents(ExplorerState& state, bool classify)
+    {
+        ChangeEventQueue& queue = GetChangeQueue();
+        ChangeEvent changeEvent{};
+        while (queue.TryPop(&changeEvent))
         {
-            uint16_t value = 0;
-            ReadFieldValue(component, field, isStatic, &value);
-            const char printable = static_cast<char>(value & 0xFFU);
-            if (printable >= 0x20 && printable <= 0x7E)
-                std::snprintf(buffer, sizeof(buffer), "%c", printable);
-            else
-                std::snprintf(buffer, sizeof(buffer), "%u", static_cast<unsigned int>(value));
-            return buffer;
+            if (state.churn.recording && changeEvent.subject != 0)
+                RecordChurnEvent(state, changeEvent);
+            ++state.pendingChangeEvents;
+
+            switch (changeEvent.kind)
+            {
+            case ChangeEventKind::ActiveSceneChanged:
+                state.activeSceneHandle = changeEvent.sceneHandle;
+                state.pendingSceneChange = true;
+                break;
+            case ChangeEventKind::SceneLoaded:
+            case ChangeEventKind::SceneUnloaded:
+                state.pendingSceneChange = true;
+                break;
+            default:
+                if (classify && !state.pendingObjectChange && IsRelevantObjectEvent(state, changeEvent))
+                    state.pendingObjectChange = true;
+                break;
+            }
         }
-        case TypeCode_String:
+
+        // Lost events could have been anything; they count as object changes.
+        if (const uint32_t dropped = queue.TakeDroppedCount(); dropped != 0)
         {
-            Unity::System_String* value = nullptr;
-            ReadFieldValue(component, field, isStatic, &value);
-            return UnityStringToUtf8(value);
+            if (state.churn.recording)
+                state.churn.eventsDropped += dropped;
+
+            state.pendingChangeEvents += dropped;
+            state.pendingChangeOverflow = true;
+            state.pendingObjectChange = true;
         }
-        default:
-            return {};
+    }
+
+    // Scene loads, unloads and active scene switches refresh at once. Relevant Instantiate and
+    // Destroy events wait out the poll interval, so a game that keeps spawning refreshes no
+    // more often than polling would.
+    static bool ChangeRefreshDue(const ExplorerState& state, ULONGLONG now)
+    {
+        if (!state.refreshOnChanges)
+            return false;
+
+        if (state.pendingSceneChange)
+            return true;
+
+        return state.pendingObjectChange && (now - state.lastObjectRefreshTick) >= state.refreshIntervalMs;
+    }
+
+    static void TickRefresh(ExplorerState& state)
+    {
+        if (!state.fnObjectGetInstanceId)
+            ResolveRuntimeMethods(state);
+
+        DrainChangeEvents(state, true);
+        TickComponentSnapshots(state);
+
+        const ULONGLONG now = GetTickCount64();
+        if (ChangeRefreshDue(state, now))
+        {
+            if (state.pendingChangeOverflow)
+                MarkComponentSnapshotsForRescan(state);
+
+            ForceRefresh(state);
+            return;
         }
+
+        if (!state.autoRefresh)
+            return;
+
+        // With working change hooks polling is only a safety net for changes they cannot see.
+        const ULONGLONG interval = state.changeHooksActive
+            ? std::max(state.refreshIntervalMs, kChangeHookPollIntervalMs)
+            : state.refreshIntervalMs;
+
+        const bool objectsDue = (now - state.lastObjectRefreshTick) >= interval;
+
+        // Scene roots feed object membership, so an object refresh always sees fresh scenes.
+        if (objectsDue || (now - state.lastSceneRefreshTick) >= interval)
+            RefreshSceneCache(state);
+
+        if (objectsDue)
+            RefreshObjects(state);
     }
 
-    static bool ApplyFieldDraftValue(
-        Unity::CComponent* component,
-        Unity::il2cppFieldInfo* field,
-        bool isStatic,
-        unsigned int typeCode,
-        const std::string& textDraft)
+    // One budgeted slice of the pose sweep. A new object snapshot reassigns ids, so the capture
+    // starts over with every slot invalid and the first sweep reports everything as changed.
+    static void TickTransformCapture(ExplorerState& state)
     {
-        switch (typeCode)
+        const bool wanted = state.captureTransforms || state.nearby.tabVisible;
+        state.nearby.tabVisible = false;
+        if (!wanted)
+            return;
+
+        EnsureObjectCache(state);
+
+        TransformCapture& capture = state.transformCapture;
+        if (state.transformCaptureGeneration != state.objectCacheGeneration || capture.Size() != state.objects.size())
         {
-        case TypeCode_Boolean:
+            capture.Reset(state.objects.size());
+            state.transformCaptureGeneration = state.objectCacheGeneration;
+        }
+
+        capture.Step([&state](uint32_t id, TransformSample* outSample)
+            {
+                return SafeReadTransformSample(state.objects[id].transform, outSample);
+            }, static_cast<uint32_t>(std::max(state.captureBudgetMicros, 0)));
+    }
+
+    // Column-major world-to-camera and projection matrices of Camera.main.
+    static bool SafeReadMainCameraMatrices(float* outView, float* outProjection)
+    {
+        Unity::Matrix4x4 view{};
+        Unity::Matrix4x4 projection{};
+
+        __try
         {
-            bool value = false;
-            if (!ParseBoolText(textDraft, &value))
+            Unity::CCamera* camera = Unity::Camera::GetMain();
+            if (!camera || !camera->GetWorldToCameraMatrix(view) || !camera->GetProjectionMatrix(projection))
                 return false;
-            return WriteFieldValue(component, field, isStatic, value);
         }
-        case TypeCode_I4:
+        __except (EXCEPTION_EXECUTE_HANDLER)
         {
-            int value = 0;
-            if (!ParseSignedIntegerText<int>(textDraft, &value))
-                return false;
-            return WriteFieldValue(component, field, isStatic, value);
+            return false;
+        }
+
+        std::memcpy(outView, view.m, sizeof(view.m));
+        std::memcpy(outProjection, projection.m, sizeof(projection.m));
+        return true;
+    }
+
+    // Camera position is -R^T * t for the rigid world-to-camera transform.
+    static void CameraPositionFromView(const float* view, float* outPosition)
+    {
+        for (int axis = 0; axis < 3; ++axis)
+            outPosition[axis] = -(view[axis * 4 + 0] * view[12] + view[axis * 4 + 1] * view[13] + view[axis * 4 + 2] * view[14]);
+    }
+
+    // An object patched into another cell joins the grid's loose list until it compacts, so a
+    // sweep where a large share moved is cheaper as one rebuild.
+    static constexpr size_t kSpatialRebuildDivisor = 4;
+
+    static void SyncSpatialIndex(ExplorerState& state)
+    {
+        NearbyState& nearby = state.nearby;
+        const TransformCapture& capture = state.transformCapture;
+        const uint64_t sweep = capture.GetStats().sweepCount;
+        if (sweep == 0 || capture.Size() == 0)
+            return;
+
+        const bool stale = nearby.builtGeneration != state.transformCaptureGeneration
+            || nearby.builtCellSize != nearby.cellSize
+            || nearby.grid.Size() != capture.Size();
+        if (!stale && nearby.builtSweep == sweep)
+            return;
+
+        const auto start = std::chrono::steady_clock::now();
+        const size_t changed = capture.GetStats().changedLastSweep;
+        nearby.lastSyncRebuilt = stale || nearby.builtSweep + 1U != sweep || changed > capture.Size() / kSpatialRebuildDivisor;
+        if (nearby.lastSyncRebuilt)
+        {
+            nearby.grid.Build(capture.Size(), capture.px.data(), capture.py.data(), capture.pz.data(), capture.valid, nearby.cellSize);
+            nearby.builtGeneration = state.transformCaptureGeneration;
+            nearby.builtCellSize = nearby.cellSize;
+            nearby.lastPatched = capture.Size();
+        }
+        else
+        {
+            capture.changed.ForEachSet([&](size_t id)
+                {
+                    const uint32_t index = static_cast<uint32_t>(id);
+                    if (capture.valid.Test(id))
+                        nearby.grid.Update(index, capture.px[id], capture.py[id], capture.pz[id]);
+                    else
+                        nearby.grid.Remove(index);
+                });
+            nearby.lastPatched = changed;
+        }
+
+        nearby.builtSweep = sweep;
+        nearby.lastSyncMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static bool ResolveNearbyCenter(ExplorerState& state, float* outCenter)
+    {
+        NearbyState& nearby = state.nearby;
+        if (nearby.center == 2)
+        {
+            std::memcpy(outCenter, nearby.customCenter, sizeof(nearby.customCenter));
+            return true;
+        }
+
+        if (nearby.center == 1)
+        {
+            float view[16]{};
+            float projection[16]{};
+            if (!SafeReadMainCameraMatrices(view, projection))
+                return false;
+
+            CameraPositionFromView(view, outCenter);
+            return true;
+        }
+
+        auto it = state.ownerByManagedObject.find(state.selectedObject);
+        if (!state.selectedObject || it == state.ownerByManagedObject.end()
+            || it->second >= state.transformCapture.Size() || !state.transformCapture.valid.Test(it->second))
+        {
+            return false;
+        }
+
+        const TransformSample sample = state.transformCapture.Sample(it->second);
+        std::memcpy(outCenter, sample.position, sizeof(sample.position));
+        return true;
+    }
+
+    static void RunNearbyQuery(ExplorerState& state)
+    {
+        NearbyState& nearby = state.nearby;
+        nearby.results.clear();
+        nearby.centerValid = false;
+        if (nearby.grid.InsertedCount() == 0)
+            return;
+
+        const auto start = std::chrono::steady_clock::now();
+        if (nearby.mode == 2)
+        {
+            float view[16]{};
+            float projection[16]{};
+            if (!SafeReadMainCameraMatrices(view, projection))
+                return;
+
+            float viewProjection[16]{};
+            Frustum::Multiply(projection, view, viewProjection);
+            const Frustum frustum = Frustum::FromViewProjection(viewProjection);
+
+            // Listed by distance from the camera, so the nearest visible objects come first.
+            CameraPositionFromView(view, nearby.lastCenter);
+            nearby.centerValid = true;
+            nearby.grid.QueryFrustum(frustum, [&](uint32_t id)
+                {
+                    nearby.results.push_back({ nearby.grid.DistanceSq(id, nearby.lastCenter), id });
+                });
+            std::sort(nearby.results.begin(), nearby.results.end(), [](const SpatialGrid::Neighbor& left, const SpatialGrid::Neighbor& right)
+                {
+                    return left.distanceSq < right.distanceSq;
+                });
+        }
+        else
+        {
+            if (!ResolveNearbyCenter(state, nearby.lastCenter))
+                return;
+
+            nearby.centerValid = true;
+            if (nearby.mode == 1)
+            {
+                nearby.grid.Nearest(nearby.lastCenter, static_cast<size_t>(std::max(nearby.nearestCount, 1)),
+                    std::numeric_limits<float>::max(), &nearby.results);
+            }
+            else
+            {
+                nearby.grid.QueryRadius(nearby.lastCenter, nearby.radius, [&](uint32_t id, float distanceSq)
+                    {
+                        nearby.results.push_back({ distanceSq, id });
+                    });
+                std::sort(nearby.results.begin(), nearby.results.end(), [](const SpatialGrid::Neighbor& left, const SpatialGrid::Neighbor& right)
+                    {
+                        return left.distanceSq < right.distanceSq;
+                    });
+            }
+        }
+
+        nearby.lastQueryMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    static bool SceneFilterPasses(const ExplorerState& state, const ObjectEntry& entry)
+    {
+        if (state.selectedSceneHandle == 0)
+            return true;
+
+        return entry.sceneHandle == state.selectedSceneHandle;
+    }
+
+    // Object indices whose name contains the filter text, case-insensitively. The query only
+    // runs again when the text or the snapshot generation changes.
+    static const std::vector<uint32_t>& QueryNameMatches(ExplorerState& state, NameQueryCache& cache, const char* filter)
+    {
+        if (cache.generation == state.objectCacheGeneration && cache.filter == filter)
+            return cache.ids;
+
+        cache.generation = state.objectCacheGeneration;
+        cache.filter = filter;
+        state.nameIndex.Query(ToLowerCopy(cache.filter), &cache.ids);
+        return cache.ids;
+    }
+
+    static void RebuildHierarchyRows(ExplorerState& state)
+    {
+        HierarchyViewCache& view = state.hierarchyView;
+        const HierarchyLayout& layout = state.hierarchyLayout;
+
+        if (view.expansionDirty)
+        {
+            SyncHierarchyExpansion(state);
+            view.expansionDirty = false;
+        }
+
+        const bool filterChanged = view.builtGeneration != state.objectCacheGeneration
+            || view.builtSceneHandle != state.selectedSceneHandle
+            || view.builtFilter != state.hierarchyFilter;
+
+        if (view.builtGrouped != state.groupRepeatedSiblings)
+        {
+            view.builtGrouped = state.groupRepeatedSiblings;
+            view.rowsDirty = true;
+        }
+
+        if (!filterChanged && !view.rowsDirty)
+            return;
+
+        if (filterChanged)
+        {
+            view.builtGeneration = state.objectCacheGeneration;
+            view.builtSceneHandle = state.selectedSceneHandle;
+            view.builtFilter = state.hierarchyFilter;
+
+            view.filtered = !view.builtFilter.empty() || state.selectedSceneHandle != 0;
+            if (view.filtered)
+            {
+                view.visible.Resize(layout.Size());
+                if (!view.builtFilter.empty())
+                {
+                    for (uint32_t index : QueryNameMatches(state, view.nameQuery, view.builtFilter.c_str()))
+                    {
+                        const uint32_t pos = layout.position[index];
+                        if (pos != kInvalidIndex && SceneFilterPasses(state, state.objects[index]))
+                            view.visible.Set(pos);
+                    }
+
+                    PropagateMatchesToAncestors(layout, &view.visible);
+                }
+                else
+                {
+                    auto rangeIt = state.sceneLayoutRanges.find(state.selectedSceneHandle);
+                    if (rangeIt != state.sceneLayoutRanges.end())
+                        view.visible.SetRange(rangeIt->second.first, rangeIt->second.second);
+                }
+            }
+        }
+
+        if (view.builtGrouped)
+            FlattenGroupedRows(layout, state.siblingGroups, view.filtered ? &view.visible : nullptr, view.expanded, view.groupExpanded, &view.rows);
+        else
+            FlattenVisibleRows(layout, view.filtered ? &view.visible : nullptr, view.expanded, &view.rows);
+
+        view.rowsDirty = false;
+    }
+
+    // A collapsed run of look-alike siblings, drawn as "Name ×N". Returns true once the user
+    // opens it; the caller then swaps in the individual members.
+    static bool DrawSiblingGroupRow(const void* id, uint32_t depth, std::string_view name, uint32_t count)
+    {
+        const float indent = static_cast<float>(depth) * ImGui::GetStyle().IndentSpacing;
+        if (indent > 0.0f)
+            ImGui::Indent(indent);
+
+        ImGui::PushID("SiblingGroup");
+        ImGui::SetNextItemOpen(false, ImGuiCond_Always);
+        const bool opened = ImGui::TreeNodeEx(id, ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_NoTreePushOnOpen,
+            "%.*s \xC3\x97%u", static_cast<int>(name.size()), name.data(), count);
+        ImGui::PopID();
+
+        if (indent > 0.0f)
+            ImGui::Unindent(indent);
+
+        return opened;
+    }
+
+    // Trailing button on the first member of an opened run. Returns true to collapse it again.
+    static bool DrawCollapseGroupButton(const void* id, uint32_t count)
+    {
+        ImGui::SameLine();
+        ImGui::PushID(id);
+        char label[32]{};
+        std::snprintf(label, sizeof(label), "\xC3\x97%u##CollapseGroup", count);
+        const bool clicked = ImGui::SmallButton(label);
+        if (ImGui::IsItemHovered())
+            ImGui::SetTooltip("Collapse %u similar siblings", count);
+        ImGui::PopID();
+        return clicked;
+    }
+
+    static void DrawHierarchyGroupRow(ExplorerState& state, uint32_t pos)
+    {
+        HierarchyViewCache& view = state.hierarchyView;
+        const HierarchyLayout& layout = state.hierarchyLayout;
+        const ObjectEntry& head = state.objects[layout.order[pos]];
+
+        if (DrawSiblingGroupRow(head.transform, layout.depth[pos], NameStem(head.name), state.siblingGroups.runLength[pos]))
+        {
+            view.groupExpanded.Set(pos);
+            view.expandedGroups.insert(head.transform);
+            view.rowsDirty = true;
+            state.lazyTree.rowsDirty = true;
+        }
+    }
+
+    static void DrawHierarchyRow(ExplorerState& state, uint32_t pos)
+    {
+        if ((pos & kGroupRowFlag) != 0)
+        {
+            DrawHierarchyGroupRow(state, pos & ~kGroupRowFlag);
+            return;
+        }
+
+        HierarchyViewCache& view = state.hierarchyView;
+        const HierarchyLayout& layout = state.hierarchyLayout;
+        ObjectEntry& entry = state.objects[layout.order[pos]];
+
+        const bool hasChildren = layout.HasChildren(pos);
+        ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+        if (!hasChildren)
+            flags |= ImGuiTreeNodeFlags_Leaf;
+
+        if (state.selectedObject == entry.gameObject)
+            flags |= ImGuiTreeNodeFlags_Selected;
+
+        // Rows are flat for the clipper, so nesting is drawn as indentation instead of TreePush.
+        const float indent = static_cast<float>(layout.depth[pos]) * ImGui::GetStyle().IndentSpacing;
+        if (indent > 0.0f)
+            ImGui::Indent(indent);
+
+        const bool expanded = view.expanded.Test(pos);
+        ImGui::SetNextItemOpen(expanded, ImGuiCond_Always);
+        const bool opened = ImGui::TreeNodeEx(reinterpret_cast<void*>(entry.transform), flags, "%s", entry.name.c_str());
+        if (ImGui::IsItemClicked(ImGuiMouseButton_Left))
+            SelectObjectDirect(state, entry.gameObject);
+
+        if (hasChildren && opened != expanded)
+        {
+            if (opened)
+            {
+                view.expanded.Set(pos);
+                view.expandedTransforms.insert(entry.transform);
+            }
+            else
+            {
+                view.expanded.Reset(pos);
+                view.expandedTransforms.erase(entry.transform);
+            }
+
+            view.rowsDirty = true;
+            state.lazyTree.rowsDirty = true;
+        }
+
+        const uint32_t runLength = state.siblingGroups.runLength[pos];
+        if (view.builtGrouped && runLength != 0 && DrawCollapseGroupButton(entry.transform, runLength))
+        {
+            view.groupExpanded.Reset(pos);
+            view.expandedGroups.erase(entry.transform);
+            view.rowsDirty = true;
+            state.lazyTree.rowsDirty = true;
+        }
+
+        if (indent > 0.0f)
+            ImGui::Unindent(indent);
+    }
+
+    static uint32_t AddLazyNode(
+        LazyHierarchyCache& lazy,
+        Unity::CGameObject* gameObject,
+        Unity::CTransform* transform,
+        int sceneHandle,
+        uint32_t depth,
+        uint32_t parent,
+        int siblingIndex)
+    {
+        // A node seen before keeps its fetched children; they are revalidated when shown.
+        auto existing = lazy.nodeByObject.find(gameObject);
+        if (existing != lazy.nodeByObject.end() && lazy.nodes[existing->second].transform == transform)
+        {
+            LazyHierarchyNode& node = lazy.nodes[existing->second];
+            node.sceneHandle = sceneHandle;
+            node.depth = depth;
+            node.parent = parent;
+            node.siblingIndex = siblingIndex;
+            node.childCount = SafeGetChildCount(transform);
+            node.name = SafeGetObjectName(gameObject);
+            node.stemHash = HashNameStem(NameStem(node.name));
+            return existing->second;
+        }
+
+        LazyHierarchyNode node{};
+        node.gameObject = gameObject;
+        node.transform = transform;
+        node.sceneHandle = sceneHandle;
+        node.depth = depth;
+        node.parent = parent;
+        node.siblingIndex = siblingIndex;
+        node.childCount = SafeGetChildCount(transform);
+        node.name = SafeGetObjectName(gameObject);
+        node.stemHash = HashNameStem(NameStem(node.name));
+
+        const uint32_t index = static_cast<uint32_t>(lazy.nodes.size());
+        lazy.nodes.emplace_back(std::move(node));
+        lazy.nodeByObject[gameObject] = index;
+        return index;
+    }
+
+    static void SortLazyNodesByName(const LazyHierarchyCache& lazy, std::vector<uint32_t>::iterator begin, std::vector<uint32_t>::iterator end)
+    {
+        std::sort(begin, end, [&](uint32_t left, uint32_t right)
+            {
+                return _stricmp(lazy.nodes[left].name.c_str(), lazy.nodes[right].name.c_str()) < 0;
+            });
+    }
+
+    // Without component snapshots the lazy tree can only group by name stem.
+    static void MarkLazySiblingRuns(LazyHierarchyCache& lazy, const std::vector<uint32_t>& siblings)
+    {
+        size_t head = 0;
+        for (size_t i = 0; i <= siblings.size(); ++i)
+        {
+            if (i < siblings.size())
+            {
+                lazy.nodes[siblings[i]].runLength = 0;
+                if (i != head
+                    && lazy.nodes[siblings[i]].stemHash == lazy.nodes[siblings[head]].stemHash
+                    && lazy.nodes[siblings[i]].sceneHandle == lazy.nodes[siblings[head]].sceneHandle)
+                {
+                    continue;
+                }
+            }
+
+            if (i - head >= kMinSiblingGroupRun)
+                lazy.nodes[siblings[head]].runLength = static_cast<uint32_t>(i - head);
+
+            head = i;
+        }
+    }
+
+    // Fetches one node's direct children through Transform.GetChild; nothing below is touched.
+    static void LoadLazyChildren(ExplorerState& state, uint32_t nodeIndex)
+    {
+        LazyHierarchyCache& lazy = state.lazyTree;
+
+        // AddLazyNode grows nodes, so nothing may hold a reference into it across the loop.
+        Unity::CTransform* transform = lazy.nodes[nodeIndex].transform;
+        const int sceneHandle = lazy.nodes[nodeIndex].sceneHandle;
+        const uint32_t childDepth = lazy.nodes[nodeIndex].depth + 1U;
+
+        const int childCount = SafeGetChildCount(transform);
+        std::vector<uint32_t> children;
+        children.reserve(static_cast<size_t>(std::max(childCount, 0)));
+        for (int i = 0; i < childCount; ++i)
+        {
+            Unity::CTransform* child = SafeGetChild(transform, i);
+            Unity::CGameObject* childObject = SafeGetTransformGameObject(child);
+            if (!child || !childObject)
+                continue;
+
+            if (!state.includeInactive && !SafeGetActiveSelf(childObject))
+                continue;
+
+            children.emplace_back(AddLazyNode(lazy, childObject, child, sceneHandle, childDepth, nodeIndex, i));
+        }
+
+        SortLazyNodesByName(lazy, children.begin(), children.end());
+        MarkLazySiblingRuns(lazy, children);
+
+        LazyHierarchyNode& node = lazy.nodes[nodeIndex];
+        node.childCount = childCount;
+        node.children = std::move(children);
+        node.childrenVersion = lazy.version;
+    }
+
+    // A refresh only makes a node's children suspect. They are kept when the live child count
+    // still matches and every cached child is alive (a m_CachedPtr read, no managed call);
+    // otherwise just this node is fetched again.
+    static void RevalidateLazyChildren(ExplorerState& state, uint32_t nodeIndex)
+    {
+        LazyHierarchyCache& lazy = state.lazyTree;
+        LazyHierarchyNode& node = lazy.nodes[nodeIndex];
+
+        bool intact = SafeGetChildCount(node.transform) == node.childCount;
+        for (size_t i = 0; intact && i < node.children.size(); ++i)
+        {
+            const LazyHierarchyNode& child = lazy.nodes[node.children[i]];
+            intact = SafeIsNativeObjectAlive(reinterpret_cast<Unity::il2cppObject*>(child.gameObject))
+                && (state.includeInactive || SafeGetActiveSelf(child.gameObject));
+        }
+
+        if (!intact)
+        {
+            LoadLazyChildren(state, nodeIndex);
+            return;
+        }
+
+        // Collapsed children still need a current count for their expand arrow.
+        for (uint32_t childIndex : node.children)
+            lazy.nodes[childIndex].childCount = SafeGetChildCount(lazy.nodes[childIndex].transform);
+        node.childrenVersion = lazy.version;
+    }
+
+    // A refresh re-lists the roots but keeps every node; a scope change, or too many nodes left
+    // behind by reloads, starts over.
+    static constexpr size_t kMaxLazyNodes = 1U << 18;
+
+    static void ResetLazyHierarchy(ExplorerState& state, bool keepNodes)
+    {
+        LazyHierarchyCache& lazy = state.lazyTree;
+        if (!keepNodes)
+        {
+            lazy.nodes.clear();
+            lazy.nodeByObject.clear();
+        }
+        lazy.roots.clear();
+
+        lazy.builtVersion = lazy.version;
+        lazy.builtSceneHandle = state.selectedSceneHandle;
+        lazy.builtIncludeInactive = state.includeInactive;
+
+        for (const SceneEntry& scene : state.scenes)
+        {
+            if (state.selectedSceneHandle != 0 && scene.scene.m_Handle != state.selectedSceneHandle)
+                continue;
+
+            const size_t sceneBegin = lazy.roots.size();
+            for (size_t i = 0; i < scene.roots.size(); ++i)
+            {
+                Unity::CGameObject* root = scene.roots[i];
+                if (!state.includeInactive && !SafeGetActiveSelf(root))
+                    continue;
+
+                if (Unity::CTransform* transform = SafeGetTransform(root))
+                    lazy.roots.emplace_back(AddLazyNode(lazy, root, transform, scene.scene.m_Handle, 0U, kInvalidIndex, static_cast<int>(i)));
+            }
+
+            SortLazyNodesByName(lazy, lazy.roots.begin() + static_cast<std::ptrdiff_t>(sceneBegin), lazy.roots.end());
+        }
+
+        MarkLazySiblingRuns(lazy, lazy.roots);
+        lazy.rowsDirty = true;
+    }
+
+    // The lazy view is built from SceneEntry::roots, so every scene in scope needs them.
+    static bool LazyHierarchyAvailable(const ExplorerState& state)
+    {
+        for (const SceneEntry& scene : state.scenes)
+        {
+            if (state.selectedSceneHandle != 0 && scene.scene.m_Handle != state.selectedSceneHandle)
+                continue;
+
+            if (!scene.rootsResolved)
+                return false;
+        }
+
+        return true;
+    }
+
+    static void RebuildLazyHierarchyRows(ExplorerState& state)
+    {
+        LazyHierarchyCache& lazy = state.lazyTree;
+        if (lazy.builtSceneHandle != state.selectedSceneHandle
+            || lazy.builtIncludeInactive != state.includeInactive
+            || lazy.nodes.size() > kMaxLazyNodes)
+        {
+            ResetLazyHierarchy(state, false);
+        }
+        else if (lazy.builtVersion != lazy.version)
+        {
+            ResetLazyHierarchy(state, true);
+        }
+
+        if (!lazy.rowsDirty)
+            return;
+
+        const std::unordered_set<Unity::CTransform*>& expandedTransforms = state.hierarchyView.expandedTransforms;
+        const std::unordered_set<Unity::CTransform*>& expandedGroups = state.hierarchyView.expandedGroups;
+
+        // Pushes siblings in reverse so they pop in order; collapsed runs become one group row.
+        std::vector<uint32_t> stack;
+        auto pushSiblings = [&](const std::vector<uint32_t>& siblings)
+            {
+                const size_t stackBegin = stack.size();
+                for (size_t i = 0; i < siblings.size(); ++i)
+                {
+                    const LazyHierarchyNode& node = lazy.nodes[siblings[i]];
+                    if (state.groupRepeatedSiblings && node.runLength != 0 && expandedGroups.find(node.transform) == expandedGroups.end())
+                    {
+                        stack.emplace_back(siblings[i] | kGroupRowFlag);
+                        i += node.runLength - 1U;
+                        continue;
+                    }
+
+                    stack.emplace_back(siblings[i]);
+                }
+
+                std::reverse(stack.begin() + static_cast<std::ptrdiff_t>(stackBegin), stack.end());
+            };
+
+        lazy.rows.clear();
+        pushSiblings(lazy.roots);
+        while (!stack.empty())
+        {
+            const uint32_t index = stack.back();
+            stack.pop_back();
+            lazy.rows.emplace_back(index);
+
+            if ((index & kGroupRowFlag) != 0)
+                continue;
+
+            if (lazy.nodes[index].childCount <= 0 || expandedTransforms.find(lazy.nodes[index].transform) == expandedTransforms.end())
+                continue;
+
+            if (lazy.nodes[index].children.empty() && lazy.nodes[index].childrenVersion == 0)
+                LoadLazyChildren(state, index);
+            else if (lazy.nodes[index].childrenVersion != lazy.version)
+                RevalidateLazyChildren(state, index);
+
+            pushSiblings(lazy.nodes[index].children);
+        }
+
+        lazy.rowsDirty = false;
+    }
+
+    static void DrawLazyHierarchyRow(ExplorerState& state, uint32_t index)
+    {
+        LazyHierarchyCache& lazy = state.lazyTree;
+        HierarchyViewCache& view = state.hierarchyView;
+        const LazyHierarchyNode& node = lazy.nodes[index & ~kGroupRowFlag];
+
+        if ((index & kGroupRowFlag) != 0)
+        {
+            if (DrawSiblingGroupRow(node.transform, node.depth, NameStem(node.name), node.runLength))
+            {
+                view.expandedGroups.insert(node.transform);
+                lazy.rowsDirty = true;
+                view.expansionDirty = true;
+            }
+
+            return;
+        }
+
+        const bool hasChildren = node.childCount > 0;
+        ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+        if (!hasChildren)
+            flags |= ImGuiTreeNodeFlags_Leaf;
+
+        if (state.selectedObject == node.gameObject)
+            flags |= ImGuiTreeNodeFlags_Selected;
+
+        const float indent = static_cast<float>(node.depth) * ImGui::GetStyle().IndentSpacing;
+        if (indent > 0.0f)
+            ImGui::Indent(indent);
+
+        const bool expanded = hasChildren && view.expandedTransforms.find(node.transform) != view.expandedTransforms.end();
+        ImGui::SetNextItemOpen(expanded, ImGuiCond_Always);
+        const bool opened = ImGui::TreeNodeEx(reinterpret_cast<void*>(node.transform), flags, "%s", node.name.c_str());
+        if (ImGui::IsItemClicked(ImGuiMouseButton_Left))
+            SelectObjectDirect(state, node.gameObject);
+
+        if (hasChildren && opened != expanded)
+        {
+            if (opened)
+                view.expandedTransforms.insert(node.transform);
+            else
+                view.expandedTransforms.erase(node.transform);
+
+            lazy.rowsDirty = true;
+            view.expansionDirty = true;
+        }
+
+        if (state.groupRepeatedSiblings && node.runLength != 0 && DrawCollapseGroupButton(node.transform, node.runLength))
+        {
+            view.expandedGroups.erase(node.transform);
+            lazy.rowsDirty = true;
+            view.expansionDirty = true;
+        }
+
+        if (indent > 0.0f)
+            ImGui::Unindent(indent);
+    }
+
+    static void DrawSceneLoader(ExplorerState& state)
+    {
+        ImGui::SeparatorText("Scene Loader");
+        ImGui::InputText("Scene name", state.sceneToLoad, IM_ARRAYSIZE(state.sceneToLoad));
+
+        if (AnimatedButton("Load (Single)", ImVec2(-1.0f, 0.0f)))
+        {
+            if (state.sceneToLoad[0] != '\0')
+            {
+                Unity::SceneManager::LoadScene(state.sceneToLoad, Unity::LoadSceneMode::Single);
+                HBLog::Printf("[UExplorer] LoadScene single: %s\n", state.sceneToLoad);
+                ForceRefresh(state);
+            }
+        }
+
+        if (AnimatedButton("Load (Additive)", ImVec2(-1.0f, 0.0f)))
+        {
+            if (state.sceneToLoad[0] != '\0')
+            {
+                Unity::SceneManager::LoadScene(state.sceneToLoad, Unity::LoadSceneMode::Additive);
+                HBLog::Printf("[UExplorer] LoadScene additive: %s\n", state.sceneToLoad);
+                ForceRefresh(state);
+            }
+        }
+    }
+
+    static void DrawSceneExplorerTab(ExplorerState& state)
+    {
+        ImGui::Checkbox("Auto refresh", &state.autoRefresh);
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Include inactive", &state.includeInactive))
+            ForceRefresh(state);
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Lazy hierarchy", &state.lazyHierarchy) && state.lazyHierarchy)
+            ++state.lazyTree.version;
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Group repeated siblings", &state.groupRepeatedSiblings))
+            state.lazyTree.rowsDirty = true;
+
+        ImGui::Checkbox("Refresh on changes", &state.refreshOnChanges);
+        ImGui::SameLine();
+        if (state.changeHooksActive)
+            ImGui::TextDisabled("(hooks active, %zu pending)", state.pendingChangeEvents);
+        else
+            ImGui::TextDisabled("(hooks unavailable, polling only)");
+
+        int refreshMs = static_cast<int>(state.refreshIntervalMs);
+        if (ImGui::SliderInt("Refresh (ms)", &refreshMs, 250, 5000))
+            state.refreshIntervalMs = static_cast<ULONGLONG>(refreshMs);
+
+        if (AnimatedButton("Refresh now"))
+            ForceRefresh(state);
+
+        ImGui::Checkbox("Capture transforms", &state.captureTransforms);
+        if (state.captureTransforms)
+        {
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(120.0f);
+            ImGui::SliderInt("Budget (us)", &state.captureBudgetMicros, 0, 8000);
+            ImGui::SameLine();
+            int interval = static_cast<int>(state.transformCapture.frameInterval);
+            ImGui::SetNextItemWidth(90.0f);
+            if (ImGui::SliderInt("Every N frames", &interval, 1, 30))
+                state.transformCapture.frameInterval = static_cast<uint32_t>(interval);
+
+            const TransformCapture::Stats& stats = state.transformCapture.GetStats();
+            ImGui::TextDisabled("Sweep %llu: %zu/%zu changed, %zu unreadable, %.2f ms | this frame %zu in %.2f ms",
+                static_cast<unsigned long long>(stats.sweepCount), stats.changedLastSweep, state.transformCapture.Size(),
+                stats.failedLastSweep, stats.microsLastSweep / 1000.0, stats.capturedLastFrame, stats.microsLastFrame / 1000.0);
+        }
+
+        const char* selectedSceneLabel = "All scenes";
+        for (const SceneEntry& scene : state.scenes)
+        {
+            if (scene.scene.m_Handle == state.selectedSceneHandle)
+            {
+                selectedSceneLabel = scene.label.c_str();
+                break;
+            }
+        }
+
+        if (ImGui::BeginCombo("Scene", selectedSceneLabel))
+        {
+            const int previousSceneHandle = state.selectedSceneHandle;
+            if (ImGui::Selectable("All scenes", state.selectedSceneHandle == 0))
+                state.selectedSceneHandle = 0;
+
+            for (const SceneEntry& scene : state.scenes)
+            {
+                const bool selected = (state.selectedSceneHandle == scene.scene.m_Handle);
+                if (ImGui::Selectable(scene.label.c_str(), selected))
+                    state.selectedSceneHandle = scene.scene.m_Handle;
+            }
+
+            ImGui::EndCombo();
+
+            // The object cache is scoped to the selected scene, so switching scenes re-collects.
+            if (state.selectedSceneHandle != previousSceneHandle)
+                RefreshObjects(state);
+        }
+
+        ImGui::InputTextWithHint("##hierarchy_filter", "Search object...", state.hierarchyFilter, IM_ARRAYSIZE(state.hierarchyFilter));
+
+        ImGui::InputTextWithHint("##object_path", "Scene/Root/Child[1]/...", state.pathToResolve, IM_ARRAYSIZE(state.pathToResolve));
+        ImGui::SameLine();
+        if (AnimatedButton("Go to path"))
+        {
+            if (Unity::CGameObject* target = ResolveObjectPath(state, state.pathToResolve))
+                SelectObjectDirect(state, target);
+            else
+                HBLog::Printf("[UExplorer] Path not found: %s\n", state.pathToResolve);
+        }
+
+        // Name filtering has to see every object, so it always runs on the full snapshot.
+        const bool lazyView = state.lazyHierarchy && state.hierarchyFilter[0] == '\0' && LazyHierarchyAvailable(state);
+        if (lazyView)
+        {
+            RebuildLazyHierarchyRows(state);
+            ImGui::TextDisabled("%zu node(s) loaded", state.lazyTree.nodes.size());
+        }
+        else
+        {
+            EnsureObjectCache(state);
+            RebuildHierarchyRows(state);
+        }
+
+        const std::vector<uint32_t>& rows = lazyView ? state.lazyTree.rows : state.hierarchyView.rows;
+
+        ImGui::BeginChild("HierarchyTree", ImVec2(0.0f, -140.0f), true);
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(rows.size()));
+        while (clipper.Step())
+        {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            {
+                if (lazyView)
+                    DrawLazyHierarchyRow(state, rows[static_cast<size_t>(row)]);
+                else
+                    DrawHierarchyRow(state, rows[static_cast<size_t>(row)]);
+            }
+        }
+        ImGui::EndChild();
+
+        DrawSceneLoader(state);
+    }
+
+    static Unity::il2cppFieldInfo* SafeFindFieldByName(Unity::il2cppClass* klass, const char* name)
+    {
+        if (!klass || !name || !IL2CPP::Functions.m_ClassGetFieldFromName)
+            return nullptr;
+
+        __try
+        {
+            // Walks the parent chain, so inherited fields are found too.
+            return reinterpret_cast<Unity::il2cppFieldInfo*(IL2CPP_CALLING_CONVENTION)(void*, const char*)>(IL2CPP::Functions.m_ClassGetFieldFromName)(klass, name);
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return nullptr;
+        }
+    }
+
+    static bool ReadNumericField(Unity::CComponent* component, Unity::il2cppFieldInfo* field, double* outValue)
+    {
+        const bool isStatic = IsStaticField(field);
+        switch (GetFieldTypeEnum(field->m_pType))
+        {
+        case TypeCode_Boolean: { bool v = false; if (!ReadFieldValue(component, field, isStatic, &v)) return false; *outValue = v ? 1.0 : 0.0; return true; }
+        case TypeCode_I1: { int8_t v = 0; if (!ReadFieldValue(component, field, isStatic, &v)) return false; *outValue = v; return true; }
+        case TypeCode_U1: { uint8_t v = 0; if (!ReadFieldValue(component, field, isStatic, &v)) return false; *outValue = v; return true; }
+        case TypeCode_I2: { int16_t v = 0; if (!ReadFieldValue(component, field, isStatic, &v)) return false; *outValue = v; return true; }
+        case TypeCode_U2:
+        case TypeCode_Char: { uint16_t v = 0; if (!ReadFieldValue(component, field, isStatic, &v)) return false; *outValue = v; return true; }
+        case TypeCode_I4: { int32_t v = 0; if (!ReadFieldValue(component, field, isStatic, &v)) return false; *outValue = v; return true; }
+        case TypeCode_U4: { uint32_t v = 0; if (!ReadFieldValue(component, field, isStatic, &v)) return false; *outValue = v; return true; }
+        case TypeCode_R4: { float v = 0.0f; if (!ReadFieldValue(component, field, isStatic, &v)) return false; *outValue = v; return true; }
+        case TypeCode_R8: { double v = 0.0; if (!ReadFieldValue(component, field, isStatic, &v)) return false; *outValue = v; return true; }
+        default: return false;
+        }
+    }
+
+    // True when any component of the object has the field and its value satisfies the compare.
+    static bool ObjectFieldMatches(ExplorerState& state, const ObjectEntry& entry, const QueryPredicate& predicate)
+    {
+        auto snapshotIt = state.componentsByObject.find(entry.gameObject);
+        if (snapshotIt == state.componentsByObject.end())
+            return false;
+
+        std::unordered_map<Unity::il2cppClass*, Unity::il2cppFieldInfo*>& fieldByClass = state.queryFieldsByName[predicate.text];
+        const ComponentSnapshot& snapshot = snapshotIt->second;
+        for (size_t c = 0; c < snapshot.components.size(); ++c)
+        {
+            auto [fieldIt, inserted] = fieldByClass.try_emplace(snapshot.classes[c], nullptr);
+            if (inserted)
+                fieldIt->second = SafeFindFieldByName(snapshot.classes[c], predicate.text.c_str());
+
+            double value = 0.0;
+            if (fieldIt->second && ReadNumericField(snapshot.components[c], fieldIt->second, &value)
+                && CompareQueryNumber(value, predicate.compare, predicate.number))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // Marks the layout subtrees of every object reached by following the literal names.
+    static void CollectPathPrefixHits(const ExplorerState& state, const QueryPredicate& predicate, Bitset* outHits)
+    {
+        const HierarchyLayout& layout = state.hierarchyLayout;
+        outHits->Resize(state.objects.size());
+
+        auto namesEqual = [](const std::string& left, const std::string& right)
+            {
+                return left.size() == right.size() && _stricmp(left.c_str(), right.c_str()) == 0;
+            };
+
+        std::vector<uint32_t> frontier;
+        for (uint32_t pos = 0; pos < layout.Size(); pos = layout.subtreeEnd[pos])
+        {
+            const ObjectEntry& root = state.objects[layout.order[pos]];
+            if (!predicate.text.empty())
+            {
+                const SceneEntry* scene = FindSceneEntry(state, root.sceneHandle);
+                if (!scene || !namesEqual(scene->name, predicate.text))
+                    continue;
+            }
+
+            if (namesEqual(root.name, predicate.segments[0]))
+                frontier.emplace_back(pos);
+        }
+
+        for (size_t depth = 1; depth < predicate.segments.size() && !frontier.empty(); ++depth)
+        {
+            std::vector<uint32_t> next;
+            for (uint32_t parentPos : frontier)
+            {
+                for (uint32_t pos = parentPos + 1U; pos < layout.subtreeEnd[parentPos]; pos = layout.subtreeEnd[pos])
+                {
+                    if (namesEqual(state.objects[layout.order[pos]].name, predicate.segments[depth]))
+                        next.emplace_back(pos);
+                }
+            }
+            frontier = std::move(next);
+        }
+
+        for (uint32_t headPos : frontier)
+        {
+            for (uint32_t pos = headPos; pos < layout.subtreeEnd[headPos]; ++pos)
+                outHits->Set(layout.order[pos]);
+        }
+    }
+
+    // nullptr when the query box is empty or does not parse.
+    static bool QueryUsesComponents(const QueryPlan& plan)
+    {
+        auto usesComponents = [](const QueryPredicate& predicate)
+            {
+                return predicate.kind == QueryPredicateKind::Type || predicate.kind == QueryPredicateKind::Field;
+            };
+
+        return std::any_of(plan.indexed.begin(), plan.indexed.end(), usesComponents)
+            || std::any_of(plan.filters.begin(), plan.filters.end(), usesComponents);
+    }
+
+    // Type and field predicates see the snapshots filled so far; their results are refreshed
+    // each time TickComponentSnapshots publishes more.
+    static const Bitset* EvaluateObjectQuery(ExplorerState& state)
+    {
+        ObjectQueryCache& query = state.objectSearch.query;
+        if (query.text != state.queryText)
+        {
+            query.text = state.queryText;
+            std::vector<QueryPredicate> predicates;
+            query.valid = ParseObjectQuery(query.text, &predicates, &query.error) && !predicates.empty();
+            if (query.valid)
+                PlanObjectQuery(predicates, &query.plan);
+            else
+                query.plan = {};
+            query.generation = 0;
+
+            // Only what the new plan can use is kept, which also bounds the field lookups.
+            std::unordered_set<std::string> keys;
+            std::unordered_set<std::string> fieldNames;
+            for (const QueryPredicate& predicate : query.plan.filters)
+            {
+                keys.insert(QueryPredicateKey(predicate));
+                if (predicate.kind == QueryPredicateKind::Field)
+                    fieldNames.insert(predicate.text);
+            }
+
+            std::erase_if(query.verdicts, [&](const auto& entry) { return keys.count(entry.first) == 0; });
+            std::erase_if(state.queryFieldsByName, [&](const auto& entry) { return fieldNames.count(entry.first) == 0; });
+        }
+
+        if (!query.valid)
+            return nullptr;
+
+        const bool usesComponents = QueryUsesComponents(query.plan);
+        if (query.generation == state.objectCacheGeneration
+            && (!usesComponents || query.componentGeneration == state.componentIndexGeneration))
+        {
+            return &query.hits;
+        }
+
+        const auto evalBegin = std::chrono::steady_clock::now();
+        query.generation = state.objectCacheGeneration;
+        query.stageCounts.clear();
+        query.filterTests = 0;
+
+        if (query.verdictGeneration != state.objectCacheGeneration)
+        {
+            query.verdicts.clear();
+            query.verdictGeneration = state.objectCacheGeneration;
+        }
+        else if (query.componentGeneration != state.componentIndexGeneration)
+        {
+            // Objects without components yet failed every field test.
+            for (const QueryPredicate& predicate : query.plan.filters)
+            {
+                if (predicate.kind == QueryPredicateKind::Field)
+                    query.verdicts.erase(QueryPredicateKey(predicate));
+            }
+        }
+        query.componentGeneration = state.componentIndexGeneration;
+
+        const size_t objectCount = state.objects.size();
+        query.hits.Resize(objectCount, true);
+
+        Bitset stageHits;
+        std::vector<uint32_t> ids;
+        for (const QueryPredicate& predicate : query.plan.indexed)
+        {
+            stageHits.Resize(objectCount);
+            switch (predicate.kind)
+            {
+            case QueryPredicateKind::Attribute:
+            {
+                AttributeTerm term{};
+                term.kind = predicate.attribute;
+                term.value = predicate.attributeValue;
+                if (const Bitset* bits = state.attributeIndex.Find(term); bits && bits->bitCount == objectCount)
+                    stageHits = *bits;
+                break;
+            }
+            case QueryPredicateKind::Scene:
+                // A scene's objects are one contiguous run of layout positions.
+                for (const SceneEntry& scene : state.scenes)
+                {
+                    auto rangeIt = state.sceneLayoutRanges.find(scene.scene.m_Handle);
+                    if (rangeIt == state.sceneLayoutRanges.end() || ToLowerCopy(scene.name) != predicate.text)
+                        continue;
+
+                    for (uint32_t pos = rangeIt->second.first; pos < rangeIt->second.second; ++pos)
+                        stageHits.Set(state.hierarchyLayout.order[pos]);
+                }
+                break;
+            case QueryPredicateKind::Type:
+                state.componentTypeIndex.QueryLabelBitset(predicate.text, objectCount, &stageHits);
+                break;
+            case QueryPredicateKind::Name:
+                state.nameIndex.Query(predicate.text, &ids);
+                for (uint32_t id : ids)
+                    stageHits.Set(id);
+                break;
+            case QueryPredicateKind::PathPrefix:
+                CollectPathPrefixHits(state, predicate, &stageHits);
+                break;
+            default:
+                break;
+            }
+
+            if (predicate.negate)
+                query.hits.AndNotWith(stageHits);
+            else
+                query.hits.AndWith(stageHits);
+            query.stageCounts.emplace_back(query.hits.Count());
+        }
+
+        // Per-candidate stages, cheapest first; each one only sees what the previous kept, and
+        // only tests the candidates it has no verdict for yet.
+        std::vector<ObjectPathSegment> pathSegments;
+        for (const QueryPredicate& predicate : query.plan.filters)
+        {
+            QueryFilterVerdicts& verdicts = query.verdicts[QueryPredicateKey(predicate)];
+            if (verdicts.tested.bitCount != objectCount)
+            {
+                verdicts.tested.Resize(objectCount);
+                verdicts.passed.Resize(objectCount);
+            }
+
+            query.hits.ForEachSet([&](size_t id)
+                {
+                    if (verdicts.tested.Test(id))
+                    {
+                        if (verdicts.passed.Test(id) == predicate.negate)
+                            query.hits.Reset(id);
+                        return;
+                    }
+
+                    const ObjectEntry& entry = state.objects[id];
+                    bool matches = false;
+                    switch (predicate.kind)
+                    {
+                    case QueryPredicateKind::Depth:
+                        matches = CompareQueryNumber(state.hierarchyLayout.depth[state.hierarchyLayout.position[id]], predicate.compare, predicate.number);
+                        break;
+                    case QueryPredicateKind::NameGlob:
+                        matches = GlobMatch(predicate.text, entry.name);
+                        break;
+                    case QueryPredicateKind::PathGlob:
+                        BuildCachedPathSegments(state, static_cast<uint32_t>(id), &pathSegments);
+                        matches = PathGlobMatch(predicate.path, 0, pathSegments, 0);
+                        break;
+                    case QueryPredicateKind::Field:
+                        matches = ObjectFieldMatches(state, entry, predicate);
+                        break;
+                    default:
+                        matches = true;
+                        break;
+                    }
+
+                    verdicts.tested.Set(id);
+                    if (matches)
+                        verdicts.passed.Set(id);
+                    ++query.filterTests;
+
+                    if (matches == predicate.negate)
+                        query.hits.Reset(id);
+                });
+            query.stageCounts.emplace_back(query.hits.Count());
+        }
+
+        query.evalMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - evalBegin).count();
+        return &query.hits;
+    }
+
+    static const std::vector<uint32_t>& RebuildObjectSearchResults(ExplorerState& state)
+    {
+        ObjectSearchCache& search = state.objectSearch;
+        state.attributeFilter.withComponent = state.withComponentFilter;
+        state.attributeFilter.withoutComponent = state.withoutComponentFilter;
+
+        const bool usesComponents = state.classFilter[0] || state.withComponentFilter[0] || state.withoutComponentFilter[0] || state.queryText[0];
+        if (search.generation == state.objectCacheGeneration
+            && (!usesComponents || search.componentGeneration == state.componentIndexGeneration)
+            && search.sceneHandle == state.selectedSceneHandle
+            && search.nameFilter == state.nameFilter
+            && search.classFilter == state.classFilter
+            && search.attributeFilter == state.attributeFilter
+            && search.queryText == state.queryText)
+        {
+            return search.matches;
+        }
+
+        search.generation = state.objectCacheGeneration;
+        search.componentGeneration = state.componentIndexGeneration;
+        search.sceneHandle = state.selectedSceneHandle;
+        search.nameFilter = state.nameFilter;
+        search.classFilter = state.classFilter;
+        search.attributeFilter = state.attributeFilter;
+        search.queryText = state.queryText;
+
+        const std::vector<uint32_t>& nameMatches = QueryNameMatches(state, search.nameQuery, search.nameFilter.c_str());
+
+        // Class and attribute filters are folded into one bitmap before the name matches are walked.
+        const size_t objectCount = state.objects.size();
+        const AttributeFilterSettings& filter = search.attributeFilter;
+        Bitset withHits;
+        Bitset withoutHits;
+        Bitset classHits;
+        std::vector<AttributeTerm> terms;
+
+        if (!search.classFilter.empty())
+        {
+            state.componentTypeIndex.QueryLabelBitset(ToLowerCopy(search.classFilter), objectCount, &classHits);
+            terms.push_back({ AttributeKind::External, 0, false, &classHits });
+        }
+        if (filter.active != 0)
+            terms.push_back({ AttributeKind::Active, 0, filter.active == 2 });
+        if (filter.layer >= 0)
+            terms.push_back({ AttributeKind::Layer, filter.layer, false });
+        if (filter.root != 0)
+            terms.push_back({ AttributeKind::Root, 0, filter.root == 2 });
+        if (filter.depthBucket >= 0)
+            terms.push_back({ AttributeKind::DepthBucket, filter.depthBucket, false });
+        if (!filter.withComponent.empty())
+        {
+            state.componentTypeIndex.QueryLabelBitset(ToLowerCopy(filter.withComponent), objectCount, &withHits);
+            terms.push_back({ AttributeKind::External, 0, false, &withHits });
+        }
+        if (!filter.withoutComponent.empty())
+        {
+            state.componentTypeIndex.QueryLabelBitset(ToLowerCopy(filter.withoutComponent), objectCount, &withoutHits);
+            terms.push_back({ AttributeKind::External, 0, true, &withoutHits });
+        }
+
+        if (const Bitset* queryHits = EvaluateObjectQuery(state))
+            terms.push_back({ AttributeKind::External, 0, false, queryHits });
+
+        Bitset attributeHits;
+        search.attributeFiltered = !terms.empty();
+        if (search.attributeFiltered)
+        {
+            const auto evalBegin = std::chrono::steady_clock::now();
+            state.attributeIndex.Evaluate(terms, &attributeHits);
+            search.attributeHitCount = attributeHits.Count();
+            search.attributeEvalMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - evalBegin).count();
+        }
+
+        search.matches.clear();
+        search.matches.reserve(nameMatches.size());
+        for (uint32_t index : nameMatches)
+        {
+            if (search.attributeFiltered && !attributeHits.Test(index))
+                continue;
+
+            if (!SceneFilterPasses(state, state.objects[index]))
+                continue;
+
+            search.matches.emplace_back(index);
+        }
+
+        search.rowsDirty = true;
+        return search.matches;
+    }
+
+    // Matches that share a fingerprint collapse into one "Name ×N" row at the position of their
+    // first member; opening it lists the members right below.
+    static const std::vector<uint32_t>& RebuildObjectSearchRows(ExplorerState& state)
+    {
+        ObjectSearchCache& search = state.objectSearch;
+        const std::vector<uint32_t>& matches = RebuildObjectSearchResults(state);
+        if (!search.rowsDirty && search.builtGrouped == state.groupRepeatedSiblings)
+            return search.rows;
+
+        search.rowsDirty = false;
+        search.builtGrouped = state.groupRepeatedSiblings;
+        search.rows.clear();
+        search.groups.clear();
+        search.groupFingerprints.clear();
+
+        if (!search.builtGrouped)
+        {
+            search.rows = matches;
+            return search.rows;
+        }
+
+        std::unordered_map<uint64_t, uint32_t> countByFingerprint;
+        for (uint32_t index : matches)
+            ++countByFingerprint[state.objects[index].fingerprint];
+
+        std::unordered_map<uint64_t, uint32_t> groupByFingerprint;
+        std::vector<uint32_t> layoutRows;
+        layoutRows.reserve(matches.size());
+        for (uint32_t index : matches)
+        {
+            const uint64_t fingerprint = state.objects[index].fingerprint;
+            if (fingerprint == 0 || countByFingerprint[fingerprint] < kMinSiblingGroupRun)
+            {
+                layoutRows.emplace_back(index);
+                continue;
+            }
+
+            auto [groupIt, inserted] = groupByFingerprint.try_emplace(fingerprint, static_cast<uint32_t>(search.groups.size()));
+            if (inserted)
+            {
+                search.groups.emplace_back();
+                search.groupFingerprints.emplace_back(fingerprint);
+                layoutRows.emplace_back(groupIt->second | kGroupRowFlag);
+            }
+
+            search.groups[groupIt->second].emplace_back(index);
+        }
+
+        for (uint32_t row : layoutRows)
+        {
+            search.rows.emplace_back(row);
+            if ((row & kGroupRowFlag) == 0)
+                continue;
+
+            const uint32_t group = row & ~kGroupRowFlag;
+            if (search.expandedGroups.find(search.groupFingerprints[group]) != search.expandedGroups.end())
+                search.rows.insert(search.rows.end(), search.groups[group].begin(), search.groups[group].end());
+        }
+
+        return search.rows;
+    }
+
+    static void DrawObjectSearchTab(ExplorerState& state)
+    {
+        ImGui::InputTextWithHint("Class filter", "e.g. UnityEngine.Camera", state.classFilter, IM_ARRAYSIZE(state.classFilter));
+        ImGui::InputTextWithHint("Name contains", "e.g. Main", state.nameFilter, IM_ARRAYSIZE(state.nameFilter));
+
+        if (AnimatedButton("Refresh results"))
+        {
+            MarkComponentSnapshotsForRescan(state);
+            RefreshSceneCache(state);
+            RefreshObjectCache(state);
+        }
+
+        ImGui::InputTextWithHint("Query", "e.g. t:Rigidbody n:enemy* active:1 field:health<10", state.queryText, IM_ARRAYSIZE(state.queryText));
+        if (ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip(
+                "name  n:glob*  t:Type  active:0|1  self:0|1  root:0|1  layer:N  depth<N\n"
+                "scene:Name  path:/Root/**  field:name<op>number   prefix '-' to negate");
+        }
+
+        const ObjectQueryCache& query = state.objectSearch.query;
+        if (!query.valid && !query.error.empty())
+        {
+            ImGui::TextColored(ImVec4(1.0f, 0.45f, 0.45f, 1.0f), "%s", query.error.c_str());
+        }
+        else if (query.valid && ImGui::TreeNode("Query plan"))
+        {
+            size_t stage = 0;
+            auto drawStage = [&](const QueryPredicate& predicate, const char* how)
+                {
+                    const size_t remaining = stage < query.stageCounts.size() ? query.stageCounts[stage] : 0;
+                    ImGui::BulletText("%s %s%s %s -> %zu", how, predicate.negate ? "not " : "", QueryPredicateKindName(predicate.kind), predicate.text.c_str(), remaining);
+                    ++stage;
+                };
+
+            for (const QueryPredicate& predicate : query.plan.indexed)
+                drawStage(predicate, "index");
+            for (const QueryPredicate& predicate : query.plan.filters)
+                drawStage(predicate, "scan");
+            ImGui::TextDisabled("%.1f us, %zu filter test(s)", query.evalMicros, query.filterTests);
+            ImGui::TreePop();
+        }
+
+        if (ImGui::CollapsingHeader("Attribute filters"))
+        {
+            AttributeFilterSettings& filter = state.attributeFilter;
+            const char* activeModes[] = { "Any", "Active", "Inactive" };
+            const char* rootModes[] = { "Any", "Roots only", "Children only" };
+            const char* depthModes[] = { "Any", "0", "1", "2", "3", "4-7", "8+" };
+
+            ImGui::SetNextItemWidth(120.0f);
+            ImGui::Combo("Active", &filter.active, activeModes, IM_ARRAYSIZE(activeModes));
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(120.0f);
+            ImGui::Combo("Hierarchy", &filter.root, rootModes, IM_ARRAYSIZE(rootModes));
+
+            int layerItem = filter.layer + 1;
+            ImGui::SetNextItemWidth(120.0f);
+            if (ImGui::SliderInt("Layer", &layerItem, 0, static_cast<int>(AttributeIndex::kLayerCount), layerItem == 0 ? "Any" : "%d"))
+                filter.layer = layerItem - 1;
+            ImGui::SameLine();
+            int depthItem = filter.depthBucket + 1;
+            ImGui::SetNextItemWidth(120.0f);
+            if (ImGui::Combo("Depth", &depthItem, depthModes, IM_ARRAYSIZE(depthModes)))
+                filter.depthBucket = depthItem - 1;
+
+            ImGui::InputTextWithHint("With component", "e.g. Rigidbody", state.withComponentFilter, IM_ARRAYSIZE(state.withComponentFilter));
+            ImGui::InputTextWithHint("Without component", "e.g. Collider", state.withoutComponentFilter, IM_ARRAYSIZE(state.withoutComponentFilter));
+        }
+
+        EnsureObjectCache(state);
+
+        const std::vector<uint32_t>& rows = RebuildObjectSearchRows(state);
+        ObjectSearchCache& search = state.objectSearch;
+
+        ImGui::Text("Results: %zu", search.matches.size());
+        if (!search.groups.empty())
+        {
+            ImGui::SameLine();
+            ImGui::TextDisabled("(%zu group(s) of similar objects)", search.groups.size());
+        }
+        if (search.attributeFiltered)
+            ImGui::TextDisabled("Filters: %zu of %zu object(s) in %.1f us", search.attributeHitCount, state.objects.size(), search.attributeEvalMicros);
+        if (search.attributeFiltered && state.pendingComponentSnapshots > 0)
+            ImGui::TextDisabled("Indexing components: %zu object(s) left, type and field filters may miss them", state.pendingComponentSnapshots);
+        ImGui::Separator();
+
+        ImGui::BeginChild("ObjectSearchResults", ImVec2(0.0f, 0.0f), true);
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(rows.size()));
+
+        while (clipper.Step())
+        {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            {
+                const uint32_t value = rows[static_cast<size_t>(row)];
+                if ((value & kGroupRowFlag) != 0)
+                {
+                    const uint32_t group = value & ~kGroupRowFlag;
+                    const uint64_t fingerprint = search.groupFingerprints[group];
+                    const ObjectEntry& first = state.objects[search.groups[group].front()];
+                    const bool expanded = search.expandedGroups.find(fingerprint) != search.expandedGroups.end();
+
+                    ImGui::PushID(static_cast<int>(group));
+                    ImGui::SetNextItemOpen(expanded, ImGuiCond_Always);
+                    const std::string_view stem = NameStem(first.name);
+                    const bool opened = ImGui::TreeNodeEx("SearchGroup", ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_SpanAvailWidth,
+                        "%.*s \xC3\x97%zu", static_cast<int>(stem.size()), stem.data(), search.groups[group].size());
+                    ImGui::PopID();
+
+                    if (opened != expanded)
+                    {
+                        if (opened)
+                            search.expandedGroups.insert(fingerprint);
+                        else
+                            search.expandedGroups.erase(fingerprint);
+                        search.rowsDirty = true;
+                    }
+                    continue;
+                }
+
+                ObjectEntry& entry = state.objects[value];
+                const bool selected = (state.selectedObject == entry.gameObject);
+
+                std::string label = entry.name + "##" + std::to_string(reinterpret_cast<uintptr_t>(entry.gameObject));
+                if (ImGui::Selectable(label.c_str(), selected))
+                    SelectObjectDirect(state, entry.gameObject);
+            }
+        }
+
+        ImGui::EndChild();
+    }
+
+    static void DrawChurnTab(ExplorerState& state)
+    {
+        ChurnState& churn = state.churn;
+
+        ImGui::Checkbox("Record spawns/destroys", &churn.recording);
+        ImGui::SameLine();
+        if (AnimatedButton("Reset"))
+        {
+            churn.byStem.Clear();
+            churn.bySignature.Clear();
+            churn.spawned.Clear();
+            churn.eventsRecorded = 0;
+            churn.eventsDropped = 0;
+            churn.selectedKey = 0;
+        }
+
+        if (!state.changeHooksActive)
+            ImGui::TextDisabled("Instantiate/Destroy hooks are not installed; nothing will be recorded.");
+
+        const char* groupModes[] = { "Name stem", "Components" };
+        ImGui::SetNextItemWidth(160.0f);
+        if (ImGui::Combo("Group by", &churn.groupBy, groupModes, IM_ARRAYSIZE(groupModes)))
+            churn.selectedKey = 0;
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(120.0f);
+        const int maxWindowSeconds = static_cast<int>(ChurnProfiler::kBucketCount * ChurnProfiler::kBucketMs / 1000U);
+        ImGui::SliderInt("Window (s)", &churn.windowSeconds, 1, maxWindowSeconds);
+
+        ImGui::TextDisabled("%llu event(s) recorded, %llu dropped (counted while the overlay is hidden too).",
+            static_cast<unsigned long long>(churn.eventsRecorded),
+            static_cast<unsigned long long>(churn.eventsDropped));
+
+        const ChurnProfiler& profiler = churn.groupBy == 0 ? churn.byStem : churn.bySignature;
+        const uint64_t now = GetTickCount64();
+        profiler.TopChurners(now, static_cast<uint32_t>(churn.windowSeconds) * 1000U, 64U, &churn.rates);
+
+        const float plotHeight = 60.0f;
+        const bool hasSelection = churn.selectedKey != 0;
+        ImGui::BeginChild("ChurnTable", ImVec2(0.0f, hasSelection ? -(plotHeight * 2.0f + 24.0f) : 0.0f), true);
+        if (ImGui::BeginTable("ChurnRates", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY))
+        {
+            ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Spawn/s", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+            ImGui::TableSetupColumn("Destroy/s", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+            ImGui::TableSetupColumn("Spawned", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+            ImGui::TableSetupColumn("Destroyed", ImGuiTableColumnFlags_WidthFixed, 70.0f);
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableHeadersRow();
+
+            for (const ChurnProfiler::Rate& rate : churn.rates)
+            {
+                const ChurnProfiler::Series& series = profiler.At(rate.series);
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+
+                ImGui::PushID(static_cast<int>(rate.series));
+                if (ImGui::Selectable(series.label.c_str(), churn.selectedKey == series.key, ImGuiSelectableFlags_SpanAllColumns))
+                    churn.selectedKey = series.key;
+                ImGui::PopID();
+
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", rate.createdPerSecond);
+                ImGui::TableNextColumn();
+                ImGui::Text("%.1f", rate.destroyedPerSecond);
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(series.totalCreated));
+                ImGui::TableNextColumn();
+                ImGui::Text("%llu", static_cast<unsigned long long>(series.totalDestroyed));
+            }
+
+            ImGui::EndTable();
+        }
+        ImGui::EndChild();
+
+        if (!hasSelection)
+            return;
+
+        for (uint32_t i = 0; i < profiler.Size(); ++i)
+        {
+            const ChurnProfiler::Series& series = profiler.At(i);
+            if (series.key != churn.selectedKey)
+                continue;
+
+            float history[ChurnProfiler::kBucketCount]{};
+            profiler.CopyHistory(series, now, true, history);
+            ImGui::PlotHistogram("Spawned", history, IM_ARRAYSIZE(history), 0, series.label.c_str(), 0.0f, FLT_MAX, ImVec2(-80.0f, plotHeight));
+            profiler.CopyHistory(series, now, false, history);
+            ImGui::PlotHistogram("Destroyed", history, IM_ARRAYSIZE(history), 0, nullptr, 0.0f, FLT_MAX, ImVec2(-80.0f, plotHeight));
+            break;
+        }
+    }
+
+    static void DrawNearbyTab(ExplorerState& state)
+    {
+        NearbyState& nearby = state.nearby;
+        nearby.tabVisible = true;
+
+        const char* modes[] = { "Within radius", "K nearest", "In camera view" };
+        ImGui::SetNextItemWidth(160.0f);
+        ImGui::Combo("Query", &nearby.mode, modes, IM_ARRAYSIZE(modes));
+
+        if (nearby.mode != 2)
+        {
+            const char* centers[] = { "Selected object", "Main camera", "Custom point" };
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(160.0f);
+            ImGui::Combo("Around", &nearby.center, centers, IM_ARRAYSIZE(centers));
+            if (nearby.center == 2)
+                ImGui::InputFloat3("Point", nearby.customCenter);
+
+            ImGui::SetNextItemWidth(200.0f);
+            if (nearby.mode == 0)
+                ImGui::SliderFloat("Radius", &nearby.radius, 0.5f, 500.0f, "%.1f", ImGuiSliderFlags_Logarithmic);
+            else
+                ImGui::SliderInt("Count", &nearby.nearestCount, 1, 256);
+        }
+
+        ImGui::SetNextItemWidth(200.0f);
+        ImGui::SliderFloat("Cell size", &nearby.cellSize, 0.25f, 64.0f, "%.2f", ImGuiSliderFlags_Logarithmic);
+
+        SyncSpatialIndex(state);
+        RunNearbyQuery(state);
+
+        const TransformCapture& capture = state.transformCapture;
+        if (capture.GetStats().sweepCount == 0)
+        {
+            ImGui::TextDisabled("Capturing transforms (%zu/%zu)...", capture.Cursor(), capture.Size());
+            return;
+        }
+
+        ImGui::TextDisabled("%zu indexed | %s %zu in %.2f ms | query %.3f ms",
+            nearby.grid.InsertedCount(), nearby.lastSyncRebuilt ? "rebuilt" : "patched", nearby.lastPatched,
+            nearby.lastSyncMs, nearby.lastQueryMs);
+
+        if (!nearby.centerValid)
+        {
+            ImGui::TextDisabled((nearby.mode != 2 && nearby.center == 0) ? "Select an object with a captured transform." : "Camera.main is unavailable.");
+            return;
+        }
+
+        ImGui::TextDisabled("Center (%.2f, %.2f, %.2f), %zu result(s)", nearby.lastCenter[0], nearby.lastCenter[1], nearby.lastCenter[2], nearby.results.size());
+
+        ImGui::BeginChild("NearbyResults", ImVec2(0.0f, 0.0f), true);
+        if (ImGui::BeginTable("NearbyTable", 2, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY))
+        {
+            ImGui::TableSetupColumn("Name", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Distance", ImGuiTableColumnFlags_WidthFixed, 80.0f);
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableHeadersRow();
+
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(nearby.results.size()));
+            while (clipper.Step())
+            {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+                {
+                    const SpatialGrid::Neighbor& hit = nearby.results[static_cast<size_t>(row)];
+                    if (hit.id >= state.objects.size())
+                        continue;
+
+                    const ObjectEntry& entry = state.objects[hit.id];
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+
+                    ImGui::PushID(static_cast<int>(hit.id));
+                    if (ImGui::Selectable(entry.name.c_str(), state.selectedObject == entry.gameObject, ImGuiSelectableFlags_SpanAllColumns))
+                        SelectObjectDirect(state, entry.gameObject);
+                    ImGui::PopID();
+
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.2f", std::sqrt(hit.distanceSq));
+                }
+            }
+
+            ImGui::EndTable();
+        }
+        ImGui::EndChild();
+    }
+
+    template<typename T>
+    static bool ReadFieldValue(Unity::CComponent* component, Unity::il2cppFieldInfo* field, bool isStatic, T* outValue)
+    {
+        if (!component || !field || !outValue)
+            return false;
+
+        if (isStatic)
+            return TryGetStaticFieldValue(field, outValue);
+
+        __try
+        {
+            *outValue = component->GetMemberValue<T>(field);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    template<typename T>
+    static bool WriteFieldValue(Unity::CComponent* component, Unity::il2cppFieldInfo* field, bool isStatic, T value)
+    {
+        if (!component || !field)
+            return false;
+
+        if (isStatic)
+            return TrySetStaticFieldValue(field, &value);
+
+        __try
+        {
+            component->SetMemberValue<T>(field, value);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    static bool IsSupportedEditableType(unsigned int typeCode)
+    {
+        switch (typeCode)
+        {
+        case TypeCode_Boolean:
+        case TypeCode_String:
+        case TypeCode_R4:
+        case TypeCode_R8:
+        case TypeCode_I4:
+        case TypeCode_U4:
+        case TypeCode_I2:
+        case TypeCode_U2:
+        case TypeCode_I1:
+        case TypeCode_U1:
+        case TypeCode_Char:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static std::string BuildFieldDraftFromCurrentValue(
+        Unity::CComponent* component,
+        Unity::il2cppFieldInfo* field,
+        bool isStatic,
+        unsigned int typeCode)
+    {
+        char buffer[128]{};
+
+        switch (typeCode)
+        {
+        case TypeCode_Boolean:
+        {
+            bool value = false;
+            ReadFieldValue(component, field, isStatic, &value);
+            return value ? "true" : "false";
+        }
+        case TypeCode_I4:
+        {
+            int value = 0;
+            ReadFieldValue(component, field, isStatic, &value);
+            std::snprintf(buffer, sizeof(buffer), "%d", value);
+            return buffer;
+        }
+        case TypeCode_U4:
+        {
+            uint32_t value = 0;
+            ReadFieldValue(component, field, isStatic, &value);
+            std::snprintf(buffer, sizeof(buffer), "%u", value);
+            return buffer;
+        }
+        case TypeCode_R4:
+        {
+            float value = 0.0f;
+            ReadFieldValue(component, field, isStatic, &value);
+            std::snprintf(buffer, sizeof(buffer), "%.6f", value);
+            return buffer;
+        }
+        case TypeCode_R8:
+        {
+            double value = 0.0;
+            ReadFieldValue(component, field, isStatic, &value);
+            std::snprintf(buffer, sizeof(buffer), "%.9f", value);
+            return buffer;
+        }
+        case TypeCode_I2:
+        {
+            short value = 0;
+            ReadFieldValue(component, field, isStatic, &value);
+            std::snprintf(buffer, sizeof(buffer), "%d", static_cast<int>(value));
+            return buffer;
+        }
+        case TypeCode_U2:
+        {
+            uint16_t value = 0;
+            ReadFieldValue(component, field, isStatic, &value);
+            std::snprintf(buffer, sizeof(buffer), "%u", static_cast<unsigned int>(value));
+            return buffer;
+        }
+        case TypeCode_I1:
+        {
+            int8_t value = 0;
+            ReadFieldValue(component, field, isStatic, &value);
+            std::snprintf(buffer, sizeof(buffer), "%d", static_cast<int>(value));
+            return buffer;
+        }
+        case TypeCode_U1:
+        {
+            unsigned char value = 0;
+            ReadFieldValue(component, field, isStatic, &value);
+            std::snprintf(buffer, sizeof(buffer), "%u", static_cast<unsigned int>(value));
+            return buffer;
+        }
+        case TypeCode_Char:
+        {
+            uint16_t value = 0;
+            ReadFieldValue(component, field, isStatic, &value);
+            const char printable = static_cast<char>(value & 0xFFU);
+            if (printable >= 0x20 && printable <= 0x7E)
+                std::snprintf(buffer, sizeof(buffer), "%c", printable);
+            else
+                std::snprintf(buffer, sizeof(buffer), "%u", static_cast<unsigned int>(value));
+            return buffer;
+        }
+        case TypeCode_String:
+        {
+            Unity::System_String* value = nullptr;
+            ReadFieldValue(component, field, isStatic, &value);
+            return UnityStringToUtf8(value);
+        }
+        default:
+            return {};
+        }
+    }
+
+    static bool ApplyFieldDraftValue(
+        Unity::CComponent* component,
+        Unity::il2cppFieldInfo* field,
+        bool isStatic,
+        unsigned int typeCode,
+        const std::string& textDraft)
+    {
+        switch (typeCode)
+        {
+        case TypeCode_Boolean:
+        {
+            bool value = false;
+            if (!ParseBoolText(textDraft, &value))
+                return false;
+            return WriteFieldValue(component, field, isStatic, value);
+        }
+        case TypeCode_I4:
+        {
+            int value = 0;
+            if (!ParseSignedIntegerText<int>(textDraft, &value))
+                return false;
+            return WriteFieldValue(component, field, isStatic, value);
+        }
+        case TypeCode_U4:
+        {
+            uint32_t value = 0;
+            if (!ParseUnsignedIntegerText<uint32_t>(textDraft, &value))
+                return false;
+            return WriteFieldValue(component, field, isStatic, value);
+        }
+        case TypeCode_R4:
+        {
+            float value = 0.0f;
+            if (!ParseFloatText(textDraft, &value))
+                return false;
+            return WriteFieldValue(component, field, isStatic, value);
+        }
+        case TypeCode_R8:
+        {
+            double value = 0.0;
+            if (!ParseDoubleText(textDraft, &value))
+                return false;
+            return WriteFieldValue(component, field, isStatic, value);
+        }
+        case TypeCode_I2:
+        {
+            short value = 0;
+            if (!ParseSignedIntegerText<short>(textDraft, &value))
+                return false;
+            return WriteFieldValue(component, field, isStatic, value);
+        }
+        case TypeCode_U2:
+        {
+            uint16_t value = 0;
+            if (!ParseUnsignedIntegerText<uint16_t>(textDraft, &value))
+                return false;
+            return WriteFieldValue(component, field, isStatic, value);
+        }
+        case TypeCode_I1:
+        {
+            int8_t value = 0;
+            if (!ParseSignedIntegerText<int8_t>(textDraft, &value))
+                return false;
+            return WriteFieldValue(component, field, isStatic, value);
+        }
+        case TypeCode_U1:
+        {
+            unsigned char value = 0;
+            if (!ParseUnsignedIntegerText<unsigned char>(textDraft, &value))
+                return false;
+            return WriteFieldValue(component, field, isStatic, value);
+        }
+        case TypeCode_Char:
+        {
+            uint16_t value = 0;
+            if (!ParseCharText(textDraft, &value))
+                return false;
+            return WriteFieldValue(component, field, isStatic, value);
+        }
+        case TypeCode_String:
+        {
+            Unity::System_String* value = IL2CPP::String::New(textDraft.c_str());
+            if (!value)
+                return false;
+            return WriteFieldValue<Unity::System_String*>(component, field, isStatic, value);
+        }
+        default:
+            return false;
+        }
+    }
+
+    static bool IsSupportedMethodArgType(unsigned int typeCode)
+    {
+        return IsSupportedEditableType(typeCode);
+    }
+
+    static bool IsInspectableReferenceType(unsigned int typeCode)
+    {
+        switch (typeCode)
+        {
+        case TypeCode_Object:
+        case TypeCode_Class:
+        case Unity::Type_Array:
+        case Unity::Type_Variable:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    static std::string BuildDefaultMethodArgDraft(unsigned int typeCode)
+    {
+        switch (typeCode)
+        {
+        case TypeCode_Boolean:
+            return "false";
+        case TypeCode_String:
+            return {};
+        case TypeCode_R4:
+        case TypeCode_R8:
+            return "0.0";
+        case TypeCode_Char:
+            return "A";
+        default:
+            return "0";
+        }
+    }
+
+    // Overrides and hiding members share name and parameter types with the base declaration.
+    static std::string BuildMethodOverrideKey(Unity::il2cppMethodInfo* method, const char* rawName, uint32_t argCount)
+    {
+        std::string key = SanitizeMemberName(rawName);
+        key += '(';
+        const uint32_t keyedArgs = (argCount > kHardMethodArgsLimit) ? 0U : argCount;
+        for (uint32_t argIndex = 0; argIndex < keyedArgs; ++argIndex)
+        {
+            if (argIndex)
+                key += ',';
+            key += GetFieldTypeName(SafeGetMethodParamType(method, argIndex));
+        }
+        key += ')';
+        return key;
+    }
+
+    static void FillMethodLayout(const ExplorerState& state, MethodLayout* entry)
+    {
+        Unity::il2cppMethodInfo* method = entry->method;
+        const char* rawMethodName = nullptr;
+        Unity::il2cppType* returnType = nullptr;
+        uint32_t methodFlags = 0;
+        if (!SafeReadMethodMetadata(
+            method,
+            &rawMethodName,
+            &returnType,
+            &entry->methodPointer,
+            &entry->invokerPointer,
+            &entry->rawArgCount,
+            &methodFlags))
+        {
+            return;
+        }
+
+        entry->metadataValid = true;
+        entry->name = MakeSafeMemberLabel(rawMethodName, "method", method);
+        entry->isStatic = (methodFlags & 0x0010U) != 0U;
+
+        const uint32_t rawArgCount = entry->rawArgCount;
+        const uint32_t uiArgCount = (rawArgCount > kMaxMethodArgsUi) ? kMaxMethodArgsUi : rawArgCount;
+        entry->argCountCapped = (rawArgCount > kMaxMethodArgsUi);
+        entry->suspiciousArgCount = (rawArgCount > kHardMethodArgsLimit);
+        const uint32_t displayedArgCount = entry->suspiciousArgCount ? 0U : uiArgCount;
+
+        entry->header = ClampUiLabel(GetFieldTypeName(returnType), kMaxUiLabelChars) + " "
+            + BuildMethodSignature(method, displayedArgCount, rawArgCount);
+
+        entry->hasMethodRva = TryGetGameAssemblyRva(entry->methodPointer, state.gameAssemblyImageSize, &entry->methodRva);
+        entry->hasInvokerRva = TryGetGameAssemblyRva(entry->invokerPointer, state.gameAssemblyImageSize, &entry->invokerRva);
+
+        bool allArgsSupported = (rawArgCount <= kMaxMethodArgsInvoke) && !entry->suspiciousArgCount;
+        entry->params.resize(displayedArgCount);
+        for (uint32_t argIndex = 0; argIndex < displayedArgCount; ++argIndex)
+        {
+            MethodParamLayout& param = entry->params[argIndex];
+            Unity::il2cppType* paramType = SafeGetMethodParamType(method, argIndex);
+            param.typeCode = GetFieldTypeEnum(paramType);
+            param.supported = IsSupportedMethodArgType(param.typeCode);
+            if (!param.supported)
+                allArgsSupported = false;
+
+            const char* paramNameRaw = SafeGetMethodParamName(method, argIndex);
+            std::string paramName = paramNameRaw ? SanitizeMemberName(paramNameRaw) : ("arg" + std::to_string(argIndex));
+            if (paramName == "<invalid-name>" || paramName == "<null>" || paramName.empty())
+                paramName = "arg" + std::to_string(argIndex);
+
+            param.label = "arg" + std::to_string(argIndex) + ": " + ClampUiLabel(GetFieldTypeName(paramType), kMaxUiLabelChars) + " " + paramName;
+        }
+
+        entry->invokable = allArgsSupported;
+    }
+
+    static void AppendClassMembers(ClassLayout& layout, Unity::il2cppClass* declaringClass, bool isBase,
+        std::unordered_set<std::string>& seenMethods)
+    {
+        MemberGroup& group = layout.groups.emplace_back();
+        group.declaringClass = declaringClass;
+        group.firstField = static_cast<uint32_t>(layout.fields.size());
+        group.firstMethod = static_cast<uint32_t>(layout.methods.size());
+
+        // A fault part-way leaves the fields read so far.
+        std::vector<Unity::il2cppFieldInfo*> fields;
+        SafeFetchFields(declaringClass, &fields);
+        for (Unity::il2cppFieldInfo* field : fields)
+        {
+            if (!field || !field->m_pName)
+                continue;
+
+            FieldLayout& entry = layout.fields.emplace_back();
+            entry.field = field;
+            entry.declaringClass = declaringClass;
+            entry.offset = field->m_iOffset;
+            entry.isStatic = IsStaticField(field);
+            entry.typeEnum = GetFieldTypeEnum(field->m_pType);
+            entry.name = MakeSafeMemberLabel(field->m_pName, "field", field);
+            entry.header = ClampUiLabel(GetFieldTypeName(field->m_pType), kMaxUiLabelChars) + " " + entry.name
+                + (entry.isStatic ? " [static]" : " [instance]");
+        }
+
+        std::stable_sort(layout.fields.begin() + group.firstField, layout.fields.end(), [](const FieldLayout& left, const FieldLayout& right)
+            {
+                if (left.isStatic != right.isStatic)
+                    return !left.isStatic;
+                return left.offset < right.offset;
+            });
+
+        std::vector<Unity::il2cppMethodInfo*> methods;
+        if (SafeFetchMethods(declaringClass, &methods))
+            layout.methodsResolved = true;
+
+        for (Unity::il2cppMethodInfo* method : methods)
+        {
+            if (!method)
+                continue;
+
+            const char* rawName = nullptr;
+            uint32_t argCount = 0;
+            if (SafeReadMethodMetadata(method, &rawName, nullptr, nullptr, nullptr, &argCount, nullptr))
+            {
+                // Constructors are not inherited.
+                if (isBase && rawName && (std::strcmp(rawName, ".ctor") == 0 || std::strcmp(rawName, ".cctor") == 0))
+                    continue;
+
+                if (!seenMethods.insert(BuildMethodOverrideKey(method, rawName, argCount)).second)
+                    continue;
+            }
+
+            MethodLayout& entry = layout.methods.emplace_back();
+            entry.method = method;
+            entry.declaringClass = declaringClass;
+        }
+
+        group.fieldCount = static_cast<uint32_t>(layout.fields.size()) - group.firstField;
+        group.methodCount = static_cast<uint32_t>(layout.methods.size()) - group.firstMethod;
+
+        const std::string className = GetClassDisplayName(declaringClass);
+        const size_t groupIndex = layout.groups.size() - 1U;
+        group.fieldHeader = className + " (" + std::to_string(group.fieldCount) + ")##fields_" + std::to_string(groupIndex);
+        group.methodHeader = className + " (" + std::to_string(group.methodCount) + ")##methods_" + std::to_string(groupIndex);
+        if (group.fieldCount)
+            ++layout.fieldGroupCount;
+        if (group.methodCount)
+            ++layout.methodGroupCount;
+    }
+
+    static uint32_t SafeGetClassInstanceSize(ExplorerState& state, Unity::il2cppClass* klass)
+    {
+        if (!klass || !state.fnClassInstanceSize)
+            return 0;
+
+        __try
+        {
+            const int32_t size = reinterpret_cast<int32_t(*)(Unity::il2cppClass*)>(state.fnClassInstanceSize)(klass);
+            return size > 0 ? static_cast<uint32_t>(size) : 0U;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return 0;
+        }
+    }
+
+    static bool SafeIsValueTypeClass(ExplorerState& state, Unity::il2cppClass* klass, bool* outIsValueType)
+    {
+        if (!klass || !state.fnClassIsValueType)
+            return false;
+
+        __try
+        {
+            *outIsValueType = reinterpret_cast<bool(*)(Unity::il2cppClass*)>(state.fnClassIsValueType)(klass);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    // Bytes a field occupies inside an instance; 0 for value types whose size is not known
+    // without il2cpp_class_instance_size.
+    static uint32_t GetFieldStorageSize(ExplorerState& state, const FieldLayout& field)
+    {
+        switch (field.typeEnum)
+        {
+        case TypeCode_Boolean:
+        case TypeCode_I1:
+        case TypeCode_U1:
+            return 1;
+        case TypeCode_Char:
+        case TypeCode_I2:
+        case TypeCode_U2:
+            return 2;
+        case TypeCode_I4:
+        case TypeCode_U4:
+        case TypeCode_R4:
+            return 4;
+        case TypeCode_I8:
+        case TypeCode_U8:
+        case TypeCode_R8:
+            return 8;
+        case TypeCode_String:
+        case TypeCode_Class:
+        case TypeCode_Object:
+        case TypeCode_SzArray:
+        case Unity::Type_Array:
+            return static_cast<uint32_t>(sizeof(void*));
+        case TypeCode_GenericInst:
+        {
+            bool isValueType = true;
+            if (SafeIsValueTypeClass(state, IL2CPP::Class::Utils::ClassFromType(field.field->m_pType), &isValueType) && !isValueType)
+                return static_cast<uint32_t>(sizeof(void*));
+            return 0;
+        }
+        default:
+            return 0;
+        }
+    }
+
+    // Without il2cpp_class_instance_size the instance is assumed to end where its last field
+    // does. A trailing field of unknown size (a struct) is left out of the diff rather than
+    // guessed, since reading past the instance could fault or compare a neighbour's bytes.
+    static void BuildLayoutFieldSpans(ExplorerState& state, ClassLayout& layout)
+    {
+        uint32_t lastOffset = 0;
+        layout.fieldSpans.clear();
+        for (size_t i = 0; i < layout.fields.size(); ++i)
+        {
+            const FieldLayout& field = layout.fields[i];
+            if (field.isStatic || field.offset < static_cast<int>(sizeof(Unity::il2cppObject)))
+                continue;
+
+            FieldSpan span{};
+            span.begin = static_cast<uint32_t>(field.offset);
+            span.field = static_cast<uint32_t>(i);
+            layout.fieldSpans.emplace_back(span);
+            lastOffset = std::max(lastOffset, span.begin);
+        }
+
+        layout.instanceSize = SafeGetClassInstanceSize(state, layout.klass);
+        if (!layout.instanceSize && !layout.fieldSpans.empty())
+        {
+            // Fields sharing the last offset (explicit layouts) all have to fit, or none is kept.
+            uint32_t lastSize = 0;
+            for (const FieldSpan& span : layout.fieldSpans)
+            {
+                if (span.begin != lastOffset)
+                    continue;
+
+                const uint32_t size = GetFieldStorageSize(state, layout.fields[span.field]);
+                if (!size)
+                {
+                    lastSize = 0;
+                    break;
+                }
+                lastSize = std::max(lastSize, size);
+            }
+
+            layout.instanceSize = lastOffset + lastSize;
+        }
+
+        BuildFieldSpans(&layout.fieldSpans, layout.instanceSize);
+    }
+
+    static bool SafeGetClassArrayInfo(ExplorerState& state, Unity::il2cppClass* klass, bool* outIsArray, bool* outElementIsReference)
+    {
+        *outIsArray = false;
+        *outElementIsReference = false;
+        if (!klass || !state.fnClassGetRank || !state.fnClassGetElementClass || !state.fnClassIsValueType)
+            return false;
+
+        __try
+        {
+            if (reinterpret_cast<int(*)(Unity::il2cppClass*)>(state.fnClassGetRank)(klass) <= 0)
+                return true;
+
+            *outIsArray = true;
+            Unity::il2cppClass* element = reinterpret_cast<Unity::il2cppClass*(*)(Unity::il2cppClass*)>(state.fnClassGetElementClass)(klass);
+            *outElementIsReference = element && !reinterpret_cast<bool(*)(Unity::il2cppClass*)>(state.fnClassIsValueType)(element);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    // Strings are leaves and struct-embedded references are not followed; generic instances
+    // count only when their class is a reference type.
+    static bool IsReferenceInstanceField(ExplorerState& state, const FieldLayout& field)
+    {
+        if (field.isStatic || field.offset < static_cast<int>(sizeof(Unity::il2cppObject)))
+            return false;
+
+        switch (field.typeEnum)
+        {
+        case TypeCode_Class:
+        case TypeCode_Object:
+        case TypeCode_SzArray:
+        case Unity::Type_Array:
+            return true;
+        case TypeCode_GenericInst:
+        {
+            bool isValueType = true;
+            return SafeIsValueTypeClass(state, IL2CPP::Class::Utils::ClassFromType(field.field->m_pType), &isValueType) && !isValueType;
+        }
+        default:
+            return false;
+        }
+    }
+
+    static void BuildLayoutReferenceInfo(ExplorerState& state, ClassLayout& layout)
+    {
+        layout.displayName = GetClassDisplayName(layout.klass);
+        SafeGetClassArrayInfo(state, layout.klass, &layout.isArray, &layout.arrayOfReferences);
+
+        layout.referenceFields.clear();
+        for (size_t i = 0; i < layout.fields.size(); ++i)
+        {
+            if (IsReferenceInstanceField(state, layout.fields[i]))
+                layout.referenceFields.emplace_back(static_cast<uint32_t>(i));
+        }
+    }
+
+    static const ClassLayout& GetClassLayout(ExplorerState& state, Unity::il2cppClass* klass)
+    {
+        auto it = state.classLayouts.find(klass);
+        if (it != state.classLayouts.end())
+            return it->second;
+
+        ClassLayout& layout = state.classLayouts[klass];
+        layout.klass = klass;
+
+        std::unordered_set<std::string> seenMethods;
+        Unity::il2cppClass* current = klass;
+        for (int depth = 0; depth < 64 && current; ++depth)
+        {
+            const char* unusedName = nullptr;
+            const char* unusedNamespace = nullptr;
+            Unity::il2cppClass* parent = nullptr;
+            if (!SafeReadClassMetadata(current, &unusedName, &unusedNamespace, &parent))
+                break;
+
+            AppendClassMembers(layout, current, depth > 0, seenMethods);
+
+            if (parent == current)
+                break;
+            current = parent;
+        }
+
+        BuildLayoutFieldSpans(state, layout);
+        BuildLayoutReferenceInfo(state, layout);
+        return layout;
+    }
+
+    // The reference walk meets far more classes than anyone inspects, and only follows their
+    // reference fields. Unless the class already has a full layout it gets one holding just
+    // those fields (referenceFields is then 0..n-1): no methods, statics, spans or headers.
+    static const ClassLayout& GetWalkLayout(ExplorerState& state, Unity::il2cppClass* klass)
+    {
+        auto full = state.classLayouts.find(klass);
+        if (full != state.classLayouts.end())
+            return full->second;
+
+        auto it = state.walkLayouts.find(klass);
+        if (it != state.walkLayouts.end())
+            return it->second;
+
+        ClassLayout& layout = state.walkLayouts[klass];
+        layout.klass = klass;
+
+        std::vector<Unity::il2cppFieldInfo*> fields;
+        Unity::il2cppClass* current = klass;
+        for (int depth = 0; depth < 64 && current; ++depth)
+        {
+            const char* unusedName = nullptr;
+            const char* unusedNamespace = nullptr;
+            Unity::il2cppClass* parent = nullptr;
+            if (!SafeReadClassMetadata(current, &unusedName, &unusedNamespace, &parent))
+                break;
+
+            SafeFetchFields(current, &fields);
+            for (Unity::il2cppFieldInfo* field : fields)
+            {
+                if (!field || !field->m_pName)
+                    continue;
+
+                FieldLayout entry{};
+                entry.field = field;
+                entry.declaringClass = current;
+                entry.offset = field->m_iOffset;
+                entry.isStatic = IsStaticField(field);
+                entry.typeEnum = GetFieldTypeEnum(field->m_pType);
+                if (!IsReferenceInstanceField(state, entry))
+                    continue;
+
+                entry.name = MakeSafeMemberLabel(field->m_pName, "field", field);
+                layout.fields.emplace_back(std::move(entry));
+            }
+
+            if (parent == current)
+                break;
+            current = parent;
+        }
+
+        BuildLayoutReferenceInfo(state, layout);
+        return layout;
+    }
+
+    // Signatures, parameter labels and RVAs are only needed by the methods view, so they are
+    // built the first time it draws the class rather than for every layout.
+    static const ClassLayout& GetClassLayoutWithMethods(ExplorerState& state, Unity::il2cppClass* klass)
+    {
+        GetClassLayout(state, klass);
+        ClassLayout& layout = state.classLayouts.find(klass)->second;
+        if (!layout.methodsFilled)
+        {
+            for (MethodLayout& entry : layout.methods)
+                FillMethodLayout(state, &entry);
+            layout.methodsFilled = true;
+        }
+
+        return layout;
+    }
+
+    static bool MapWatchValueKind(unsigned int typeCode, WatchValueKind* outKind)
+    {
+        switch (typeCode)
+        {
+        case TypeCode_Boolean: *outKind = WatchValueKind::Bool; return true;
+        case TypeCode_I1: *outKind = WatchValueKind::I8; return true;
+        case TypeCode_U1: *outKind = WatchValueKind::U8; return true;
+        case TypeCode_I2: *outKind = WatchValueKind::I16; return true;
+        case TypeCode_Char:
+        case TypeCode_U2: *outKind = WatchValueKind::U16; return true;
+        case TypeCode_I4: *outKind = WatchValueKind::I32; return true;
+        case TypeCode_U4: *outKind = WatchValueKind::U32; return true;
+        case TypeCode_I8: *outKind = WatchValueKind::I64; return true;
+        case TypeCode_U8: *outKind = WatchValueKind::U64; return true;
+        case TypeCode_R4: *outKind = WatchValueKind::F32; return true;
+        case TypeCode_R8: *outKind = WatchValueKind::F64; return true;
+        default: return false;
+        }
+    }
+
+    // Resolves "field.sub.leaf" against klass. Reference-typed steps become dereference hops;
+    // embedded structs fold into the current hop, minus the object header their field offsets
+    // are reported with.
+    static bool BuildWatchProbe(
+        ExplorerState& state,
+        Unity::il2cppClass* klass,
+        const std::string& path,
+        WatchProbe* outProbe,
+        std::string* outTypeName,
+        std::string* outError)
+    {
+        *outProbe = {};
+        Unity::il2cppClass* currentClass = klass;
+        bool insideValue = false;
+        int32_t offset = 0;
+        size_t begin = 0;
+        for (;;)
+        {
+            const size_t dot = path.find('.', begin);
+            const bool last = dot == std::string::npos;
+            const std::string segment = path.substr(begin, last ? std::string::npos : dot - begin);
+            if (segment.empty())
+            {
+                *outError = "Empty path segment";
+                return false;
+            }
+
+            if (!currentClass)
+            {
+                *outError = "No class metadata for '" + segment + "'";
+                return false;
+            }
+
+            const FieldLayout* match = nullptr;
+            for (const FieldLayout& entry : GetClassLayout(state, currentClass).fields)
+            {
+                if (!entry.isStatic && entry.name == segment)
+                {
+                    match = &entry;
+                    break;
+                }
+            }
+
+            if (!match)
+            {
+                *outError = "No instance field '" + segment + "' on " + GetClassDisplayName(currentClass);
+                return false;
+            }
+
+            offset += match->offset - (insideValue ? static_cast<int32_t>(sizeof(Unity::il2cppObject)) : 0);
+            if (last)
+            {
+                if (!MapWatchValueKind(match->typeEnum, &outProbe->kind))
+                {
+                    *outError = "'" + segment + "' is not a numeric or bool field";
+                    return false;
+                }
+
+                outProbe->offsets[outProbe->hopCount++] = offset;
+                *outTypeName = GetFieldTypeName(match->field->m_pType);
+                return true;
+            }
+
+            if (match->typeEnum == Unity::Type_ValueType)
+            {
+                insideValue = true;
+            }
+            else if (IsInspectableReferenceType(match->typeEnum))
+            {
+                if (outProbe->hopCount + 1U >= kMaxWatchHops)
+                {
+                    *outError = "Path follows more than " + std::to_string(kMaxWatchHops - 1U) + " references";
+                    return false;
+                }
+
+                outProbe->offsets[outProbe->hopCount++] = offset;
+                offset = 0;
+                insideValue = false;
+            }
+            else
+            {
+                *outError = "'" + segment + "' has no fields to follow";
+                return false;
+            }
+
+            currentClass = IL2CPP::Class::Utils::ClassFromType(match->field->m_pType);
+            begin = dot + 1;
+        }
+    }
+
+    static bool SameWatchPath(const WatchProbe& lhs, const WatchProbe& rhs)
+    {
+        if (lhs.hopCount != rhs.hopCount || lhs.kind != rhs.kind)
+            return false;
+
+        for (uint32_t hop = 0; hop < lhs.hopCount; ++hop)
+        {
+            if (lhs.offsets[hop] != rhs.offsets[hop])
+                return false;
+        }
+        return true;
+    }
+
+    // subPath continues from a reference or struct field ("position.x"); empty watches the field.
+    static bool AddFieldWatch(ExplorerState& state, Unity::CComponent* component, const FieldLayout& root, const std::string& subPath)
+    {
+        WatchListState& watches = state.watches;
+        Unity::il2cppClass* klass = component->m_Object.m_pClass;
+
+        std::string path = root.name;
+        if (!subPath.empty())
+            path += (subPath[0] == '.' ? "" : ".") + subPath;
+
+        WatchProbe probe{};
+        std::string typeName;
+        std::string error;
+        if (!BuildWatchProbe(state, klass, path, &probe, &typeName, &error))
+        {
+            watches.lastError = error;
+            HBLog::Printf("[UExplorer] Watch add FAILED: %s (%s)\n", path.c_str(), error.c_str());
+            return false;
+        }
+
+        const ObjectHandle handle = AcquireObjectHandle(state, component);
+        if (!handle)
+        {
+            watches.lastError = "Object handle table is full";
+            return false;
+        }
+
+        for (const WatchEntry& existing : watches.entries)
+        {
+            if (existing.handle == handle && SameWatchPath(existing.probe, probe))
+            {
+                watches.lastError = "Already watched: " + existing.label;
+                return false;
+            }
+        }
+
+        if (!GetWatchSampler().AcquireRing(&probe.ring))
+        {
+            watches.lastError = "Watch limit reached (" + std::to_string(WatchSampler::kMaxWatches) + ")";
+            return false;
+        }
+
+        WatchEntry entry{};
+        entry.handle = handle;
+        entry.label = SafeGetObjectName(state.selectedObject) + "." + GetClassDisplayName(klass) + "." + path;
+        entry.typeName = typeName;
+        entry.probe = probe;
+        watches.entries.emplace_back(std::move(entry));
+        watches.planDirty = true;
+        watches.lastError.clear();
+
+        HBLog::Printf("[UExplorer] Watch added: %s (%s, %u hop(s))\n",
+            watches.entries.back().label.c_str(),
+            typeName.c_str(),
+            static_cast<unsigned int>(probe.hopCount));
+        return true;
+    }
+
+    static void RemoveWatch(ExplorerState& state, size_t index)
+    {
+        WatchListState& watches = state.watches;
+        if (index >= watches.entries.size())
+            return;
+
+        GetWatchSampler().ReleaseRing(watches.entries[index].probe.ring);
+        watches.entries.erase(watches.entries.begin() + static_cast<std::ptrdiff_t>(index));
+        watches.planDirty = true;
+    }
+
+    static void DrawFieldRow(ExplorerState& state, Unity::CComponent* component, const FieldLayout& entry)
+    {
+        Unity::il2cppFieldInfo* field = entry.field;
+        const std::string& fieldName = entry.name;
+        const bool isStatic = entry.isStatic;
+        const unsigned int typeEnum = entry.typeEnum;
+        const uint64_t fieldKey = BuildFieldKey(component, field);
+
+        const bool changed = state.snapshotDiff.hasDiff && state.snapshotDiff.changedFields.count(fieldKey) != 0;
+
+        ImGui::PushID(field);
+        ImGui::PushStyleColor(ImGuiCol_Text, changed ? kColorChanged : kColorField);
+        const bool fieldOpen = ImGui::TreeNode(entry.header.c_str());
+        ImGui::PopStyleColor();
+        if (changed)
+        {
+            ImGui::SameLine();
+            ImGui::TextColored(kColorChanged, "[changed]");
+        }
+
+        if (fieldOpen)
+        {
+            ImGui::TextDisabled("field_info=%p  offset=0x%X", field, entry.offset);
+            if (!isStatic && entry.offset >= 0)
+            {
+                void* fieldAddress = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(component) + static_cast<uintptr_t>(entry.offset));
+                ImGui::TextDisabled("instance_ptr=%p", fieldAddress);
+            }
+            else if (isStatic)
+            {
+                ImGui::TextDisabled("instance_ptr=<static>");
+                ImGui::TextDisabled("storage=il2cpp_field_static_*");
+            }
+
+            WatchValueKind watchKind{};
+            if (!isStatic && MapWatchValueKind(typeEnum, &watchKind))
+            {
+                if (AnimatedButton("Watch"))
+                    AddFieldWatch(state, component, entry, std::string());
+                ImGui::SameLine();
+                ImGui::TextDisabled("sample into the Watches tab");
+            }
+            else if (!isStatic && (typeEnum == Unity::Type_ValueType || IsInspectableReferenceType(typeEnum)))
+            {
+                std::string& draft = state.watches.pathDrafts[fieldKey];
+                char pathBuffer[256]{};
+                strncpy_s(pathBuffer, IM_ARRAYSIZE(pathBuffer), draft.c_str(), _TRUNCATE);
+                ImGui::SetNextItemWidth(220.0f);
+                if (ImGui::InputTextWithHint("##watchpath", "sub.field", pathBuffer, IM_ARRAYSIZE(pathBuffer)))
+                    draft = pathBuffer;
+                ImGui::SameLine();
+                if (AnimatedButton("Watch") && !draft.empty())
+                    AddFieldWatch(state, component, entry, draft);
+            }
+
+            if (IsSupportedEditableType(typeEnum))
+            {
+                if (typeEnum == TypeCode_Boolean)
+                {
+                    bool value = false;
+                    ReadFieldValue(component, field, isStatic, &value);
+
+                    if (ImGui::Checkbox("Value", &value))
+                    {
+                        const bool ok = WriteFieldValue(component, field, isStatic, value);
+                        HBLog::Printf("[UExplorer] Field bool apply %s: %s.%s = %s (%s)\n",
+                            ok ? "OK" : "FAILED",
+                            component->m_Object.m_pClass ? component->m_Object.m_pClass->m_pName : "<class>",
+                            fieldName.c_str(),
+                            value ? "true" : "false",
+                            isStatic ? "static" : "instance");
+                    }
+                }
+                else
+                {
+                    auto draftIt = state.fieldValueDrafts.find(fieldKey);
+                    if (draftIt == state.fieldValueDrafts.end())
+                        draftIt = state.fieldValueDrafts.emplace(fieldKey, BuildFieldDraftFromCurrentValue(component, field, isStatic, typeEnum)).first;
+
+                    std::string currentValueText = BuildFieldDraftFromCurrentValue(component, field, isStatic, typeEnum);
+
+                    char buffer[512]{};
+                    strncpy_s(buffer, IM_ARRAYSIZE(buffer), draftIt->second.c_str(), _TRUNCATE);
+                    ImGui::SetNextItemWidth(280.0f);
+                    if (ImGui::InputText("Value", buffer, IM_ARRAYSIZE(buffer)))
+                        draftIt->second = buffer;
+
+                    ImGui::SameLine();
+                    if (AnimatedButton("Apply"))
+                    {
+                        if (ApplyFieldDraftValue(component, field, isStatic, typeEnum, draftIt->second))
+                        {
+                            draftIt->second = BuildFieldDraftFromCurrentValue(component, field, isStatic, typeEnum);
+                            HBLog::Printf("[UExplorer] Field apply OK: %s.%s = %s (%s)\n",
+                                component->m_Object.m_pClass ? component->m_Object.m_pClass->m_pName : "<class>",
+                                fieldName.c_str(),
+                                draftIt->second.c_str(),
+                                isStatic ? "static" : "instance");
+                        }
+                        else
+                        {
+                            HBLog::Printf("[UExplorer] Field apply FAILED: %s.%s input='%s'\n",
+                                component->m_Object.m_pClass ? component->m_Object.m_pClass->m_pName : "<class>",
+                                fieldName.c_str(),
+                                draftIt->second.c_str());
+                        }
+                    }
+
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("current: %s", currentValueText.c_str());
+                }
+            }
+            else if (IsInspectableReferenceType(typeEnum))
+            {
+                FieldReferencePreview& preview = state.fieldReferencePreviews[fieldKey];
+                if (AnimatedButton(preview.loaded ? "Refresh Ref" : "Read Ref"))
+                {
+                    Unity::il2cppObject* refValue = nullptr;
+                    preview.loaded = true;
+                    preview.readFailed = !ReadFieldValue(component, field, isStatic, &refValue);
+                    preview.pointerValue = refValue ? reinterpret_cast<uintptr_t>(refValue) : 0;
+                    preview.handle = AcquireObjectHandle(state, refValue);
+
+                    if (preview.readFailed)
+                    {
+                        HBLog::Printf("[UExplorer] Read ref FAILED: %s.%s (%s)\n",
+                            component->m_Object.m_pClass ? component->m_Object.m_pClass->m_pName : "<class>",
+                            fieldName.c_str(),
+                            isStatic ? "static" : "instance");
+                    }
+                }
+
+                if (!preview.loaded)
+                {
+                    ImGui::TextDisabled("Reference is not read yet.");
+                }
+                else if (preview.readFailed)
+                {
+                    ImGui::TextDisabled("Reference read failed.");
+                }
+                else if (preview.pointerValue == 0)
+                {
+                    ImGui::TextDisabled("ref=<null>");
+                }
+                else if (preview.handle && !GetObjectHandleTarget(state, preview.handle))
+                {
+                    ImGui::TextDisabled("ref=<collected>");
+                }
+                else
+                {
+                    Unity::il2cppObject* refValue = reinterpret_cast<Unity::il2cppObject*>(preview.pointerValue);
+                    ImGui::Text("ref=%p", refValue);
+
+                    if (AnimatedButton("Inspect Ref"))
+                    {
+                        EnsureObjectCache(state);
+                        Unity::CGameObject* refObject = ResolveInspectableGameObjectFromCache(state, refValue);
+                        if (refObject)
+                        {
+                            NavigateToReferencedObject(state, refObject);
+                            HBLog::Printf("[UExplorer] Navigate reference: %s -> %s\n",
+                                fieldName.c_str(),
+                                SafeGetObjectName(refObject).c_str());
+                        }
+                        else
+                        {
+                            HBLog::Printf("[UExplorer] Inspect Ref failed: %s (ref=%p)\n",
+                                fieldName.c_str(),
+                                refValue);
+                        }
+                    }
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("Only GameObject/Component refs are navigable.");
+                }
+            }
+            else
+            {
+                void* pointerValue = nullptr;
+                ReadFieldValue(component, field, isStatic, &pointerValue);
+                ImGui::TextDisabled("value_ptr=%p", pointerValue);
+            }
+
+            ImGui::TreePop();
+        }
+
+        ImGui::Separator();
+        ImGui::PopID();
+    }
+
+    // ImGuiListClipper needs uniform rows, but member rows grow when expanded. This does the same
+    // job with a per-row height cache: rows above and below the clip rect become one Dummy
+    // each, and only rows inside it are submitted (and so read from managed memory). Heights
+    // start at the estimate and are corrected as rows are measured.
+    template<typename DrawRowFn>
+    static void DrawVirtualRows(std::vector<float>& heights, uint32_t count, float estimate, DrawRowFn&& drawRow)
+    {
+        if (heights.size() != count)
+            heights.assign(count, estimate);
+
+        const float spacing = ImGui::GetStyle().ItemSpacing.y;
+        ImDrawList* drawList = ImGui::GetWindowDrawList();
+        const float clipTop = drawList->GetClipRectMin().y;
+        const float clipBottom = drawList->GetClipRectMax().y;
+
+        uint32_t row = 0;
+        float skipped = 0.0f;
+        const float top = ImGui::GetCursorScreenPos().y;
+        while (row < count && top + skipped + heights[row] < clipTop)
+            skipped += heights[row++];
+
+        if (skipped > 0.0f)
+            ImGui::Dummy(ImVec2(0.0f, std::max(skipped - spacing, 0.0f)));
+
+        while (row < count && ImGui::GetCursorScreenPos().y < clipBottom)
+        {
+            const float before = ImGui::GetCursorScreenPos().y;
+            drawRow(row);
+            heights[row] = ImGui::GetCursorScreenPos().y - before;
+            ++row;
+        }
+
+        float remaining = 0.0f;
+        for (; row < count; ++row)
+            remaining += heights[row];
+
+        if (remaining > 0.0f)
+            ImGui::Dummy(ImVec2(0.0f, std::max(remaining - spacing, 0.0f)));
+    }
+
+    // Collapsible "declared in" section; the most-derived class starts open.
+    static bool BeginMemberGroup(const std::string& header, bool defaultOpen)
+    {
+        if (defaultOpen)
+            ImGui::SetNextItemOpen(true, ImGuiCond_Once);
+
+        ImGui::PushStyleColor(ImGuiCol_Text, kColorClass);
+        const bool open = ImGui::TreeNode(header.c_str());
+        ImGui::PopStyleColor();
+        return open;
+    }
+
+    static void DrawComponentFields(ExplorerState& state, Unity::CComponent* component)
+    {
+        const ClassLayout& layout = GetClassLayout(state, component->m_Object.m_pClass);
+        if (layout.fields.empty())
+        {
+            ImGui::TextDisabled("No fields");
+            return;
+        }
+
+        // Collapsed row: tree node plus separator.
+        const float rowEstimate = ImGui::GetFrameHeightWithSpacing() + ImGui::GetStyle().ItemSpacing.y + 1.0f;
+        const bool grouped = layout.fieldGroupCount > 1;
+        for (size_t g = 0; g < layout.groups.size(); ++g)
+        {
+            const MemberGroup& group = layout.groups[g];
+            if (group.fieldCount == 0)
+                continue;
+
+            if (grouped && !BeginMemberGroup(group.fieldHeader, g == 0))
+                continue;
+
+            std::vector<float>& heights = state.memberRowHeights[BuildFieldKey(component, &group)];
+            DrawVirtualRows(heights, group.fieldCount, rowEstimate, [&](uint32_t row)
+                {
+                    DrawFieldRow(state, component, layout.fields[group.firstField + row]);
+                });
+
+            if (grouped)
+                ImGui::TreePop();
+        }
+    }
+
+    static void DrawMethodRow(ExplorerState& state, Unity::CComponent* component, const MethodLayout& entry)
+    {
+        Unity::il2cppMethodInfo* method = entry.method;
+        if (!entry.metadataValid)
+        {
+            ImGui::PushID(method);
+            ImGui::TextDisabled("<invalid method metadata>");
+            ImGui::Separator();
+            ImGui::PopID();
+            return;
+        }
+
+        const std::string& methodName = entry.name;
+        const uint32_t displayedArgCount = static_cast<uint32_t>(entry.params.size());
+        const uint64_t methodKey = BuildMethodKey(component, method);
+
+        ImGui::PushID(method);
+        ImGui::PushStyleColor(ImGuiCol_Text, kColorMethod);
+        ImGui::TextUnformatted(entry.header.c_str());
+        ImGui::PopStyleColor();
+        ImGui::SameLine();
+        ImGui::TextDisabled("[%s]", entry.isStatic ? "static" : "instance");
+        ImGui::TextDisabled("method_info=%p", method);
+        if (entry.hasMethodRva)
+            ImGui::TextDisabled("method_ptr=%p  RVA=0x%llX", entry.methodPointer, static_cast<unsigned long long>(entry.methodRva));
+        else
+            ImGui::TextDisabled("method_ptr=%p", entry.methodPointer);
+
+        if (entry.hasInvokerRva)
+            ImGui::TextDisabled("invoker=%p  RVA=0x%llX", entry.invokerPointer, static_cast<unsigned long long>(entry.invokerRva));
+        else
+            ImGui::TextDisabled("invoker=%p", entry.invokerPointer);
+
+        auto draftIt = state.methodArgDrafts.find(methodKey);
+        if (draftIt == state.methodArgDrafts.end())
+            draftIt = state.methodArgDrafts.emplace(methodKey, std::vector<std::string>{}).first;
+
+        if (draftIt->second.size() != displayedArgCount)
+            draftIt->second.assign(displayedArgCount, {});
+
+        for (uint32_t argIndex = 0; argIndex < displayedArgCount; ++argIndex)
+        {
+            const MethodParamLayout& param = entry.params[argIndex];
+            if (draftIt->second[argIndex].empty())
+                draftIt->second[argIndex] = BuildDefaultMethodArgDraft(param.typeCode);
+
+            ImGui::TextUnformatted(param.label.c_str());
+            ImGui::SameLine();
+
+            if (param.supported)
+            {
+                ImGui::PushID(static_cast<int>(argIndex));
+                if (param.typeCode == TypeCode_Boolean)
+                {
+                    bool boolValue = false;
+                    ParseBoolText(draftIt->second[argIndex], &boolValue);
+                    if (ImGui::Checkbox("##arg", &boolValue))
+                        draftIt->second[argIndex] = boolValue ? "true" : "false";
+                }
+                else
+                {
+                    char argBuffer[256]{};
+                    strncpy_s(argBuffer, IM_ARRAYSIZE(argBuffer), draftIt->second[argIndex].c_str(), _TRUNCATE);
+                    ImGui::SetNextItemWidth(240.0f);
+                    if (ImGui::InputText("##arg", argBuffer, IM_ARRAYSIZE(argBuffer)))
+                        draftIt->second[argIndex] = argBuffer;
+                }
+                ImGui::PopID();
+            }
+            else
+            {
+                ImGui::TextDisabled("unsupported arg type");
+            }
+        }
+
+        if (entry.suspiciousArgCount)
+        {
+            ImGui::TextDisabled("Metadata guard: argument list hidden (%u args).", static_cast<unsigned int>(entry.rawArgCount));
+        }
+        else if (entry.argCountCapped)
+        {
+            ImGui::TextDisabled("... %u more arg(s) hidden", static_cast<unsigned int>(entry.rawArgCount - displayedArgCount));
+        }
+
+        const bool canInvoke = (state.fnRuntimeInvoke != nullptr) && entry.invokable;
+        ImGui::BeginDisabled(!canInvoke);
+        if (AnimatedButton("Invoke"))
+        {
+            std::string invokeResult;
+            if (InvokeMethodViaRuntimeInvoke(state, component, method, draftIt->second, &invokeResult))
+            {
+                state.methodInvokeResults[methodKey] = invokeResult;
+                HBLog::Printf("[UExplorer] Method invoke OK: %s -> %s\n", methodName.c_str(), invokeResult.c_str());
+            }
+            else
+            {
+                if (invokeResult.empty())
+                    invokeResult = "<invoke-failed>";
+                state.methodInvokeResults[methodKey] = invokeResult;
+                HBLog::Printf("[UExplorer] Method invoke FAILED: %s -> %s\n", methodName.c_str(), invokeResult.c_str());
+            }
+        }
+        ImGui::EndDisabled();
+
+        if (state.fnRuntimeInvoke == nullptr)
+            ImGui::TextDisabled("il2cpp_runtime_invoke is not resolved.");
+        else if (entry.rawArgCount > kMaxMethodArgsInvoke || entry.suspiciousArgCount)
+            ImGui::TextDisabled("Invoke unavailable: method has too many args.");
+        else if (!entry.invokable)
+            ImGui::TextDisabled("Invoke unavailable: unsupported argument type present.");
+
+        auto resultIt = state.methodInvokeResults.find(methodKey);
+        if (resultIt != state.methodInvokeResults.end())
+        {
+            ImGui::SameLine();
+            ImGui::Text("Result: %s", resultIt->second.c_str());
+        }
+
+        ImGui::Separator();
+        ImGui::PopID();
+    }
+
+    static void DrawComponentMethods(ExplorerState& state, Unity::CComponent* component)
+    {
+        const ClassLayout& layout = GetClassLayoutWithMethods(state, component->m_Object.m_pClass);
+        if (!layout.methodsResolved)
+        {
+            ImGui::TextDisabled("Method metadata unavailable");
+            return;
+        }
+
+        if (layout.methods.empty())
+        {
+            ImGui::TextDisabled("No methods");
+            return;
+        }
+
+        // Signature, three address lines, the Invoke button and a separator; args add to it.
+        const float rowEstimate = ImGui::GetTextLineHeightWithSpacing() * 4.0f + ImGui::GetFrameHeightWithSpacing() + ImGui::GetStyle().ItemSpacing.y + 1.0f;
+        const bool grouped = layout.methodGroupCount > 1;
+        for (size_t g = 0; g < layout.groups.size(); ++g)
+        {
+            const MemberGroup& group = layout.groups[g];
+            if (group.methodCount == 0)
+                continue;
+
+            if (grouped && !BeginMemberGroup(group.methodHeader, g == 0))
+                continue;
+
+            std::vector<float>& heights = state.memberRowHeights[BuildMethodKey(component, &group)];
+            DrawVirtualRows(heights, group.methodCount, rowEstimate, [&](uint32_t row)
+                {
+                    DrawMethodRow(state, component, layout.methods[group.firstMethod + row]);
+                });
+
+            if (grouped)
+                ImGui::TreePop();
+        }
+    }
+
+    // Copies an instance only while it still belongs to klass; a collected and reused address
+    // fails the check instead of producing a bogus diff.
+    static bool SafeCopyInstanceBytes(uintptr_t object, Unity::il2cppClass* klass, uint32_t size, uint8_t* outBytes)
+    {
+        if (!object || !klass || !size || !outBytes)
+            return false;
+
+        __try
+        {
+            if (reinterpret_cast<const Unity::il2cppObject*>(object)->m_pClass != klass)
+                return false;
+
+            std::memcpy(outBytes, reinterpret_cast<const void*>(object), size);
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    // Components of exactly klass across the object cache, in object order.
+    static void CollectClassInstances(ExplorerState& state, Unity::il2cppClass* klass, std::vector<uintptr_t>* outObjects)
+    {
+        outObjects->clear();
+        EnsureObjectCache(state);
+        EnsureComponentSnapshots(state);
+        for (const ObjectEntry& entry : state.objects)
+        {
+            auto snapshotIt = state.componentsByObject.find(entry.gameObject);
+            if (snapshotIt == state.componentsByObject.end())
+                continue;
+
+            const ComponentSnapshot& snapshot = snapshotIt->second;
+            for (size_t c = 0; c < snapshot.components.size(); ++c)
+            {
+                if (snapshot.classes[c] == klass)
+                    outObjects->emplace_back(reinterpret_cast<uintptr_t>(snapshot.components[c]));
+            }
+        }
+    }
+
+    static void CaptureSnapshotBaseline(ExplorerState& state, Unity::CComponent* component, bool allInstances)
+    {
+        SnapshotDiffState& diff = state.snapshotDiff;
+        Unity::il2cppClass* klass = component->m_Object.m_pClass;
+        const ClassLayout& layout = GetClassLayout(state, klass);
+
+        diff = SnapshotDiffState{};
+        diff.klass = klass;
+        diff.allInstances = allInstances;
+        diff.instanceSize = layout.instanceSize;
+        diff.baselineTick = GetTickCount64();
+        if (!diff.instanceSize)
+        {
+            HBLog::Printf("[UExplorer] Snapshot FAILED: %s has no instance size\n", GetClassDisplayName(klass).c_str());
+            return;
+        }
+
+        if (allInstances)
+            CollectClassInstances(state, klass, &diff.objects);
+        else
+            diff.objects.emplace_back(reinterpret_cast<uintptr_t>(component));
+
+        diff.baseline.resize(diff.objects.size() * diff.instanceSize);
+        size_t kept = 0;
+        for (size_t i = 0; i < diff.objects.size(); ++i)
+        {
+            if (!SafeCopyInstanceBytes(diff.objects[i], klass, diff.instanceSize, diff.baseline.data() + kept * diff.instanceSize))
+                continue;
+
+            diff.objects[kept++] = diff.objects[i];
+        }
+        diff.objects.resize(kept);
+        diff.baseline.resize(kept * diff.instanceSize);
+
+        HBLog::Printf("[UExplorer] Snapshot: %s, %zu instance(s) x %u bytes\n",
+            GetClassDisplayName(klass).c_str(),
+            kept,
+            diff.instanceSize);
+    }
+
+    // Diffs every baseline instance against its live bytes, past the object header (the monitor
+    // word changes under lock).
+    static void RunSnapshotDiff(ExplorerState& state)
+    {
+        SnapshotDiffState& diff = state.snapshotDiff;
+        if (!diff.klass || diff.objects.empty() || diff.instanceSize <= sizeof(Unity::il2cppObject))
+            return;
+
+        const auto start = std::chrono::steady_clock::now();
+        const ClassLayout& layout = GetClassLayout(state, diff.klass);
+        const uint32_t size = diff.instanceSize;
+        const uint32_t header = static_cast<uint32_t>(sizeof(Unity::il2cppObject));
+
+        diff.current.resize(diff.baseline.size());
+        diff.changedFields.clear();
+        diff.changeCounts.assign(layout.fieldSpans.size(), 0U);
+        diff.spanChanged.resize(layout.fieldSpans.size());
+        diff.changedInstances = 0;
+        diff.lostInstances = 0;
+
+        for (size_t i = 0; i < diff.objects.size(); ++i)
+        {
+            const uint8_t* before = diff.baseline.data() + i * size;
+            uint8_t* after = diff.current.data() + i * size;
+            if (!SafeCopyInstanceBytes(diff.objects[i], diff.klass, size, after))
+            {
+                ++diff.lostInstances;
+                continue;
+            }
+
+            diff.ranges.clear();
+            DiffBytes(before + header, after + header, size - header, &diff.ranges);
+            if (diff.ranges.empty())
+                continue;
+
+            for (ByteRange& range : diff.ranges)
+            {
+                range.begin += header;
+                range.end += header;
+            }
+
+            std::fill(diff.spanChanged.begin(), diff.spanChanged.end(), static_cast<uint8_t>(0));
+            MarkChangedSpans(diff.ranges, layout.fieldSpans, diff.spanChanged.data());
+            ++diff.changedInstances;
+
+            for (size_t s = 0; s < layout.fieldSpans.size(); ++s)
+            {
+                if (!diff.spanChanged[s])
+                    continue;
+
+                ++diff.changeCounts[s];
+                const FieldLayout& field = layout.fields[layout.fieldSpans[s].field];
+                diff.changedFields.insert(BuildFieldKey(reinterpret_cast<void*>(diff.objects[i]), field.field));
+            }
+        }
+
+        diff.hasDiff = true;
+        diff.lastDiffMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        HBLog::Printf("[UExplorer] Snapshot diff: %s, %zu of %zu instance(s) changed, %zu lost, %.2f ms\n",
+            GetClassDisplayName(diff.klass).c_str(),
+            diff.changedInstances,
+            diff.objects.size(),
+            diff.lostInstances,
+            diff.lastDiffMs);
+    }
+
+    static bool IsPlausibleObjectAddress(uintptr_t address)
+    {
+        return address >= 0x10000 && address < 0x00007FFFFFFFFFFFULL && (address & (sizeof(void*) - 1)) == 0;
+    }
+
+    static bool SafeReadReferenceSlots(uintptr_t object, const FieldLayout* fields, const uint32_t* referenceFields, size_t count, uintptr_t* outValues)
+    {
+        __try
+        {
+            for (size_t i = 0; i < count; ++i)
+                outValues[i] = *reinterpret_cast<const uintptr_t*>(object + static_cast<intptr_t>(fields[referenceFields[i]].offset));
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    static bool SafeReadArraySlots(uintptr_t array, size_t maxCount, uintptr_t* outValues, size_t* outCount)
+    {
+        *outCount = 0;
+        __try
+        {
+            Unity::il2cppArray<uintptr_t>* values = reinterpret_cast<Unity::il2cppArray<uintptr_t>*>(array);
+            const size_t count = std::min<size_t>(values->m_uMaxLength, maxCount);
+            for (size_t i = 0; i < count; ++i)
+                outValues[i] = values->At(static_cast<unsigned int>(i));
+            *outCount = count;
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    static bool SafeReadClassImage(Unity::il2cppClass* klass, const void** outImage)
+    {
+        __try
+        {
+            *outImage = klass->m_pImage;
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    static bool SafeCollectDomainImages(std::unordered_set<const void*>* outImages)
+    {
+        __try
+        {
+            size_t count = 0;
+            Unity::il2cppAssembly** assemblies = IL2CPP::Domain::GetAssemblies(&count);
+            if (!assemblies)
+                return false;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (assemblies[i] && assemblies[i]->m_pImage)
+                    outImages->insert(assemblies[i]->m_pImage);
+            }
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    // A class pointer is trusted once it belongs to a loaded image (generic instances and arrays
+    // report their definition's or element's image) and its name reads back printable. Heap
+    // words that merely point at readable memory fail the image test. The verdict is cached
+    // per walk so each distinct class is checked once.
+    static const ClassLayout* ResolveWalkClass(ExplorerState& state, Unity::il2cppClass* klass)
+    {
+        ReferenceWalkState& walk = state.referenceWalk;
+        auto [it, inserted] = walk.validClasses.try_emplace(klass, nullptr);
+        if (!inserted)
+            return it->second;
+
+        if (!IsPlausibleObjectAddress(reinterpret_cast<uintptr_t>(klass)))
+            return nullptr;
+
+        const void* image = nullptr;
+        if (!SafeReadClassImage(klass, &image) || !walk.images.contains(image))
+            return nullptr;
+
+        const char* name = nullptr;
+        const char* ns = nullptr;
+        Unity::il2cppClass* parent = nullptr;
+        char probe[8]{};
+        if (SafeReadClassMetadata(klass, &name, &ns, &parent)
+            && SafeCopyAsciiLabel(name, probe, sizeof(probe)) && probe[0])
+        {
+            it->second = &GetWalkLayout(state, klass);
+        }
+        return it->second;
+    }
+
+    static void RunReferenceWalk(ExplorerState& state)
+    {
+        ReferenceWalkState& walk = state.referenceWalk;
+        walk.validClasses.clear();
+        walk.images.clear();
+        SafeCollectDomainImages(&walk.images);
+        walk.rejected = 0;
+        walk.matches.clear();
+        walk.focused = ReferenceGraph::kNoNode;
+        walk.focusedPath.clear();
+        walk.childRowHeights.clear();
+
+        Unity::il2cppClass* rootClass = nullptr;
+        if (IsPlausibleObjectAddress(walk.root))
+            SafeReadObjectClass(reinterpret_cast<Unity::il2cppObject*>(walk.root), &rootClass);
+        const ClassLayout* rootLayout = rootClass ? ResolveWalkClass(state, rootClass) : nullptr;
+
+        ReferenceGraph::Limits limits{};
+        limits.maxDepth = static_cast<uint32_t>(std::max(walk.maxDepth, 1));
+        limits.maxNodes = static_cast<uint32_t>(std::max(walk.maxNodes, 1));
+        limits.maxEdges = static_cast<uint64_t>(std::max(walk.maxEdges, 1));
+        const size_t maxArrayElements = static_cast<size_t>(std::max(walk.maxArrayElements, 1));
+
+        walk.graph.Build(rootLayout ? walk.root : 0, rootLayout, limits, [&](const ReferenceNode& node, ReferenceGraph::Emitter& emitter)
+            {
+                const ClassLayout* layout = static_cast<const ClassLayout*>(node.type);
+                size_t count = 0;
+                if (layout->isArray)
+                {
+                    if (!layout->arrayOfReferences)
+                        return;
+                    if (walk.scratch.size() < maxArrayElements)
+                        walk.scratch.resize(maxArrayElements);
+                    if (!SafeReadArraySlots(node.address, maxArrayElements, walk.scratch.data(), &count))
+                        return;
+                }
+                else
+                {
+                    count = layout->referenceFields.size();
+                    if (count == 0)
+                        return;
+                    if (walk.scratch.size() < count)
+                        walk.scratch.resize(count);
+                    if (!SafeReadReferenceSlots(node.address, layout->fields.data(), layout->referenceFields.data(), count, walk.scratch.data()))
+                        return;
+                }
+
+                for (size_t i = 0; i < count; ++i)
+                {
+                    const uintptr_t child = walk.scratch[i];
+                    if (!child)
+                        continue;
+
+                    const uint32_t label = layout->isArray
+                        ? (ReferenceGraph::kArrayElement | static_cast<uint32_t>(i))
+                        : layout->referenceFields[i];
+
+                    // Already reached: only counts as an edge, no need to validate again.
+                    if (walk.graph.Find(child) != ReferenceGraph::kNoNode)
+                    {
+                        if (!emitter.Emit(child, nullptr, label))
+                            return;
+                        continue;
+                    }
+
+                    Unity::il2cppClass* childClass = nullptr;
+                    if (IsPlausibleObjectAddress(child))
+                        SafeReadObjectClass(reinterpret_cast<Unity::il2cppObject*>(child), &childClass);
+                    const ClassLayout* childLayout = childClass ? ResolveWalkClass(state, childClass) : nullptr;
+                    if (!childLayout)
+                    {
+                        ++walk.rejected;
+                        continue;
+                    }
+
+                    if (!emitter.Emit(child, childLayout, label))
+                        return;
+                }
+            });
+
+        const ReferenceGraph::Stats& stats = walk.graph.GetStats();
+        char buffer[256]{};
+        if (!rootLayout)
+        {
+            std::snprintf(buffer, sizeof(buffer), "Root %p is not a readable managed object", reinterpret_cast<void*>(walk.root));
+        }
+        else
+        {
+            std::snprintf(buffer, sizeof(buffer), "%u object(s), %llu edge(s), depth %u, %u rejected pointer(s), %.1f ms%s%s",
+                stats.nodes,
+                static_cast<unsigned long long>(stats.edges),
+                stats.depthReached,
+                walk.rejected,
+                stats.micros / 1000.0,
+                stats.nodeLimitHit ? ", node limit hit" : "",
+                stats.edgeLimitHit ? ", edge limit hit" : "");
+        }
+        walk.status = buffer;
+        HBLog::Printf("[UExplorer] Reference walk from %s: %s\n", walk.rootLabel.c_str(), buffer);
+    }
+
+    static void StartReferenceWalk(ExplorerState& state, uintptr_t root, std::string label)
+    {
+        state.referenceWalk.root = root;
+        state.referenceWalk.rootLabel = std::move(label);
+        RunReferenceWalk(state);
+    }
+
+    static uint32_t GetScanThreadCount()
+    {
+        const uint32_t hardware = std::thread::hardware_concurrency();
+        return std::clamp<uint32_t>(hardware > 1U ? hardware - 1U : 1U, 1U, 8U);
+    }
+
+    static constexpr int kLivenessBatch = 4096; // objects per register callback
+    static constexpr int kMaxHeapInstances = 1 << 24;
+    static constexpr size_t kLivenessArenaBytes = sizeof(void*) == 8 ? (size_t{ 1 } << 30) : (size_t{ 1 } << 28); // address space only
+
+    // Passed as userdata to both liveness callbacks.
+    struct LivenessContext
+    {
+        InstanceSink* sink = nullptr;
+        LivenessArena* arena = nullptr;
+    };
+
+    using LivenessRegisterFn = void(*)(Unity::il2cppObject** objects, int count, void* userdata);
+    using LivenessWorldChangedFn = void(*)();
+    using LivenessReallocateFn = void* (*)(void* pointer, size_t size, void* userdata);
+
+    // Called with the GC world stopped: no allocation here, the sink was sized up front.
+    static void OnLivenessObjects(Unity::il2cppObject** objects, int count, void* userdata)
+    {
+        if (count > 0)
+            static_cast<LivenessContext*>(userdata)->sink->Append(reinterpret_cast<void* const*>(objects), static_cast<size_t>(count));
+    }
+
+    static void OnLivenessWorldChanged()
+    {
+    }
+
+    // Also called with the world stopped, where the CRT heap lock may be held by a suspended
+    // thread; the arena only commits pages of its own reservation.
+    static void* ReallocateLivenessArray(void* pointer, size_t size, void* userdata)
+    {
+        return static_cast<LivenessContext*>(userdata)->arena->Reallocate(pointer, size);
+    }
+
+    static bool CommitLivenessArena(void* begin, size_t bytes)
+    {
+        return VirtualAlloc(begin, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+    }
+
+    static bool EnsureLivenessArena(LivenessArena* arena)
+    {
+        if (arena->Attached())
+            return true;
+
+        void* base = VirtualAlloc(nullptr, kLivenessArenaBytes, MEM_RESERVE, PAGE_NOACCESS);
+        if (!base)
+            return false;
+
+        arena->Attach(static_cast<uint8_t*>(base), kLivenessArenaBytes, CommitLivenessArena);
+        return true;
+    }
+
+    // Returns the committed pages; the reservation stays for the next walk.
+    static void DecommitLivenessArena(LivenessArena* arena)
+    {
+        if (arena->Committed())
+            VirtualFree(arena->Base(), arena->Committed(), MEM_DECOMMIT);
+        arena->Attach(arena->Base(), arena->Capacity(), CommitLivenessArena);
+    }
+
+    static bool HasLivenessApi(const ExplorerState& state)
+    {
+        if (!state.fnLivenessFromStatics)
+            return false;
+
+        return (state.fnLivenessAllocateStruct && state.fnLivenessFinalize && state.fnLivenessFreeStruct && state.fnStopGcWorld && state.fnStartGcWorld)
+            || (state.fnLivenessBegin && state.fnLivenessEnd);
+    }
+
+    // The world is restarted and the liveness struct freed on every path out, including a fault
+    // inside the walk: the __finally blocks run while the fault unwinds to the __except.
+    static bool SafeCollectLiveObjects(const ExplorerState& state, Unity::il2cppClass* klass, LivenessContext* context)
+    {
+        __try
+        {
+            if (state.fnLivenessAllocateStruct && state.fnLivenessFinalize && state.fnLivenessFreeStruct && state.fnStopGcWorld && state.fnStartGcWorld)
+            {
+                void* liveness = reinterpret_cast<void* (*)(Unity::il2cppClass*, int, LivenessRegisterFn, void*, LivenessReallocateFn)>(state.fnLivenessAllocateStruct)(
+                    klass, kLivenessBatch, OnLivenessObjects, context, ReallocateLivenessArray);
+                if (!liveness)
+                    return false;
+
+                __try
+                {
+                    reinterpret_cast<void(*)()>(state.fnStopGcWorld)();
+                    __try
+                    {
+                        reinterpret_cast<void(*)(void*)>(state.fnLivenessFromStatics)(liveness);
+                        reinterpret_cast<void(*)(void*)>(state.fnLivenessFinalize)(liveness);
+                    }
+                    __finally
+                    {
+                        reinterpret_cast<void(*)()>(state.fnStartGcWorld)();
+                    }
+                }
+                __finally
+                {
+                    reinterpret_cast<void(*)(void*)>(state.fnLivenessFreeStruct)(liveness);
+                }
+                return true;
+            }
+
+            // The legacy pair stops the world in begin and restarts it (and frees) in end. Its
+            // arrays come from the runtime's own allocator; there is no hook to redirect them.
+            void* liveness = reinterpret_cast<void* (*)(Unity::il2cppClass*, int, LivenessRegisterFn, void*, LivenessWorldChangedFn, LivenessWorldChangedFn)>(state.fnLivenessBegin)(
+                klass, kLivenessBatch, OnLivenessObjects, context, OnLivenessWorldChanged, OnLivenessWorldChanged);
+            if (!liveness)
+                return false;
+
+            __try
+            {
+                reinterpret_cast<void(*)(void*)>(state.fnLivenessFromStatics)(liveness);
+            }
+            __finally
+            {
+                reinterpret_cast<void(*)(void*)>(state.fnLivenessEnd)(liveness);
+            }
+            return true;
+        }
+        __except (EXCEPTION_EXECUTE_HANDLER)
+        {
+            return false;
+        }
+    }
+
+    static void RunHeapEnumeration(ExplorerState& state)
+    {
+        HeapInstancesState& heap = state.heapInstances;
+        heap.instances.clear();
+        heap.overflow = 0;
+
+        if (!state.fnLivenessFromStatics)
+            ResolveRuntimeMethods(state);
+
+        if (!HasLivenessApi(state))
+        {
+            heap.status = "GameAssembly does not export the il2cpp liveness API";
+            return;
+        }
+
+        if (!heap.klass)
+        {
+            heap.status = "No class selected";
+            return;
+        }
+
+        using Clock = std::chrono::steady_clock;
+        const Clock::time_point start = Clock::now();
+
+        heap.capacity = std::clamp(heap.capacity, 1, kMaxHeapInstances);
+        try
+        {
+            heap.sink.Reset(static_cast<size_t>(heap.capacity));
+        }
+        catch (const std::bad_alloc&)
+        {
+            heap.sink.Reset(0);
+            heap.status = "Could not reserve " + std::to_string(heap.capacity) + " instance slot(s); lower Max instances";
+            HBLog::Printf("[UExplorer] %s\n", heap.status.c_str());
+            return;
+        }
+
+        if (!EnsureLivenessArena(&heap.arena))
+        {
+            heap.status = "Could not reserve address space for the liveness walk";
+            HBLog::Printf("[UExplorer] %s\n", heap.status.c_str());
+            return;
+        }
+
+        LivenessContext context{ &heap.sink, &heap.arena };
+        const bool collected = SafeCollectLiveObjects(state, heap.klass, &context);
+        heap.arenaPeak = heap.arena.Peak();
+        DecommitLivenessArena(&heap.arena);
+        if (!collected)
+        {
+            heap.status = "Liveness walk FAILED for " + GetClassDisplayName(heap.klass);
+            HBLog::Printf("[UExplorer] %s\n", heap.status.c_str());
+            return;
+        }
+
+        const Clock::time_point walked = Clock::now();
+        heap.overflow = heap.sink.Overflow();
+        heap.sink.Take(&heap.instances);
+        const size_t reported = heap.instances.size();
+
+        // Subclasses come back from the walk too; the exact filter and the class check run on
+        // workers so a large result does not stall the frame on one core.
+        Unity::il2cppClass* klass = heap.klass;
+        const bool exact = heap.exactClass;
+        ParallelCompact(&heap.instances, [klass, exact](uintptr_t object)
+            {
+                Unity::il2cppClass* objectClass = nullptr;
+                return SafeReadObjectClass(reinterpret_cast<Unity::il2cppObject*>(object), &objectClass)
+                    && objectClass && (!exact || objectClass == klass);
+            }, GetScanThreadCount());
+
+        char buffer[256]{};
+        std::snprintf(buffer, sizeof(buffer), "%zu instance(s) of %s (%zu reported%s), walk %.1f ms (%.1f MB scratch), filter %.1f ms",
+            heap.instances.size(),
+            GetClassDisplayName(klass).c_str(),
+            reported,
+            heap.overflow ? ", capacity hit" : "",
+            std::chrono::duration<double, std::milli>(walked - start).count(),
+            static_cast<double>(heap.arenaPeak) / (1024.0 * 1024.0),
+            std::chrono::duration<double, std::milli>(Clock::now() - walked).count());
+        heap.status = buffer;
+        HBLog::Printf("[UExplorer] Heap instances: %s\n", buffer);
+    }
+
+    static void ListHeapInstances(ExplorerState& state, Unity::il2cppClass* klass)
+    {
+        HeapInstancesState& heap = state.heapInstances;
+        heap.klass = klass;
+        std::snprintf(heap.className, sizeof(heap.className), "%s", GetClassDisplayName(klass).c_str());
+        RunHeapEnumeration(state);
+    }
+
+    static void DrawSnapshotDiffControls(ExplorerState& state, Unity::CComponent* component)
+    {
+        SnapshotDiffState& diff = state.snapshotDiff;
+        Unity::il2cppClass* klass = component->m_Object.m_pClass;
+        const bool ownsBaseline = diff.klass == klass
+            && (diff.allInstances || (!diff.objects.empty() && diff.objects[0] == reinterpret_cast<uintptr_t>(component)));
+
+        if (AnimatedButton("Snapshot"))
+            CaptureSnapshotBaseline(state, component, false);
+        ImGui::SameLine();
+        if (AnimatedButton("Snapshot all of class"))
+            CaptureSnapshotBaseline(state, component, true);
+
+        if (!ownsBaseline)
+            return;
+
+        ImGui::SameLine();
+        if (AnimatedButton("Diff"))
+            RunSnapshotDiff(state);
+        ImGui::SameLine();
+        if (AnimatedButton("Clear snapshot"))
+        {
+            diff = SnapshotDiffState{};
+            return;
+        }
+
+        ImGui::TextDisabled("Baseline: %zu instance(s) x %u bytes, %.1f s ago",
+            diff.objects.size(),
+            diff.instanceSize,
+            static_cast<double>(GetTickCount64() - diff.baselineTick) / 1000.0);
+
+        if (!diff.hasDiff)
+            return;
+
+        ImGui::TextDisabled("Diff: %zu changed, %zu lost, %.2f ms", diff.changedInstances, diff.lostInstances, diff.lastDiffMs);
+        if (!diff.allInstances)
+            return;
+
+        // Per-field counts across the class; single-instance diffs are shown on the field rows.
+        const ClassLayout& layout = GetClassLayout(state, klass);
+        for (size_t s = 0; s < diff.changeCounts.size() && s < layout.fieldSpans.size(); ++s)
+        {
+            if (!diff.changeCounts[s])
+                continue;
+
+            const FieldLayout& field = layout.fields[layout.fieldSpans[s].field];
+            ImGui::TextColored(kColorChanged, "%s", field.name.c_str());
+            ImGui::SameLine();
+            ImGui::TextDisabled("changed in %u of %zu", diff.changeCounts[s], diff.objects.size());
+        }
+    }
+
+    static void DrawComponentsInspector(ExplorerState& state, Unity::CGameObject* gameObject)
+    {
+        if (!gameObject)
+            return;
+
+        Unity::il2cppObject* componentType = IL2CPP::SystemTypeCache::Get(UNITY_COMPONENT_CLASS);
+        if (!componentType)
+            componentType = IL2CPP::Class::GetSystemType(UNITY_COMPONENT_CLASS);
+
+        if (!componentType)
+        {
+            ImGui::TextDisabled("Component type cache is not ready");
+            return;
+        }
+
+        Unity::il2cppArray<Unity::CComponent*>* components = SafeGetComponents(gameObject, componentType);
+        if (!components || components->m_uMaxLength == 0)
+        {
+            ImGui::TextDisabled("No components found");
+            return;
+        }
+
+        for (uintptr_t i = 0; i < components->m_uMaxLength; ++i)
+        {
+            Unity::CComponent* component = components->operator[](static_cast<unsigned int>(i));
+            if (!component)
+                continue;
+
+            const std::string componentName = GetClassDisplayName(component->m_Object.m_pClass);
+            const std::string treeLabel = componentName + "##component_" + std::to_string(reinterpret_cast<uintptr_t>(component));
+
+            ImGui::PushStyleColor(ImGuiCol_Text, kColorClass);
+            const bool componentOpen = ImGui::TreeNode(treeLabel.c_str());
+            ImGui::PopStyleColor();
+
+            if (componentOpen)
+            {
+                ImGui::Text("Address: 0x%p", component);
+                ImGui::TextDisabled("cached_ptr=%p", component->m_CachedPtr);
+                DrawSnapshotDiffControls(state, component);
+                if (AnimatedButton("Walk references"))
+                    StartReferenceWalk(state, reinterpret_cast<uintptr_t>(component), SafeGetObjectName(gameObject) + "." + componentName);
+                ImGui::SameLine();
+                if (AnimatedButton("List live instances"))
+                    ListHeapInstances(state, component->m_Object.m_pClass);
+                ImGui::SameLine();
+                ImGui::TextDisabled("results in the References / Heap tabs");
+
+                ImGui::PushStyleColor(ImGuiCol_Text, kColorField);
+                const bool fieldsOpen = ImGui::TreeNode("Fields");
+                ImGui::PopStyleColor();
+                if (fieldsOpen)
+                {
+                    DrawComponentFields(state, component);
+                    ImGui::TreePop();
+                }
+
+                ImGui::PushStyleColor(ImGuiCol_Text, kColorMethod);
+                const bool methodsOpen = ImGui::TreeNode("Methods");
+                ImGui::PopStyleColor();
+                if (methodsOpen)
+                {
+                    DrawComponentMethods(state, component);
+                    ImGui::TreePop();
+                }
+
+                ImGui::TreePop();
+            }
         }
-        case TypeCode_U4:
+    }
+
+    static bool SafeReadWatchProbe(const WatchProbe& probe, double* outValue)
+    {
+        __try
         {
-            uint32_t value = 0;
-            if (!ParseUnsignedIntegerText<uint32_t>(textDraft, &value))
+            const uintptr_t address = ResolveWatchAddress(probe);
+            if (!address)
                 return false;
-            return WriteFieldValue(component, field, isStatic, value);
+
+            *outValue = LoadWatchValue(address, probe.kind);
+            return true;
         }
-        case TypeCode_R4:
+        __except (EXCEPTION_EXECUTE_HANDLER)
         {
-            float value = 0.0f;
-            if (!ParseFloatText(textDraft, &value))
-                return false;
-            return WriteFieldValue(component, field, isStatic, value);
+            return false;
         }
-        case TypeCode_R8:
+    }
+
+    static bool TickWatchSampler()
+    {
+        return GetWatchSampler().Tick([](const WatchProbe& probe, double* outValue)
+            {
+                return SafeReadWatchProbe(probe, outValue);
+            });
+    }
+
+    // Targets are re-resolved on this cadence rather than every frame: each lookup is a GC
+    // handle query, which takes the collector's lock.
+    static constexpr ULONGLONG kWatchResolveIntervalMs = 250;
+
+    static void TickWatches(ExplorerState& state)
+    {
+        WatchListState& watches = state.watches;
+        WatchSampler& sampler = GetWatchSampler();
+        sampler.SetIntervalMicros(watches.rateHz > 0.0f ? static_cast<uint32_t>(1000000.0f / watches.rateHz) : 0U);
+
+        if (watches.entries.empty() && !watches.planDirty)
+            return;
+
+        const ULONGLONG now = GetTickCount64();
+        if (watches.planDirty || now - watches.lastResolveTick >= kWatchResolveIntervalMs)
         {
-            double value = 0.0;
-            if (!ParseDoubleText(textDraft, &value))
-                return false;
-            return WriteFieldValue(component, field, isStatic, value);
+            watches.lastResolveTick = now;
+
+            bool changed = watches.planDirty;
+            for (WatchEntry& entry : watches.entries)
+            {
+                Unity::il2cppObject* target = GetObjectHandleTarget(state, entry.handle);
+                if (target && !SafeIsNativeObjectAlive(target))
+                    target = nullptr;
+
+                const uintptr_t base = reinterpret_cast<uintptr_t>(target);
+                if (base != entry.publishedBase)
+                {
+                    entry.publishedBase = base;
+                    changed = true;
+                }
+            }
+
+            if (changed)
+            {
+                std::vector<WatchProbe> probes;
+                probes.reserve(watches.entries.size());
+                for (const WatchEntry& entry : watches.entries)
+                {
+                    if (!entry.publishedBase)
+                        continue;
+
+                    WatchProbe probe = entry.probe;
+                    probe.base = entry.publishedBase;
+                    probes.emplace_back(probe);
+                }
+
+                sampler.Publish(std::move(probes));
+                watches.planDirty = false;
+            }
         }
-        case TypeCode_I2:
+
+        // Without the update hook Present samples, whether or not the overlay is open.
+        if (!watches.updateHookActive.load(std::memory_order_acquire))
+            TickWatchSampler();
+    }
+
+    static void DrawWatchesTab(ExplorerState& state)
+    {
+        WatchListState& watches = state.watches;
+        WatchSampler& sampler = GetWatchSampler();
+        const WatchSampler::Stats stats = sampler.GetStats();
+
+        ImGui::SetNextItemWidth(160.0f);
+        ImGui::SliderFloat("Rate (Hz)", &watches.rateHz, 1.0f, 240.0f, "%.0f");
+        ImGui::SameLine();
+        if (AnimatedButton("Reset peak"))
+            sampler.ResetPeak();
+        ImGui::SameLine();
+        if (AnimatedButton("Clear all"))
         {
-            short value = 0;
-            if (!ParseSignedIntegerText<short>(textDraft, &value))
-                return false;
-            return WriteFieldValue(component, field, isStatic, value);
+            while (!watches.entries.empty())
+                RemoveWatch(state, watches.entries.size() - 1);
         }
-        case TypeCode_U2:
+
+        ImGui::TextDisabled("%zu watch(es), sampled %s", watches.entries.size(),
+            watches.updateHookActive.load(std::memory_order_acquire) ? "on the game update" : "from Present (update hook unavailable)");
+        ImGui::TextDisabled("Last tick: %u probe(s), %u failed, %.1f us (peak %.1f us), %llu tick(s)",
+            stats.probesLastTick,
+            stats.failedLastTick,
+            stats.microsLastTick,
+            stats.microsPeak,
+            static_cast<unsigned long long>(stats.ticks));
+
+        if (!watches.lastError.empty())
+            ImGui::TextColored(ImVec4(1.0f, 0.45f, 0.35f, 1.0f), "%s", watches.lastError.c_str());
+
+        if (watches.entries.empty())
         {
-            uint16_t value = 0;
-            if (!ParseUnsignedIntegerText<uint16_t>(textDraft, &value))
-                return false;
-            return WriteFieldValue(component, field, isStatic, value);
+            ImGui::TextDisabled("No watches. Expand a numeric field in the inspector and press Watch.");
+            return;
         }
-        case TypeCode_I1:
+
+        watches.history.resize(SampleRing::kCapacity);
+        size_t removeIndex = watches.entries.size();
+        const float plotHeight = 44.0f;
+
+        ImGui::BeginChild("WatchList", ImVec2(0.0f, 0.0f), true);
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(watches.entries.size()));
+        while (clipper.Step())
         {
-            int8_t value = 0;
-            if (!ParseSignedIntegerText<int8_t>(textDraft, &value))
-                return false;
-            return WriteFieldValue(component, field, isStatic, value);
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            {
+                const WatchEntry& entry = watches.entries[static_cast<size_t>(row)];
+                const SampleRing& ring = sampler.Ring(entry.probe.ring);
+                const size_t count = ring.Copy(watches.history.data());
+                const WatchSummary summary = SummarizeWatchHistory(watches.history.data(), count);
+
+                ImGui::PushID(row);
+                if (AnimatedButton("X"))
+                    removeIndex = static_cast<size_t>(row);
+                ImGui::SameLine();
+                ImGui::PushStyleColor(ImGuiCol_Text, kColorField);
+                ImGui::TextUnformatted(entry.label.c_str());
+                ImGui::PopStyleColor();
+                ImGui::SameLine();
+                ImGui::TextDisabled("[%s]%s", entry.typeName.c_str(), entry.publishedBase ? "" : " target gone");
+
+                char overlay[64]{};
+                if (count > 0)
+                    std::snprintf(overlay, sizeof(overlay), "%.6g", watches.history[count - 1]);
+                ImGui::PlotLines("##history", watches.history.data(), static_cast<int>(count), 0, overlay,
+                    summary.minimum, summary.maximum, ImVec2(-1.0f, plotHeight));
+
+                ImGui::TextDisabled("min %.6g  max %.6g  avg %.6g  (%zu sample(s), %u failed read(s))",
+                    summary.minimum,
+                    summary.maximum,
+                    summary.average,
+                    count,
+                    ring.Failures());
+                ImGui::Separator();
+                ImGui::PopID();
+            }
         }
-        case TypeCode_U1:
+        ImGui::EndChild();
+
+        if (removeIndex < watches.entries.size())
+            RemoveWatch(state, removeIndex);
+    }
+
+    struct ScanValueKindOption
+    {
+        const char* label;
+        WatchValueKind kind;
+    };
+
+    static constexpr ScanValueKindOption kScanValueKinds[] =
+    {
+        { "bool", WatchValueKind::Bool },
+        { "sbyte", WatchValueKind::I8 },
+        { "byte", WatchValueKind::U8 },
+        { "short", WatchValueKind::I16 },
+        { "ushort / char", WatchValueKind::U16 },
+        { "int", WatchValueKind::I32 },
+        { "uint", WatchValueKind::U32 },
+        { "long", WatchValueKind::I64 },
+        { "ulong", WatchValueKind::U64 },
+        { "float", WatchValueKind::F32 },
+        { "double", WatchValueKind::F64 },
+    };
+
+    // Runs on scanner workers: raw reads only, revalidated by class pointer so a collected
+    // instance drops out instead of matching garbage.
+    static bool SafeReadScanValue(uintptr_t object, Unity::il2cppClass* klass, int offset, WatchValueKind kind, double* outValue)
+    {
+        __try
         {
-            unsigned char value = 0;
-            if (!ParseUnsignedIntegerText<unsigned char>(textDraft, &value))
+            if (reinterpret_cast<const Unity::il2cppObject*>(object)->m_pClass != klass)
                 return false;
-            return WriteFieldValue(component, field, isStatic, value);
+
+            *outValue = LoadWatchValue(object + static_cast<intptr_t>(offset), kind);
+            return true;
         }
-        case TypeCode_Char:
+        __except (EXCEPTION_EXECUTE_HANDLER)
         {
-            uint16_t value = 0;
-            if (!ParseCharText(textDraft, &value))
-                return false;
-            return WriteFieldValue(component, field, isStatic, value);
+            return false;
         }
-        case TypeCode_String:
+    }
+
+    static bool RunValueScan(ValueScanState& scan)
+    {
+        ScanPredicate predicate{};
+        predicate.compare = static_cast<ScanCompare>(scan.compare);
+        predicate.a = scan.value;
+        predicate.b = scan.valueHigh;
+        predicate.epsilon = scan.epsilon;
+
+        const WatchValueKind kind = scan.kind;
+        const std::vector<ScanInstance>& instances = scan.instances;
+        const bool ok = scan.scanner.Scan([&](uint32_t instanceIndex, uint16_t field, double* outValue)
+            {
+                const ScanInstance& instance = instances[instanceIndex];
+                return SafeReadScanValue(instance.object, instance.klass, instance.layout->fields[field].offset, kind, outValue);
+            }, predicate, GetScanThreadCount());
+
+        if (!ok)
         {
-            Unity::System_String* value = IL2CPP::String::New(textDraft.c_str());
-            if (!value)
-                return false;
-            return WriteFieldValue<Unity::System_String*>(component, field, isStatic, value);
-        }
-        default:
+            scan.status = "Changed/unchanged/increased/decreased need a previous scan";
             return false;
         }
+
+        const ValueScanner::Stats& stats = scan.scanner.GetStats();
+        char buffer[192]{};
+        std::snprintf(buffer, sizeof(buffer), "%zu of %zu candidate(s) kept, %zu unreadable, %.2f ms on %u thread(s)",
+            stats.kept,
+            stats.scanned,
+            stats.unreadable,
+            stats.totalMs,
+            stats.threads);
+        scan.status = buffer;
+        HBLog::Printf("[UExplorer] Value scan: %s\n", buffer);
+        return true;
     }
 
-    static bool IsSupportedMethodArgType(unsigned int typeCode)
+    // A scan result outlives the refresh that found it. Its owner is only touched while the
+    // object cache still knows it under the same native object; a destroyed or collected
+    // GameObject (or a new one at a reused address) fails one of the two checks.
+    static bool IsScanOwnerLive(const ExplorerState& state, Unity::CGameObject* owner)
     {
-        return IsSupportedEditableType(typeCode);
+        auto it = state.componentsByObject.find(owner);
+        if (it == state.componentsByObject.end() || !it->second.ownerCachedPtr)
+            return false;
+
+        void* cachedPtr = nullptr;
+        return SafeReadUnityObjectCachedPtr(reinterpret_cast<Unity::il2cppObject*>(owner), &cachedPtr)
+            && cachedPtr == it->second.ownerCachedPtr;
     }
 
-    static bool IsInspectableReferenceType(unsigned int typeCode)
+    // Seeds candidates from every component deriving from the filter class.
+    static void BeginValueScan(ExplorerState& state, ValueScanState& scan)
     {
-        switch (typeCode)
+        scan.instances.clear();
+        scan.scanner.Clear();
+        scan.kind = kScanValueKinds[std::clamp(scan.valueKind, 0, static_cast<int>(IM_ARRAYSIZE(kScanValueKinds)) - 1)].kind;
+
+        EnsureObjectCache(state);
+        EnsureComponentSnapshots(state);
+
+        const std::string filter = ToLowerCopy(scan.classFilter[0] ? std::string(scan.classFilter) : std::string("MonoBehaviour"));
+        const std::string suffix = "." + filter;
+        uint32_t targetSlot = 0xFFFFFFFFU;
+        for (size_t slot = 0; slot < state.componentTypeIndex.entries.size(); ++slot)
         {
-        case TypeCode_Object:
-        case TypeCode_Class:
-        case Unity::Type_Array:
-        case Unity::Type_Variable:
-            return true;
-        default:
-            return false;
+            const std::string& label = state.componentTypeIndex.entries[slot].labelLower;
+            if (label == filter || (label.size() > suffix.size() && label.compare(label.size() - suffix.size(), suffix.size(), suffix) == 0))
+            {
+                targetSlot = static_cast<uint32_t>(slot);
+                if (label == filter)
+                    break;
+            }
         }
-    }
 
-    static std::string BuildDefaultMethodArgDraft(unsigned int typeCode)
-    {
-        switch (typeCode)
+        if (targetSlot == 0xFFFFFFFFU)
         {
-        case TypeCode_Boolean:
-            return "false";
-        case TypeCode_String:
-            return {};
-        case TypeCode_R4:
-        case TypeCode_R8:
-            return "0.0";
-        case TypeCode_Char:
-            return "A";
-        default:
-            return "0";
+            scan.status = "No cached component class matches '" + filter + "'";
+            return;
+        }
+
+        for (const ObjectEntry& entry : state.objects)
+        {
+            auto snapshotIt = state.componentsByObject.find(entry.gameObject);
+            if (snapshotIt == state.componentsByObject.end())
+                continue;
+
+            const ComponentSnapshot& snapshot = snapshotIt->second;
+            for (size_t c = 0; c < snapshot.components.size(); ++c)
+            {
+                const std::vector<uint32_t>& chain = GetClassChainSlots(state, snapshot.classes[c]);
+                if (std::find(chain.begin(), chain.end(), targetSlot) == chain.end())
+                    continue;
+
+                const ClassLayout& layout = GetClassLayout(state, snapshot.classes[c]);
+                const uint32_t instanceIndex = static_cast<uint32_t>(scan.instances.size());
+                bool any = false;
+                for (size_t f = 0; f < layout.fields.size() && f <= 0xFFFFU; ++f)
+                {
+                    const FieldLayout& field = layout.fields[f];
+                    WatchValueKind fieldKind{};
+                    if (field.isStatic || field.offset <= 0 || !MapWatchValueKind(field.typeEnum, &fieldKind) || fieldKind != scan.kind)
+                        continue;
+
+                    scan.scanner.Add(instanceIndex, static_cast<uint16_t>(f));
+                    any = true;
+                }
+
+                if (any)
+                    scan.instances.push_back({ reinterpret_cast<uintptr_t>(snapshot.components[c]), snapshot.classes[c], &layout, entry.gameObject });
+            }
         }
+
+        HBLog::Printf("[UExplorer] Value scan seeded: %zu instance(s), %zu %s field(s) under %s\n",
+            scan.instances.size(),
+            scan.scanner.Size(),
+            kScanValueKinds[scan.valueKind].label,
+            state.componentTypeIndex.entries[targetSlot].labelLower.c_str());
+
+        RunValueScan(scan);
     }
 
-    static void DrawComponentFields(ExplorerState& state, Unity::CComponent* component)
+    static void DrawValueScanTab(ExplorerState& state)
     {
-        std::vector<Unity::il2cppFieldInfo*> fields;
-        component->FetchFields(&fields);
+        ValueScanState& scan = state.valueScan;
+
+        ImGui::InputTextWithHint("Class", "MonoBehaviour", scan.classFilter, IM_ARRAYSIZE(scan.classFilter));
+
+        const char* kindLabels[IM_ARRAYSIZE(kScanValueKinds)]{};
+        for (size_t i = 0; i < IM_ARRAYSIZE(kScanValueKinds); ++i)
+            kindLabels[i] = kScanValueKinds[i].label;
+        ImGui::SetNextItemWidth(140.0f);
+        ImGui::Combo("Type", &scan.valueKind, kindLabels, IM_ARRAYSIZE(kindLabels));
+
+        const char* compares[] = { "Exact", "Range", "Changed", "Unchanged", "Increased", "Decreased", "Unknown (any)" };
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(140.0f);
+        ImGui::Combo("Compare", &scan.compare, compares, IM_ARRAYSIZE(compares));
 
-        if (fields.empty())
+        const ScanCompare compare = static_cast<ScanCompare>(scan.compare);
+        if (compare == ScanCompare::Exact || compare == ScanCompare::Range)
         {
-            ImGui::TextDisabled("No fields");
-            return;
+            ImGui::SetNextItemWidth(140.0f);
+            ImGui::InputDouble(compare == ScanCompare::Range ? "From" : "Value", &scan.value, 0.0, 0.0, "%.6g");
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(140.0f);
+            if (compare == ScanCompare::Range)
+                ImGui::InputDouble("To", &scan.valueHigh, 0.0, 0.0, "%.6g");
+            else
+                ImGui::InputDouble("Tolerance", &scan.epsilon, 0.0, 0.0, "%.6g");
         }
 
-        constexpr size_t kMaxDrawFields = 128;
-        const size_t drawCount = (fields.size() > kMaxDrawFields) ? kMaxDrawFields : fields.size();
+        if (AnimatedButton("New scan"))
+            BeginValueScan(state, scan);
 
-        for (size_t i = 0; i < drawCount; ++i)
+        if (scan.scanner.HasValues())
         {
-            Unity::il2cppFieldInfo* field = fields[i];
-            if (!field || !field->m_pName)
-                continue;
+            ImGui::SameLine();
+            if (AnimatedButton("Next scan"))
+                RunValueScan(scan);
+            ImGui::SameLine();
+            if (AnimatedButton("Reset"))
+            {
+                scan.instances.clear();
+                scan.scanner.Clear();
+                scan.status.clear();
+            }
+        }
 
-            const std::string fieldName = MakeSafeMemberLabel(field->m_pName, "field", field);
-            const std::string typeName = ClampUiLabel(GetFieldTypeName(field->m_pType), kMaxUiLabelChars);
-            const bool isStatic = IsStaticField(field);
-            const unsigned int typeEnum = GetFieldTypeEnum(field->m_pType);
-            const uint64_t fieldKey = BuildFieldKey(component, field);
+        if (!scan.status.empty())
+            ImGui::TextDisabled("%s", scan.status.c_str());
 
-            ImGui::PushID(field);
-            const std::string fieldHeader = typeName + " " + fieldName + (isStatic ? " [static]" : " [instance]");
-            ImGui::PushStyleColor(ImGuiCol_Text, kColorField);
-            const bool fieldOpen = ImGui::TreeNode(fieldHeader.c_str());
-            ImGui::PopStyleColor();
+        const ValueScanner& scanner = scan.scanner;
+        if (!scanner.HasValues() || scanner.Size() == 0)
+            return;
+
+        if (ImGui::BeginTable("ScanResults", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY))
+        {
+            ImGui::TableSetupColumn("Object", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Component", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Field", ImGuiTableColumnFlags_WidthStretch);
+            ImGui::TableSetupColumn("Value", ImGuiTableColumnFlags_WidthFixed, 110.0f);
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableHeadersRow();
 
-            if (fieldOpen)
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(scanner.Size()));
+            while (clipper.Step())
             {
-                ImGui::TextDisabled("field_info=%p  offset=0x%X", field, field->m_iOffset);
-                if (!isStatic && field->m_iOffset >= 0)
-                {
-                    void* fieldAddress = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(component) + static_cast<uintptr_t>(field->m_iOffset));
-                    ImGui::TextDisabled("instance_ptr=%p", fieldAddress);
-                }
-                else if (isStatic)
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
                 {
-                    ImGui::TextDisabled("instance_ptr=<static>");
-                    ImGui::TextDisabled("storage=il2cpp_field_static_*");
-                }
+                    const ScanInstance& instance = scan.instances[scanner.instances[row]];
+                    const FieldLayout& field = instance.layout->fields[scanner.fields[row]];
 
-                if (IsSupportedEditableType(typeEnum))
-                {
-                    if (typeEnum == TypeCode_Boolean)
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::PushID(row);
+                    if (IsScanOwnerLive(state, instance.owner))
                     {
-                        bool value = false;
-                        ReadFieldValue(component, field, isStatic, &value);
-
-                        if (ImGui::Checkbox("Value", &value))
-                        {
-                            const bool ok = WriteFieldValue(component, field, isStatic, value);
-                            HBLog::Printf("[UExplorer] Field bool apply %s: %s.%s = %s (%s)\n",
-                                ok ? "OK" : "FAILED",
-                                component->m_Object.m_pClass ? component->m_Object.m_pClass->m_pName : "<class>",
-                                fieldName.c_str(),
-                                value ? "true" : "false",
-                                isStatic ? "static" : "instance");
-                        }
+                        const std::string objectName = SafeGetObjectName(instance.owner);
+                        if (ImGui::Selectable(objectName.c_str(), state.selectedObject == instance.owner, ImGuiSelectableFlags_SpanAllColumns))
+                            SelectObjectDirect(state, instance.owner);
                     }
                     else
                     {
-                        auto draftIt = state.fieldValueDrafts.find(fieldKey);
-                        if (draftIt == state.fieldValueDrafts.end())
-                            draftIt = state.fieldValueDrafts.emplace(fieldKey, BuildFieldDraftFromCurrentValue(component, field, isStatic, typeEnum)).first;
+                        ImGui::TextDisabled("(destroyed)");
+                    }
+                    ImGui::PopID();
+
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(GetClassDisplayName(instance.klass).c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(field.name.c_str());
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%.6g", scanner.values[row]);
+                }
+            }
+            ImGui::EndTable();
+        }
+    }
+
+    static std::string FormatReferenceEdge(const ReferenceGraph& graph, uint32_t index)
+    {
+        const ReferenceNode& node = graph.Node(index);
+        if (node.parent == ReferenceGraph::kNoNode)
+            return "root";
+
+        if (node.label & ReferenceGraph::kArrayElement)
+            return "[" + std::to_string(node.label & ~ReferenceGraph::kArrayElement) + "]";
+
+        const ClassLayout* parent = static_cast<const ClassLayout*>(graph.Node(node.parent).type);
+        return node.label < parent->fields.size() ? parent->fields[node.label].name : std::string("?");
+    }
+
+    static void FocusReferenceNode(ReferenceWalkState& walk, uint32_t index)
+    {
+        walk.focused = index;
+        walk.graph.PathTo(index, &walk.focusedPath);
+    }
+
+    static constexpr size_t kMaxReferenceMatches = 512;
+
+    // Children are virtualized like member rows: an opened array of 65k elements submits only
+    // the rows in view, and a row's height covers its own opened subtree.
+    static void DrawReferenceTreeNode(ExplorerState& state, uint32_t index)
+    {
+        ReferenceWalkState& walk = state.referenceWalk;
+        const ReferenceNode& node = walk.graph.Node(index);
+        const ClassLayout* layout = static_cast<const ClassLayout*>(node.type);
+
+        ImGuiTreeNodeFlags flags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_SpanAvailWidth;
+        if (node.childCount == 0)
+            flags |= ImGuiTreeNodeFlags_Leaf | ImGuiTreeNodeFlags_NoTreePushOnOpen;
+        if (walk.focused == index)
+            flags |= ImGuiTreeNodeFlags_Selected;
+
+        ImGui::PushID(static_cast<int>(index));
+        const bool open = ImGui::TreeNodeEx("##ref", flags, "%s: %s  %p  (%u)",
+            FormatReferenceEdge(walk.graph, index).c_str(),
+            layout->displayName.c_str(),
+            reinterpret_cast<void*>(node.address),
+            node.childCount);
+        if (ImGui::IsItemClicked() && !ImGui::IsItemToggledOpen())
+            FocusReferenceNode(walk, index);
+
+        if (open && node.childCount > 0)
+        {
+            const uint32_t firstChild = node.firstChild;
+            DrawVirtualRows(walk.childRowHeights[index], node.childCount, ImGui::GetFrameHeightWithSpacing(), [&](uint32_t row)
+                {
+                    DrawReferenceTreeNode(state, firstChild + row);
+                });
+            ImGui::TreePop();
+        }
+        ImGui::PopID();
+    }
+
+    // "0x..." finds one address; anything else matches class names, checked once per class.
+    static void FindReferenceNodes(ReferenceWalkState& walk)
+    {
+        walk.matches.clear();
+        const std::string text = ToLowerCopy(walk.search);
+        if (text.empty())
+            return;
+
+        if (text.rfind("0x", 0) == 0)
+        {
+            const uintptr_t address = static_cast<uintptr_t>(std::strtoull(text.c_str() + 2, nullptr, 16));
+            const uint32_t index = walk.graph.Find(address);
+            if (index != ReferenceGraph::kNoNode)
+                walk.matches.emplace_back(index);
+            return;
+        }
+
+        std::unordered_map<const void*, bool> matchByClass;
+        for (uint32_t index = 0; index < walk.graph.Size() && walk.matches.size() < kMaxReferenceMatches; ++index)
+        {
+            const void* type = walk.graph.Node(index).type;
+            auto [it, inserted] = matchByClass.try_emplace(type, false);
+            if (inserted)
+                it->second = ToLowerCopy(static_cast<const ClassLayout*>(type)->displayName).find(text) != std::string::npos;
+            if (it->second)
+                walk.matches.emplace_back(index);
+        }
+    }
 
-                        std::string currentValueText = BuildFieldDraftFromCurrentValue(component, field, isStatic, typeEnum);
+    static void DrawReferencesTab(ExplorerState& state)
+    {
+        ReferenceWalkState& walk = state.referenceWalk;
 
-                        char buffer[512]{};
-                        strncpy_s(buffer, IM_ARRAYSIZE(buffer), draftIt->second.c_str(), _TRUNCATE);
-                        ImGui::SetNextItemWidth(280.0f);
-                        if (ImGui::InputText("Value", buffer, IM_ARRAYSIZE(buffer)))
-                            draftIt->second = buffer;
+        if (AnimatedButton("Walk from selected GameObject") && state.selectedObject)
+            StartReferenceWalk(state, reinterpret_cast<uintptr_t>(state.selectedObject), SafeGetObjectName(state.selectedObject));
+        if (walk.root)
+        {
+            ImGui::SameLine();
+            if (AnimatedButton("Walk again"))
+                RunReferenceWalk(state);
+        }
 
-                        ImGui::SameLine();
-                        if (AnimatedButton("Apply"))
-                        {
-                            if (ApplyFieldDraftValue(component, field, isStatic, typeEnum, draftIt->second))
-                            {
-                                draftIt->second = BuildFieldDraftFromCurrentValue(component, field, isStatic, typeEnum);
-                                HBLog::Printf("[UExplorer] Field apply OK: %s.%s = %s (%s)\n",
-                                    component->m_Object.m_pClass ? component->m_Object.m_pClass->m_pName : "<class>",
-                                    fieldName.c_str(),
-                                    draftIt->second.c_str(),
-                                    isStatic ? "static" : "instance");
-                            }
-                            else
-                            {
-                                HBLog::Printf("[UExplorer] Field apply FAILED: %s.%s input='%s'\n",
-                                    component->m_Object.m_pClass ? component->m_Object.m_pClass->m_pName : "<class>",
-                                    fieldName.c_str(),
-                                    draftIt->second.c_str());
-                            }
-                        }
+        ImGui::SetNextItemWidth(120.0f);
+        ImGui::SliderInt("Depth", &walk.maxDepth, 1, 32);
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(120.0f);
+        ImGui::InputInt("Max objects", &walk.maxNodes, 0, 0);
+        ImGui::SetNextItemWidth(120.0f);
+        ImGui::InputInt("Max edges", &walk.maxEdges, 0, 0);
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(120.0f);
+        ImGui::InputInt("Array elements", &walk.maxArrayElements, 0, 0);
 
-                        ImGui::SameLine();
-                        ImGui::TextDisabled("current: %s", currentValueText.c_str());
-                    }
-                }
-                else if (IsInspectableReferenceType(typeEnum))
-                {
-                    FieldReferencePreview& preview = state.fieldReferencePreviews[fieldKey];
-                    if (AnimatedButton(preview.loaded ? "Refresh Ref" : "Read Ref"))
-                    {
-                        Unity::il2cppObject* refValue = nullptr;
-                        preview.loaded = true;
-                        preview.readFailed = !ReadFieldValue(component, field, isStatic, &refValue);
-                        preview.pointerValue = refValue ? reinterpret_cast<uintptr_t>(refValue) : 0;
+        if (!walk.root)
+        {
+            ImGui::TextDisabled("Pick a root: the selected GameObject, or Walk references on a component.");
+            return;
+        }
 
-                        if (preview.readFailed)
-                        {
-                            HBLog::Printf("[UExplorer] Read ref FAILED: %s.%s (%s)\n",
-                                component->m_Object.m_pClass ? component->m_Object.m_pClass->m_pName : "<class>",
-                                fieldName.c_str(),
-                                isStatic ? "static" : "instance");
-                        }
-                    }
+        ImGui::Text("Root: %s  %p", walk.rootLabel.c_str(), reinterpret_cast<void*>(walk.root));
+        ImGui::TextDisabled("%s", walk.status.c_str());
+        if (walk.graph.Size() == 0)
+            return;
 
-                    if (!preview.loaded)
-                    {
-                        ImGui::TextDisabled("Reference is not read yet.");
-                    }
-                    else if (preview.readFailed)
-                    {
-                        ImGui::TextDisabled("Reference read failed.");
-                    }
-                    else if (preview.pointerValue == 0)
-                    {
-                        ImGui::TextDisabled("ref=<null>");
-                    }
-                    else
-                    {
-                        Unity::il2cppObject* refValue = reinterpret_cast<Unity::il2cppObject*>(preview.pointerValue);
-                        ImGui::Text("ref=%p", refValue);
+        if (ImGui::InputTextWithHint("##refsearch", "class name or 0xaddress", walk.search, IM_ARRAYSIZE(walk.search), ImGuiInputTextFlags_EnterReturnsTrue))
+            FindReferenceNodes(walk);
+        ImGui::SameLine();
+        if (AnimatedButton("Find path"))
+            FindReferenceNodes(walk);
 
-                        if (AnimatedButton("Inspect Ref"))
-                        {
-                            Unity::CGameObject* refObject = ResolveInspectableGameObjectFromCache(state, refValue);
-                            if (refObject)
-                            {
-                                NavigateToReferencedObject(state, refObject);
-                                HBLog::Printf("[UExplorer] Navigate reference: %s -> %s\n",
-                                    fieldName.c_str(),
-                                    SafeGetObjectName(refObject).c_str());
-                            }
-                            else
-                            {
-                                HBLog::Printf("[UExplorer] Inspect Ref failed: %s (ref=%p)\n",
-                                    fieldName.c_str(),
-                                    refValue);
-                            }
-                        }
-                        ImGui::SameLine();
-                        ImGui::TextDisabled("Only GameObject/Component refs are navigable.");
-                    }
-                }
-                else
+        if (!walk.matches.empty())
+        {
+            ImGui::TextDisabled("%zu match(es)%s", walk.matches.size(), walk.matches.size() >= kMaxReferenceMatches ? " (capped)" : "");
+            ImGui::BeginChild("RefMatches", ImVec2(0.0f, 110.0f), true);
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(walk.matches.size()));
+            while (clipper.Step())
+            {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
                 {
-                    void* pointerValue = nullptr;
-                    ReadFieldValue(component, field, isStatic, &pointerValue);
-                    ImGui::TextDisabled("value_ptr=%p", pointerValue);
+                    const uint32_t index = walk.matches[static_cast<size_t>(row)];
+                    const ReferenceNode& node = walk.graph.Node(index);
+                    char label[256]{};
+                    std::snprintf(label, sizeof(label), "%s  %p  depth %u##match%d",
+                        static_cast<const ClassLayout*>(node.type)->displayName.c_str(),
+                        reinterpret_cast<void*>(node.address),
+                        node.depth,
+                        row);
+                    if (ImGui::Selectable(label, walk.focused == index))
+                        FocusReferenceNode(walk, index);
                 }
+            }
+            ImGui::EndChild();
+        }
 
-                ImGui::TreePop();
+        if (!walk.focusedPath.empty())
+        {
+            std::string path;
+            for (uint32_t index : walk.focusedPath)
+            {
+                std::string edge = FormatReferenceEdge(walk.graph, index);
+                if (!path.empty() && edge[0] != '[')
+                    path += ".";
+                path += edge;
             }
 
-            ImGui::Separator();
-            ImGui::PopID();
+            const ReferenceNode& target = walk.graph.Node(walk.focused);
+            ImGui::TextWrapped("Path: %s -> %s", path.c_str(), static_cast<const ClassLayout*>(target.type)->displayName.c_str());
+            if (AnimatedButton("Inspect target"))
+            {
+                EnsureObjectCache(state);
+                Unity::CGameObject* owner = ResolveInspectableGameObjectFromCache(state, reinterpret_cast<Unity::il2cppObject*>(target.address));
+                if (owner)
+                    NavigateToReferencedObject(state, owner);
+                else
+                    HBLog::Printf("[UExplorer] Reference target %p is not a GameObject or component\n", reinterpret_cast<void*>(target.address));
+            }
         }
 
-        if (fields.size() > drawCount)
-            ImGui::TextDisabled("... %zu more field(s)", fields.size() - drawCount);
+        ImGui::BeginChild("RefTree", ImVec2(0.0f, 0.0f), true);
+        DrawReferenceTreeNode(state, 0);
+        ImGui::EndChild();
     }
 
-    static void DrawComponentMethods(ExplorerState& state, Unity::CComponent* component)
+    static constexpr ULONGLONG kReverseReferenceRefreshMs = 1000;
+
+    // Runs on index workers. The class check drops owners collected since the object refresh.
+    static bool SafeReadOwnerSlots(const ReverseReferenceIndex::Owner& owner, uintptr_t* outSlots)
     {
-        std::vector<Unity::il2cppMethodInfo*> methods;
-        if (!SafeFetchMethods(component, &methods))
-        {
-            ImGui::TextDisabled("Method metadata unavailable");
-            return;
-        }
+        const ClassLayout* layout = static_cast<const ClassLayout*>(owner.type);
+        Unity::il2cppClass* ownerClass = nullptr;
+        return SafeReadObjectClass(reinterpret_cast<Unity::il2cppObject*>(owner.address), &ownerClass)
+            && ownerClass == layout->klass
+            && SafeReadReferenceSlots(owner.address, layout->fields.data(), layout->referenceFields.data(), owner.slotCount, outSlots);
+    }
 
-        if (methods.empty())
-        {
-            ImGui::TextDisabled("No methods");
+    // Collects owners on the render thread (layouts and the object cache live here) and hands
+    // the slot reads and map updates to a worker. Does nothing while a job is in flight.
+    static void StartReverseReferenceRefresh(ExplorerState& state)
+    {
+        ReverseReferenceState& reverse = state.reverseReferences;
+        if (reverse.job)
             return;
-        }
 
-        constexpr size_t kMaxDrawMethods = 256;
-        const size_t drawCount = (methods.size() > kMaxDrawMethods) ? kMaxDrawMethods : methods.size();
+        EnsureObjectCache(state);
+        EnsureComponentSnapshots(state);
 
-        for (size_t i = 0; i < drawCount; ++i)
+        std::shared_ptr<ReverseReferenceJob> job = std::make_shared<ReverseReferenceJob>();
+        for (const ObjectEntry& entry : state.objects)
         {
-            Unity::il2cppMethodInfo* method = methods[i];
-            if (!method)
+            auto snapshotIt = state.componentsByObject.find(entry.gameObject);
+            if (snapshotIt == state.componentsByObject.end())
                 continue;
 
-            const char* rawMethodName = nullptr;
-            Unity::il2cppType* returnType = nullptr;
-            void* methodPointer = nullptr;
-            void* invokerPointer = nullptr;
-            uint32_t rawArgCount = 0;
-            uint32_t methodFlags = 0;
-            if (!SafeReadMethodMetadata(
-                method,
-                &rawMethodName,
-                &returnType,
-                &methodPointer,
-                &invokerPointer,
-                &rawArgCount,
-                &methodFlags))
-            {
-                ImGui::PushID(method);
-                ImGui::TextDisabled("<invalid method metadata>");
-                ImGui::Separator();
-                ImGui::PopID();
-                continue;
+            const ComponentSnapshot& snapshot = snapshotIt->second;
+            for (size_t c = 0; c < snapshot.components.size(); ++c)
+            {
+                const ClassLayout& layout = GetClassLayout(state, snapshot.classes[c]);
+                if (layout.isArray || layout.referenceFields.empty())
+                    continue;
+
+                job->owners.push_back({ reinterpret_cast<uintptr_t>(snapshot.components[c]), &layout, static_cast<uint32_t>(layout.referenceFields.size()) });
+                job->ownerObjects.emplace_back(entry.gameObject);
             }
+        }
 
-            const uint32_t uiArgCount = (rawArgCount > kMaxMethodArgsUi) ? kMaxMethodArgsUi : rawArgCount;
-            const bool argCountCapped = (rawArgCount > kMaxMethodArgsUi);
-            const bool suspiciousArgCount = (rawArgCount > kHardMethodArgsLimit);
-            const bool argCountTooLargeForInvoke = (rawArgCount > kMaxMethodArgsInvoke) || suspiciousArgCount;
-            const uint32_t displayedArgCount = suspiciousArgCount ? 0U : uiArgCount;
+        job->index = std::move(reverse.spare);
+        job->generation = state.objectCacheGeneration;
+        reverse.job = job;
 
-            const std::string methodName = MakeSafeMemberLabel(rawMethodName, "method", method);
-            const bool isStatic = (methodFlags & 0x0010U) != 0U;
-            const uint64_t methodKey = BuildMethodKey(component, method);
-            const std::string signature = BuildMethodSignature(method, displayedArgCount, rawArgCount);
-            const std::string returnTypeName = ClampUiLabel(GetFieldTypeName(returnType), kMaxUiLabelChars);
+        std::thread([job]()
+            {
+                job->index.Refresh(std::move(job->owners), SafeReadOwnerSlots, GetScanThreadCount());
+                job->done.store(true, std::memory_order_release);
+            }).detach();
+    }
 
-            ImGui::PushID(method);
-            ImGui::TextColored(kColorMethod, "%s %s", returnTypeName.c_str(), signature.c_str());
-            ImGui::SameLine();
-            ImGui::TextDisabled("[%s]", isStatic ? "static" : "instance");
-            ImGui::TextDisabled("method_info=%p", method);
-            uintptr_t methodRva = 0;
-            if (TryGetGameAssemblyRva(methodPointer, &methodRva))
-                ImGui::TextDisabled("method_ptr=%p  RVA=0x%llX", methodPointer, static_cast<unsigned long long>(methodRva));
-            else
-                ImGui::TextDisabled("method_ptr=%p", methodPointer);
+    // Swaps a finished job's index in; the replaced one becomes the next job's back buffer.
+    static void FinishReverseReferenceRefresh(ExplorerState& state)
+    {
+        ReverseReferenceState& reverse = state.reverseReferences;
+        if (!reverse.job || !reverse.job->done.load(std::memory_order_acquire))
+            return;
 
-            uintptr_t invokerRva = 0;
-            if (TryGetGameAssemblyRva(invokerPointer, &invokerRva))
-                ImGui::TextDisabled("invoker=%p  RVA=0x%llX", invokerPointer, static_cast<unsigned long long>(invokerRva));
-            else
-                ImGui::TextDisabled("invoker=%p", invokerPointer);
+        ReverseReferenceJob& job = *reverse.job;
+        std::swap(reverse.index, job.index);
+        reverse.ownerObjects.swap(job.ownerObjects);
+        reverse.spare = std::move(job.index);
+        reverse.built = true;
+        reverse.builtGeneration = job.generation;
+        reverse.lastRefreshTick = GetTickCount64();
+        reverse.job.reset();
+
+        const ReverseReferenceIndex::Stats& stats = reverse.index.GetStats();
+        char buffer[256]{};
+        std::snprintf(buffer, sizeof(buffer), "%zu reference(s) to %zu object(s) from %zu component(s); %zu new, %zu changed, %zu gone, %zu unreadable; %.2f ms on %u thread(s)",
+            stats.references,
+            stats.targets,
+            stats.owners,
+            stats.added,
+            stats.changed,
+            stats.removed,
+            stats.unreadable,
+            stats.totalMs,
+            stats.threads);
+        reverse.status = buffer;
+    }
 
-            auto draftIt = state.methodArgDrafts.find(methodKey);
-            if (draftIt == state.methodArgDrafts.end())
-                draftIt = state.methodArgDrafts.emplace(methodKey, std::vector<std::string>{}).first;
+    // Kept fresh while a "Referenced by" panel is open; unchanged components cost one slot read
+    // per refresh, and none of it runs on the render thread past collecting the owners.
+    static void TickReverseReferences(ExplorerState& state)
+    {
+        ReverseReferenceState& reverse = state.reverseReferences;
+        FinishReverseReferenceRefresh(state);
 
-            if (draftIt->second.size() != displayedArgCount)
-                draftIt->second.assign(displayedArgCount, {});
+        const ULONGLONG now = GetTickCount64();
+        if (!reverse.built
+            || reverse.builtGeneration != state.objectCacheGeneration
+            || (reverse.autoRefresh && (now - reverse.lastRefreshTick) >= kReverseReferenceRefreshMs))
+        {
+            StartReverseReferenceRefresh(state);
+        }
+    }
 
-            bool allArgsSupported = !argCountTooLargeForInvoke;
-            for (uint32_t argIndex = 0; argIndex < displayedArgCount; ++argIndex)
-            {
-                Unity::il2cppType* paramType = SafeGetMethodParamType(method, argIndex);
-                const unsigned int typeCode = GetFieldTypeEnum(paramType);
-                const bool isSupported = IsSupportedMethodArgType(typeCode);
-                if (!isSupported)
-                    allArgsSupported = false;
+    static void DrawReferencedBy(ExplorerState& state, Unity::CGameObject* gameObject)
+    {
+        TickReverseReferences(state);
 
-                const char* paramNameRaw = SafeGetMethodParamName(method, argIndex);
-                std::string paramName = paramNameRaw ? SanitizeMemberName(paramNameRaw) : ("arg" + std::to_string(argIndex));
-                if (paramName == "<invalid-name>" || paramName == "<null>" || paramName.empty())
-                    paramName = "arg" + std::to_string(argIndex);
+        ReverseReferenceState& reverse = state.reverseReferences;
+        if (AnimatedButton("Refresh##reverse"))
+            StartReverseReferenceRefresh(state);
+        ImGui::SameLine();
+        ImGui::Checkbox("Auto##reverse", &reverse.autoRefresh);
+        ImGui::SameLine();
+        ImGui::Checkbox("Hide own components", &reverse.hideSelf);
+        if (!reverse.built)
+            ImGui::TextDisabled("Indexing references...");
+        else
+            ImGui::TextDisabled("%s%s", reverse.status.c_str(), reverse.job ? " (refreshing)" : "");
 
-                if (draftIt->second[argIndex].empty())
-                    draftIt->second[argIndex] = BuildDefaultMethodArgDraft(typeCode);
+        // The GameObject itself and each of its components are targets.
+        std::vector<std::pair<uintptr_t, std::string>> targets;
+        targets.emplace_back(reinterpret_cast<uintptr_t>(gameObject), std::string("GameObject"));
+        auto snapshotIt = state.componentsByObject.find(gameObject);
+        if (snapshotIt != state.componentsByObject.end())
+        {
+            const ComponentSnapshot& snapshot = snapshotIt->second;
+            for (size_t c = 0; c < snapshot.components.size(); ++c)
+                targets.emplace_back(reinterpret_cast<uintptr_t>(snapshot.components[c]), GetClassDisplayName(snapshot.classes[c]));
+        }
 
-                const std::string safeParamTypeName = ClampUiLabel(GetFieldTypeName(paramType), kMaxUiLabelChars);
-                ImGui::Text("arg%u: %s %s", static_cast<unsigned int>(argIndex), safeParamTypeName.c_str(), paramName.c_str());
-                ImGui::SameLine();
+        struct Row
+        {
+            uint32_t owner = 0;
+            uint32_t slot = 0;
+            size_t target = 0;
+        };
 
-                if (isSupported)
-                {
-                    const std::string inputId = "##arg_" + std::to_string(argIndex);
-                    if (typeCode == TypeCode_Boolean)
-                    {
-                        bool boolValue = false;
-                        ParseBoolText(draftIt->second[argIndex], &boolValue);
-                        if (ImGui::Checkbox(inputId.c_str(), &boolValue))
-                            draftIt->second[argIndex] = boolValue ? "true" : "false";
-                    }
-                    else
-                    {
-                        char argBuffer[256]{};
-                        strncpy_s(argBuffer, IM_ARRAYSIZE(argBuffer), draftIt->second[argIndex].c_str(), _TRUNCATE);
-                        ImGui::SetNextItemWidth(240.0f);
-                        if (ImGui::InputText(inputId.c_str(), argBuffer, IM_ARRAYSIZE(argBuffer)))
-                            draftIt->second[argIndex] = argBuffer;
-                    }
-                }
-                else
-                {
-                    ImGui::TextDisabled("unsupported arg type");
-                }
-            }
+        std::vector<Row> rows;
+        for (size_t t = 0; t < targets.size(); ++t)
+        {
+            const std::vector<ReverseReferenceIndex::Source>* sources = reverse.index.Find(targets[t].first);
+            if (!sources)
+                continue;
 
-            if (suspiciousArgCount)
-            {
-                ImGui::TextDisabled("Metadata guard: argument list hidden (%u args).", static_cast<unsigned int>(rawArgCount));
-            }
-            else if (argCountCapped)
+            for (const ReverseReferenceIndex::Source& source : *sources)
             {
-                ImGui::TextDisabled("... %u more arg(s) hidden", static_cast<unsigned int>(rawArgCount - uiArgCount));
-            }
+                const uint32_t owner = reverse.index.FindOwner(source.owner);
+                if (owner == ReverseReferenceIndex::kNoOwner || (reverse.hideSelf && reverse.ownerObjects[owner] == gameObject))
+                    continue;
 
-            const bool canInvoke = (state.fnRuntimeInvoke != nullptr) && allArgsSupported;
-            ImGui::BeginDisabled(!canInvoke);
-            if (AnimatedButton("Invoke"))
-            {
-                std::string invokeResult;
-                if (InvokeMethodViaRuntimeInvoke(state, component, method, draftIt->second, &invokeResult))
-                {
-                    state.methodInvokeResults[methodKey] = invokeResult;
-                    HBLog::Printf("[UExplorer] Method invoke OK: %s -> %s\n", methodName.c_str(), invokeResult.c_str());
-                }
-                else
-                {
-                    if (invokeResult.empty())
-                        invokeResult = "<invoke-failed>";
-                    state.methodInvokeResults[methodKey] = invokeResult;
-                    HBLog::Printf("[UExplorer] Method invoke FAILED: %s -> %s\n", methodName.c_str(), invokeResult.c_str());
-                }
+                rows.push_back({ owner, source.slot, t });
             }
-            ImGui::EndDisabled();
+        }
 
-            if (state.fnRuntimeInvoke == nullptr)
-                ImGui::TextDisabled("il2cpp_runtime_invoke is not resolved.");
-            else if (argCountTooLargeForInvoke)
-                ImGui::TextDisabled("Invoke unavailable: method has too many args.");
-            else if (!allArgsSupported)
-                ImGui::TextDisabled("Invoke unavailable: unsupported argument type present.");
+        if (rows.empty())
+        {
+            ImGui::TextDisabled("No cached component references this object");
+            return;
+        }
+
+        if (!ImGui::BeginTable("ReferencedByTable", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY, ImVec2(0.0f, 220.0f)))
+            return;
+
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Owner");
+        ImGui::TableSetupColumn("Field");
+        ImGui::TableSetupColumn("Target");
+        ImGui::TableHeadersRow();
 
-            auto resultIt = state.methodInvokeResults.find(methodKey);
-            if (resultIt != state.methodInvokeResults.end())
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(rows.size()));
+        while (clipper.Step())
+        {
+            for (int r = clipper.DisplayStart; r < clipper.DisplayEnd; ++r)
             {
-                ImGui::SameLine();
-                ImGui::Text("Result: %s", resultIt->second.c_str());
-            }
+                const Row& row = rows[static_cast<size_t>(r)];
+                const ReverseReferenceIndex::Owner& owner = reverse.index.GetOwner(row.owner);
+                const ClassLayout* layout = static_cast<const ClassLayout*>(owner.type);
+                Unity::CGameObject* ownerObject = reverse.ownerObjects[row.owner];
+
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0);
+                ImGui::PushID(r);
+                const std::string ownerName = SafeGetObjectName(ownerObject);
+                if (ImGui::Selectable(ownerName.c_str(), false, ImGuiSelectableFlags_SpanAllColumns))
+                    NavigateToReferencedObject(state, ownerObject);
+                ImGui::PopID();
 
-            ImGui::Separator();
-            ImGui::PopID();
+                ImGui::TableSetColumnIndex(1);
+                ImGui::PushStyleColor(ImGuiCol_Text, kColorField);
+                ImGui::Text("%s.%s", layout->displayName.c_str(), layout->fields[layout->referenceFields[row.slot]].name.c_str());
+                ImGui::PopStyleColor();
+
+                ImGui::TableSetColumnIndex(2);
+                ImGui::TextUnformatted(targets[row.target].second.c_str());
+            }
         }
 
-        if (methods.size() > drawCount)
-            ImGui::TextDisabled("... %zu more method(s)", methods.size() - drawCount);
+        ImGui::EndTable();
     }
 
-    static void DrawComponentsInspector(ExplorerState& state, Unity::CGameObject* gameObject)
+    static void DrawHeapInstancesTab(ExplorerState& state)
     {
-        if (!gameObject)
-            return;
+        HeapInstancesState& heap = state.heapInstances;
 
-        Unity::il2cppObject* componentType = IL2CPP::SystemTypeCache::Get(UNITY_COMPONENT_CLASS);
-        if (!componentType)
-            componentType = IL2CPP::Class::GetSystemType(UNITY_COMPONENT_CLASS);
+        const bool submitted = ImGui::InputTextWithHint("Class##heap", "Namespace.ClassName", heap.className, IM_ARRAYSIZE(heap.className), ImGuiInputTextFlags_EnterReturnsTrue);
+        ImGui::Checkbox("Exact class only", &heap.exactClass);
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(120.0f);
+        if (ImGui::InputInt("Max instances", &heap.capacity, 0, 0))
+            heap.capacity = std::clamp(heap.capacity, 1, kMaxHeapInstances);
+        ImGui::SameLine();
+        ImGui::TextDisabled("(%.1f MB reserved per walk)", static_cast<double>(heap.capacity) * sizeof(uintptr_t) / (1024.0 * 1024.0));
 
-        if (!componentType)
+        if (AnimatedButton("List live instances") || submitted)
         {
-            ImGui::TextDisabled("Component type cache is not ready");
-            return;
+            heap.klass = heap.className[0] ? IL2CPP::Class::Find(heap.className) : nullptr;
+            if (heap.klass)
+            {
+                RunHeapEnumeration(state);
+            }
+            else
+            {
+                heap.instances.clear();
+                heap.status = std::string("Class '") + heap.className + "' not found";
+            }
         }
 
-        Unity::il2cppArray<Unity::CComponent*>* components = SafeGetComponents(gameObject, componentType);
-        if (!components || components->m_uMaxLength == 0)
+        if (heap.klass && !heap.instances.empty())
         {
-            ImGui::TextDisabled("No components found");
-            return;
+            ImGui::SameLine();
+            if (AnimatedButton("Refresh##heap"))
+                RunHeapEnumeration(state);
         }
 
-        for (uintptr_t i = 0; i < components->m_uMaxLength; ++i)
-        {
-            Unity::CComponent* component = components->operator[](static_cast<unsigned int>(i));
-            if (!component)
-                continue;
+        ImGui::TextDisabled("Objects reachable from static fields; held only by locals or native code they are not listed.");
+        if (!heap.status.empty())
+            ImGui::TextDisabled("%s", heap.status.c_str());
 
-            const std::string componentName = GetClassDisplayName(component->m_Object.m_pClass);
-            const std::string treeLabel = componentName + "##component_" + std::to_string(reinterpret_cast<uintptr_t>(component));
+        if (heap.instances.empty())
+            return;
 
-            ImGui::PushStyleColor(ImGuiCol_Text, kColorClass);
-            const bool componentOpen = ImGui::TreeNode(treeLabel.c_str());
-            ImGui::PopStyleColor();
+        if (!ImGui::BeginTable("HeapInstancesTable", 3, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV | ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY))
+            return;
 
-            if (componentOpen)
-            {
-                ImGui::Text("Address: 0x%p", component);
-                ImGui::TextDisabled("cached_ptr=%p", component->m_CachedPtr);
+        ImGui::TableSetupScrollFreeze(0, 1);
+        ImGui::TableSetupColumn("Address", ImGuiTableColumnFlags_WidthFixed, 150.0f);
+        ImGui::TableSetupColumn("Class");
+        ImGui::TableSetupColumn("Actions", ImGuiTableColumnFlags_WidthFixed, 170.0f);
+        ImGui::TableHeadersRow();
 
-                ImGui::PushStyleColor(ImGuiCol_Text, kColorField);
-                const bool fieldsOpen = ImGui::TreeNode("Fields");
+        ImGuiListClipper clipper;
+        clipper.Begin(static_cast<int>(heap.instances.size()));
+        while (clipper.Step())
+        {
+            for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row)
+            {
+                const uintptr_t object = heap.instances[static_cast<size_t>(row)];
+                Unity::il2cppClass* objectClass = nullptr;
+                SafeReadObjectClass(reinterpret_cast<Unity::il2cppObject*>(object), &objectClass);
+
+                ImGui::TableNextRow();
+                ImGui::PushID(row);
+                ImGui::TableSetColumnIndex(0);
+                ImGui::Text("%p", reinterpret_cast<void*>(object));
+
+                ImGui::TableSetColumnIndex(1);
+                ImGui::PushStyleColor(ImGuiCol_Text, kColorClass);
+                ImGui::TextUnformatted(objectClass ? GetClassDisplayName(objectClass).c_str() : "<collected>");
                 ImGui::PopStyleColor();
-                if (fieldsOpen)
-                {
-                    DrawComponentFields(state, component);
-                    ImGui::TreePop();
-                }
 
-                ImGui::PushStyleColor(ImGuiCol_Text, kColorMethod);
-                const bool methodsOpen = ImGui::TreeNode("Methods");
-                ImGui::PopStyleColor();
-                if (methodsOpen)
+                ImGui::TableSetColumnIndex(2);
+                if (objectClass)
                 {
-                    DrawComponentMethods(state, component);
-                    ImGui::TreePop();
+                    if (AnimatedButton("Walk"))
+                        StartReferenceWalk(state, object, GetClassDisplayName(objectClass));
+                    ImGui::SameLine();
+                    if (AnimatedButton("Inspect"))
+                    {
+                        EnsureObjectCache(state);
+                        Unity::CGameObject* owner = ResolveInspectableGameObjectFromCache(state, reinterpret_cast<Unity::il2cppObject*>(object));
+                        if (owner)
+                            NavigateToReferencedObject(state, owner);
+                        else
+                            HBLog::Printf("[UExplorer] %p is not a GameObject or component; use Walk to browse its fields\n", reinterpret_cast<void*>(object));
+                    }
                 }
-
-                ImGui::TreePop();
+                ImGui::PopID();
             }
         }
+
+        ImGui::EndTable();
     }
 
     static void DrawInspectorWindow(ExplorerState& state)
@@ -2800,24 +8609,27 @@ namespace UExplorer
             ImGui::TextDisabled("History: %zu", state.navigationHistory.size());
         }
 
-        if (!state.selectedObject)
+        if (!state.selectedHandle)
         {
             ImGui::TextDisabled("Select an object from Object Explorer.");
             ImGui::End();
             return;
         }
 
-        if (state.aliveObjects.find(state.selectedObject) == state.aliveObjects.end())
+        Unity::CGameObject* gameObject = ResolveGameObjectHandle(state, state.selectedHandle);
+        if (!gameObject && TryRecoverSelectionByPath(state))
+            gameObject = ResolveGameObjectHandle(state, state.selectedHandle);
+
+        if (!gameObject)
         {
             ImGui::TextDisabled("Selected object is no longer valid.");
             ImGui::End();
             return;
         }
 
-        if (state.transformEditTarget != state.selectedObject)
-            SyncTransformEditor(state, state.selectedObject);
-
-        Unity::CGameObject* gameObject = state.selectedObject;
+        state.selectedObject = gameObject;
+        if (state.transformEditTarget != state.selectedHandle)
+            SyncTransformEditor(state, gameObject);
 
         ImGui::Text("Name: %s", SafeGetObjectName(gameObject).c_str());
         ImGui::Text("Type: %s", GetClassDisplayName(gameObject->m_Object.m_pClass).c_str());
@@ -2830,15 +8642,33 @@ namespace UExplorer
         if (sceneHandle != 0)
             ImGui::Text("Scene handle: %d", sceneHandle);
 
+        if (!state.selectedPath.empty())
+        {
+            ImGui::TextWrapped("Path: %s", state.selectedPath.c_str());
+            ImGui::SameLine();
+            if (AnimatedButton("Copy path"))
+                ImGui::SetClipboardText(state.selectedPath.c_str());
+        }
+
         bool active = gameObject->GetActive();
         if (ImGui::Checkbox("Active", &active))
+        {
             gameObject->SetActive(active);
+            auto ownerIt = state.ownerByManagedObject.find(gameObject);
+            if (ownerIt != state.ownerByManagedObject.end() && ownerIt->second < state.objects.size())
+                state.objects[ownerIt->second].activeSelf = active;
+            SyncObjectAttributes(state, gameObject, true);
+        }
 
         int layer = static_cast<int>(gameObject->GetLayer());
         if (ImGui::InputInt("Layer", &layer))
         {
             layer = (layer < 0) ? 0 : (layer > 31 ? 31 : layer);
             gameObject->SetLayer(static_cast<unsigned int>(layer));
+            auto snapshotIt = state.componentsByObject.find(gameObject);
+            if (snapshotIt != state.componentsByObject.end())
+                snapshotIt->second.layer = layer;
+            SyncObjectAttributes(state, gameObject, false);
         }
 
         ImGui::SeparatorText("Transform");
@@ -2882,6 +8712,9 @@ namespace UExplorer
         ImGui::SeparatorText("Components");
         DrawComponentsInspector(state, gameObject);
 
+        if (ImGui::CollapsingHeader("Referenced by"))
+            DrawReferencedBy(state, gameObject);
+
         ImGui::End();
     }
 
@@ -3032,6 +8865,55 @@ namespace UExplorer
         return true;
     }
 
+    // Called from game-thread hooks; must stay lock-free and must not touch ExplorerState.
+    void PostChangeEvent(ChangeEventKind kind, int sceneHandle, const void* subject)
+    {
+        ChangeEvent changeEvent{};
+        changeEvent.kind = kind;
+        changeEvent.sceneHandle = sceneHandle;
+        changeEvent.subject = reinterpret_cast<uintptr_t>(subject);
+        changeEvent.tick = GetTickCount64();
+        GetChangeQueue().TryPush(changeEvent);
+    }
+
+    // Called from Present while the overlay is hidden, once the render thread is attached.
+    // Keeps the change queue drained so the churn recording does not stop (or overflow), and
+    // keeps watch targets resolved so the sampler never reads an object that died while the
+    // explorer was closed.
+    void TickWhileHidden()
+    {
+        ExplorerState& state = GetState();
+        if (!state.initialized)
+            return;
+
+        DrainChangeEvents(state, false);
+        TickWatches(state);
+    }
+
+    // True once a watch exists; main.cpp then installs the update hook off the render thread.
+    bool WantsWatchUpdateHook()
+    {
+        return !GetState().watches.entries.empty();
+    }
+
+    void SetChangeHooksActive(bool active)
+    {
+        GetState().changeHooksActive = active;
+    }
+
+    // Registered on IL2CPP::Callback::OnUpdate; runs on the game thread. The hook may fire more
+    // than once per frame, so the sampler's own interval gates the work.
+    void SampleWatchesOnUpdate()
+    {
+        TickWatchSampler();
+    }
+
+    // Written by the hook installer thread, read by Present.
+    void SetWatchUpdateHookActive(bool active)
+    {
+        GetState().watches.updateHookActive.store(active, std::memory_order_release);
+    }
+
     void NotifyVisibilityChanged(bool visible)
     {
         ExplorerState& state = GetState();
@@ -3041,9 +8923,9 @@ namespace UExplorer
             return;
         }
 
-        state.selectedObject = nullptr;
-        state.transformEditTarget = nullptr;
+        ClearSelection(state);
         state.navigationHistory.clear();
+        ReleaseUnreferencedObjectHandles(state);
     }
 
     void Draw(bool* pOpen)
@@ -3062,6 +8944,8 @@ namespace UExplorer
         }
 
         TickRefresh(state);
+        TickTransformCapture(state);
+        TickWatches(state);
 
         ImGuiViewport* viewport = ImGui::GetMainViewport();
         const ImVec2 origin = viewport->WorkPos;
@@ -3103,6 +8987,42 @@ namespace UExplorer
                     ImGui::EndTabItem();
                 }
 
+                if (ImGui::BeginTabItem("Churn"))
+                {
+                    DrawChurnTab(state);
+                    ImGui::EndTabItem();
+                }
+
+                if (ImGui::BeginTabItem("Nearby"))
+                {
+                    DrawNearbyTab(state);
+                    ImGui::EndTabItem();
+                }
+
+                if (ImGui::BeginTabItem("Watches"))
+                {
+                    DrawWatchesTab(state);
+                    ImGui::EndTabItem();
+                }
+
+                if (ImGui::BeginTabItem("Scanner"))
+                {
+                    DrawValueScanTab(state);
+                    ImGui::EndTabItem();
+                }
+
+                if (ImGui::BeginTabItem("References"))
+                {
+                    DrawReferencesTab(state);
+                    ImGui::EndTabItem();
+                }
+
+                if (ImGui::BeginTabItem("Heap"))
+                {
+                    DrawHeapInstancesTab(state);
+                    ImGui::EndTabItem();
+                }
+
                 ImGui::EndTabBar();
             }
         }
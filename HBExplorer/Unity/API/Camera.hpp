@@ -15,6 +15,10 @@ namespace Unity
 
 		// Prefer injected(out) form; keep as-is but allow IntPtr this
 		void* m_WorldToScreen = nullptr;  bool m_WorldToScreen_ThisIsPtr = false;
+
+		// Injected(out Matrix4x4) forms
+		void* m_GetWorldToCameraMatrix = nullptr; bool m_GetWorldToCameraMatrix_ThisIsPtr = false;
+		void* m_GetProjectionMatrix = nullptr;    bool m_GetProjectionMatrix_ThisIsPtr = false;
 	};
 	inline CameraFunctions_t m_CameraFunctions;
 
@@ -77,6 +81,29 @@ namespace Unity
 			}
 			reinterpret_cast<void(UNITY_CALLING_CONVENTION)(void*, Vector3&, int, Vector3&)>(m_CameraFunctions.m_WorldToScreen)(selfArg, m_vWorld, m_iEye, m_vScreen);
 		}
+
+		// Unity layout: column-major, m[column][row].
+		bool GetWorldToCameraMatrix(Matrix4x4& m_mMatrix)
+		{
+			if (!this || !m_CameraFunctions.m_GetWorldToCameraMatrix)
+				return false;
+
+			void* selfArg = m_CameraFunctions.m_GetWorldToCameraMatrix_ThisIsPtr ? this->m_CachedPtr : (void*)this;
+			if (!selfArg) return false;
+			reinterpret_cast<void(UNITY_CALLING_CONVENTION)(void*, Matrix4x4&)>(m_CameraFunctions.m_GetWorldToCameraMatrix)(selfArg, m_mMatrix);
+			return true;
+		}
+
+		bool GetProjectionMatrix(Matrix4x4& m_mMatrix)
+		{
+			if (!this || !m_CameraFunctions.m_GetProjectionMatrix)
+				return false;
+
+			void* selfArg = m_CameraFunctions.m_GetProjectionMatrix_ThisIsPtr ? this->m_CachedPtr : (void*)this;
+			if (!selfArg) return false;
+			reinterpret_cast<void(UNITY_CALLING_CONVENTION)(void*, Matrix4x4&)>(m_CameraFunctions.m_GetProjectionMatrix)(selfArg, m_mMatrix);
+			return true;
+		}
 	};
 
 	namespace Camera
@@ -163,6 +190,18 @@ namespace Unity
 				{ UNITY_CAMERA_WORLDTOSCREEN, IL2CPP_RStr(UNITY_CAMERA_CLASS"::WorldToScreenPoint_Injected") },
 				{ IL2CPP_RStr(UNITY_CAMERA_CLASS"::WorldToScreenPoint_Injected"),
 				  IL2CPP_RStr(UNITY_CAMERA_CLASS"::WorldToScreenPoint_Injected(System.IntPtr,UnityEngine.Vector3&,System.Int32,UnityEngine.Vector3&)") });
+
+			resolveInstance(m_CameraFunctions.m_GetWorldToCameraMatrix, m_CameraFunctions.m_GetWorldToCameraMatrix_ThisIsPtr,
+				"get_worldToCameraMatrix_Injected", 1,
+				"get_worldToCameraMatrix_Injected", 2,
+				{ UNITY_CAMERA_GETWORLDTOCAMERAMATRIX },
+				{ IL2CPP_RStr(UNITY_CAMERA_CLASS"::get_worldToCameraMatrix_Injected(System.IntPtr,UnityEngine.Matrix4x4&)") });
+
+			resolveInstance(m_CameraFunctions.m_GetProjectionMatrix, m_CameraFunctions.m_GetProjectionMatrix_ThisIsPtr,
+				"get_projectionMatrix_Injected", 1,
+				"get_projectionMatrix_Injected", 2,
+				{ UNITY_CAMERA_GETPROJECTIONMATRIX },
+				{ IL2CPP_RStr(UNITY_CAMERA_CLASS"::get_projectionMatrix_Injected(System.IntPtr,UnityEngine.Matrix4x4&)") });
 		}
 
 		inline CCamera* GetCurrent()
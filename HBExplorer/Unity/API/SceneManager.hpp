@@ -61,6 +61,14 @@ namespace Unity
 
     inline SceneManagerFunctions_t m_SceneManagerFunctions;
 
+    struct SceneFunctions_t
+    {
+        void* m_GetName = nullptr;            // static (int handle) -> string
+        void* m_GetRootGameObjects = nullptr; // instance (Scene*) -> GameObject[]
+    };
+
+    inline SceneFunctions_t m_SceneFunctions;
+
     namespace SceneManager
     {
         inline void Initialize()
@@ -171,6 +179,12 @@ namespace Unity
             resolveStatic(m_SceneManagerFunctions.m_MoveGameObjectToScene,
                 "MoveGameObjectToScene", 2,
                 { UNITY_SM_MOVEGAMEOBJECTTOSCENE, IL2CPP_RStr(UNITY_SCENEMANAGER_CLASS"::MoveGameObjectToScene") });
+
+            // Scene (handle based internals + GetRootGameObjects)
+            m_SceneFunctions.m_GetName = IL2CPP::ResolveUnityMethodOrIcall(UNITY_SCENE_CLASS, "GetNameInternal", 1,
+                { UNITY_SCENE_GETNAME });
+
+            m_SceneFunctions.m_GetRootGameObjects = IL2CPP::ResolveUnityMethod(UNITY_SCENE_CLASS, "GetRootGameObjects", 0);
         }
 
         // ------------- Public API -------------
@@ -362,6 +376,26 @@ namespace Unity
                 m_SceneManagerFunctions.m_MergeScenes)(sourceScene, destinationScene);
         }
 
+        inline System_String* GetSceneName(Scene s)
+        {
+            if (!m_SceneFunctions.m_GetName)
+                return nullptr;
+
+            return reinterpret_cast<System_String * (UNITY_CALLING_CONVENTION)(int)>(
+                m_SceneFunctions.m_GetName)(s.m_Handle);
+        }
+
+        // Scene is a value type, so the managed instance method takes a pointer to it.
+        // Throws (managed) if the scene is not loaded.
+        inline il2cppArray<CGameObject*>* GetRootGameObjects(Scene s)
+        {
+            if (!m_SceneFunctions.m_GetRootGameObjects)
+                return nullptr;
+
+            return reinterpret_cast<il2cppArray<CGameObject*>*(UNITY_CALLING_CONVENTION)(Scene*)>(
+                m_SceneFunctions.m_GetRootGameObjects)(&s);
+        }
+
         inline void MoveGameObjectToScene(CGameObject* go, Scene scene)
         {
             if (!m_SceneManagerFunctions.m_MoveGameObjectToScene || !go)
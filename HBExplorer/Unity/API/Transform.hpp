@@ -23,6 +23,10 @@ namespace Unity
 		void* m_GetLocalScale_Injected = nullptr; bool m_GetLocalScale_ThisIsPtr = false;
 		void* m_GetLocalScale_Value = nullptr; bool m_GetLocalScaleValue_ThisIsPtr = false;
 
+		// Optional: combined world position + rotation (2021.3+) and world scale
+		void* m_GetPositionAndRotation = nullptr; bool m_GetPositionAndRotation_ThisIsPtr = false;
+		void* m_GetLossyScale_Injected = nullptr; bool m_GetLossyScale_ThisIsPtr = false;
+
 		// Setters: support injected(ref) and by-value
 		void* m_SetPosition_Injected = nullptr; bool m_SetPosition_ThisIsPtr = false;
 		void* m_SetPosition_Value = nullptr; bool m_SetPositionValue_ThisIsPtr = false;
@@ -199,6 +203,50 @@ namespace Unity
 			return {};
 		}
 
+		// One native call where the runtime has it, two getter calls otherwise.
+		// False (outputs untouched) when the native object is gone or no getter resolved.
+		bool GetPositionAndRotation(Vector3& m_vPosition, Quaternion& m_qRotation)
+		{
+			if (!this || !this->m_CachedPtr)
+				return false;
+
+			if (m_TransformFunctions.m_GetPositionAndRotation)
+			{
+				void* selfArg = m_TransformFunctions.m_GetPositionAndRotation_ThisIsPtr ? this->m_CachedPtr : (void*)this;
+				reinterpret_cast<void(UNITY_CALLING_CONVENTION)(void*, Vector3&, Quaternion&)>(m_TransformFunctions.m_GetPositionAndRotation)(selfArg, m_vPosition, m_qRotation);
+				return true;
+			}
+
+			if (!(m_TransformFunctions.m_GetPosition_Injected || m_TransformFunctions.m_GetPosition_Value) ||
+				!(m_TransformFunctions.m_GetRotation_Injected || m_TransformFunctions.m_GetRotation_Value))
+				return false;
+
+			m_vPosition = GetPosition();
+			m_qRotation = GetRotation();
+			return true;
+		}
+
+		// World scale; falls back to the local scale when lossyScale is unavailable.
+		// False (output untouched) when the native object is gone or no getter resolved.
+		bool GetLossyScale(Vector3& m_vScale)
+		{
+			if (!this || !this->m_CachedPtr)
+				return false;
+
+			if (m_TransformFunctions.m_GetLossyScale_Injected)
+			{
+				void* selfArg = m_TransformFunctions.m_GetLossyScale_ThisIsPtr ? this->m_CachedPtr : (void*)this;
+				reinterpret_cast<void(UNITY_CALLING_CONVENTION)(void*, Vector3&)>(m_TransformFunctions.m_GetLossyScale_Injected)(selfArg, m_vScale);
+				return true;
+			}
+
+			if (!m_TransformFunctions.m_GetLocalScale_Injected && !m_TransformFunctions.m_GetLocalScale_Value)
+				return false;
+
+			m_vScale = GetLocalScale();
+			return true;
+		}
+
 		void SetPosition(Vector3 m_vVector)
 		{
 			if (!this)
@@ -390,6 +438,18 @@ namespace Unity
 				{ IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::get_localScale_Injected(System.IntPtr,UnityEngine.Vector3&)"),
 				  IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::get_localScale_Injected(System.IntPtr,UnityEngine.Vector3)") });
 
+			resolveInstanceObjOrPtr(m_TransformFunctions.m_GetPositionAndRotation, m_TransformFunctions.m_GetPositionAndRotation_ThisIsPtr,
+				"GetPositionAndRotation", 2,
+				"GetPositionAndRotation_Injected", 3,
+				{ UNITY_TRANSFORM_GETPOSITIONANDROTATION },
+				{ IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::GetPositionAndRotation_Injected(System.IntPtr,UnityEngine.Vector3&,UnityEngine.Quaternion&)") });
+
+			resolveInstanceObjOrPtr(m_TransformFunctions.m_GetLossyScale_Injected, m_TransformFunctions.m_GetLossyScale_ThisIsPtr,
+				"get_lossyScale_Injected", 1,
+				"get_lossyScale_Injected", 2,
+				{ UNITY_TRANSFORM_GETLOSSYSCALE },
+				{ IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::get_lossyScale_Injected(System.IntPtr,UnityEngine.Vector3&)") });
+
 			// Value-return fallbacks (rarely needed; included for completeness)
 			resolveInstanceObjOrPtr(m_TransformFunctions.m_GetPosition_Value, m_TransformFunctions.m_GetPositionValue_ThisIsPtr,
 				"get_position", 0,
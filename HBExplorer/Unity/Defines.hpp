@@ -16,6 +16,8 @@
 #define UNITY_CAMERA_GETFIELDOFVIEW                                 IL2CPP_RStr(UNITY_CAMERA_CLASS"::get_fieldOfView")
 #define UNITY_CAMERA_SETFIELDOFVIEW                                 IL2CPP_RStr(UNITY_CAMERA_CLASS"::set_fieldOfView")
 #define UNITY_CAMERA_WORLDTOSCREEN                                  IL2CPP_RStr(UNITY_CAMERA_CLASS"::WorldToScreenPoint_Injected")
+#define UNITY_CAMERA_GETWORLDTOCAMERAMATRIX                         IL2CPP_RStr(UNITY_CAMERA_CLASS"::get_worldToCameraMatrix_Injected")
+#define UNITY_CAMERA_GETPROJECTIONMATRIX                            IL2CPP_RStr(UNITY_CAMERA_CLASS"::get_projectionMatrix_Injected")
 
 // Component
 #define UNITY_COMPONENT_CLASS										"UnityEngine.Component"
@@ -52,6 +54,11 @@
 #define UNITY_OBJECT_CLASS											"UnityEngine.Object"
 
 #define UNITY_OBJECT_DESTROY										IL2CPP_RStr(UNITY_OBJECT_CLASS"::Destroy")
+#define UNITY_OBJECT_DESTROYIMMEDIATE								IL2CPP_RStr(UNITY_OBJECT_CLASS"::DestroyImmediate")
+#define UNITY_OBJECT_CLONESINGLE									IL2CPP_RStr(UNITY_OBJECT_CLASS"::Internal_CloneSingle")
+#define UNITY_OBJECT_CLONESINGLEWITHPARENT							IL2CPP_RStr(UNITY_OBJECT_CLASS"::Internal_CloneSingleWithParent")
+#define UNITY_OBJECT_INSTANTIATESINGLE								IL2CPP_RStr(UNITY_OBJECT_CLASS"::Internal_InstantiateSingle_Injected")
+#define UNITY_OBJECT_INSTANTIATESINGLEWITHPARENT					IL2CPP_RStr(UNITY_OBJECT_CLASS"::Internal_InstantiateSingleWithParent_Injected")
 #define UNITY_OBJECT_FINDOBJECTSOFTYPE								IL2CPP_RStr(UNITY_OBJECT_CLASS"::FindObjectsOfType(System.Type,System.Boolean)")
 #define UNITY_OBJECT_GETNAME										IL2CPP_RStr(UNITY_OBJECT_CLASS"::GetName")
 
@@ -75,6 +82,8 @@
 #define UNITY_TRANSFORM_GETROTATION									IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::get_rotation_Injected")
 #define UNITY_TRANSFORM_GETLOCALPOSITION							IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::get_localPosition_Injected")
 #define UNITY_TRANSFORM_GETLOCALSCALE								IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::get_localScale_Injected")
+#define UNITY_TRANSFORM_GETLOSSYSCALE								IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::get_lossyScale_Injected")
+#define UNITY_TRANSFORM_GETPOSITIONANDROTATION						IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::GetPositionAndRotation(UnityEngine.Vector3&,UnityEngine.Quaternion&)")
 #define UNITY_TRANSFORM_SETPOSITION									IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::set_position_Injected")
 #define UNITY_TRANSFORM_SETROTATION									IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::set_rotation_Injected")
 #define UNITY_TRANSFORM_SETLOCALPOSITION							IL2CPP_RStr(UNITY_TRANSFORM_CLASS"::set_localPosition_Injected")
@@ -148,6 +157,8 @@
 #define UNITY_SM_MERGESCENES                                        IL2CPP_RStr(UNITY_SCENEMANAGER_CLASS"::MergeScenes")
 #define UNITY_SM_MOVEGAMEOBJECTTOSCENE                              IL2CPP_RStr(UNITY_SCENEMANAGER_CLASS"::MoveGameObjectToScene")
 
+#define UNITY_SCENE_GETNAME                                         IL2CPP_RStr(UNITY_SCENE_CLASS"::GetNameInternal")
+
 // Debug
 #define UNITY_DEBUG_CLASS                                           "UnityEngine.Debug"
 
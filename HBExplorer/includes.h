@@ -10,7 +10,9 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cctype>
+#include <chrono>
 #include <cstdarg>
 #include <cstdlib>
 #include <cstdio>
@@ -18,8 +20,10 @@
 #include <deque>
 #include <fstream>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
@@ -45,4 +49,23 @@ namespace HBLog
 	void Clear();
 }
 
+#include "Explorer/AttributeIndex.hpp"
+#include "Explorer/ChangeQueue.hpp"
+#include "Explorer/ChurnProfiler.hpp"
+#include "Explorer/HierarchyLayout.hpp"
+#include "Explorer/InstanceCollector.hpp"
+#include "Explorer/NameIndex.hpp"
+#include "Explorer/ObjectPath.hpp"
+#include "Explorer/ObjectQuery.hpp"
+#include "Explorer/ParallelFor.hpp"
+#include "Explorer/ReferenceGraph.hpp"
+#include "Explorer/ReverseReferenceIndex.hpp"
+#include "Explorer/SiblingGroups.hpp"
+#include "Explorer/SnapshotDiff.hpp"
+#include "Explorer/SpatialGrid.hpp"
+#include "Explorer/TransformCapture.hpp"
+#include "Explorer/TypeIndex.hpp"
+#include "Explorer/ValueScanner.hpp"
+#include "Explorer/WatchSampler.hpp"
+#include "Explorer/WeakHandleTable.hpp"
 #include "UExplorer.hpp"
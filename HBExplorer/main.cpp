@@ -18,6 +18,9 @@ bool g_MinHookInitialized = false;
 bool g_UnityLogHooksInstalled = false;
 bool g_UnityLogHooksDisabledForCompatibility = false;
 bool g_UnityLogHookDecisionMade = false;
+bool g_SceneChangeHooksInstalled = false;
+bool g_WatchUpdateHookInstalled = false;
+bool g_WatchUpdateHookRequested = false;
 POINT g_VirtualCursorPos{ 0, 0 };
 bool g_VirtualCursorInitialized = false;
 LONG g_RawMouseDeltaX = 0;
@@ -39,6 +42,38 @@ UnityDebugLogAny_t oUnityDebugLog = nullptr;
 UnityDebugLogAny_t oUnityDebugLogWarning = nullptr;
 UnityDebugLogAny_t oUnityDebugLogError = nullptr;
 
+// Scene structs are a single int handle and are passed by value like one.
+#ifdef _WIN64
+using SceneLoaded_t = void(__fastcall*)(int, int, void*);
+using SceneUnloaded_t = void(__fastcall*)(int, void*);
+using ActiveSceneChanged_t = void(__fastcall*)(int, int, void*);
+using CloneSingle_t = void*(__fastcall*)(void*);
+using CloneSingleWithParent_t = void*(__fastcall*)(void*, void*, bool);
+using InstantiateSingle_t = void*(__fastcall*)(void*, void*, void*);
+using InstantiateSingleWithParent_t = void*(__fastcall*)(void*, void*, void*, void*);
+using ObjectDestroy_t = void(__fastcall*)(void*, float);
+using ObjectDestroyImmediate_t = void(__fastcall*)(void*, bool);
+#else
+using SceneLoaded_t = void(__cdecl*)(int, int, void*);
+using SceneUnloaded_t = void(__cdecl*)(int, void*);
+using ActiveSceneChanged_t = void(__cdecl*)(int, int, void*);
+using CloneSingle_t = void*(__cdecl*)(void*);
+using CloneSingleWithParent_t = void*(__cdecl*)(void*, void*, bool);
+using InstantiateSingle_t = void*(__cdecl*)(void*, void*, void*);
+using InstantiateSingleWithParent_t = void*(__cdecl*)(void*, void*, void*, void*);
+using ObjectDestroy_t = void(__cdecl*)(void*, float);
+using ObjectDestroyImmediate_t = void(__cdecl*)(void*, bool);
+#endif
+SceneLoaded_t oSceneLoaded = nullptr;
+SceneUnloaded_t oSceneUnloaded = nullptr;
+ActiveSceneChanged_t oActiveSceneChanged = nullptr;
+CloneSingle_t oCloneSingle = nullptr;
+CloneSingleWithParent_t oCloneSingleWithParent = nullptr;
+InstantiateSingle_t oInstantiateSingle = nullptr;
+InstantiateSingleWithParent_t oInstantiateSingleWithParent = nullptr;
+ObjectDestroy_t oObjectDestroy = nullptr;
+ObjectDestroyImmediate_t oObjectDestroyImmediate = nullptr;
+
 namespace HBLog
 {
 	namespace
@@ -346,6 +381,106 @@ void __cdecl hkUnityDebugLogError(void* value)
 		oUnityDebugLogError(value);
 }
 
+// Change hooks only enqueue an event; the explorer coalesces and refreshes on the render thread.
+#ifdef _WIN64
+void __fastcall hkSceneLoaded(int scene, int mode, void* method)
+#else
+void __cdecl hkSceneLoaded(int scene, int mode, void* method)
+#endif
+{
+	if (oSceneLoaded)
+		oSceneLoaded(scene, mode, method);
+	UExplorer::PostChangeEvent(UExplorer::ChangeEventKind::SceneLoaded, scene, nullptr);
+}
+
+#ifdef _WIN64
+void __fastcall hkSceneUnloaded(int scene, void* method)
+#else
+void __cdecl hkSceneUnloaded(int scene, void* method)
+#endif
+{
+	if (oSceneUnloaded)
+		oSceneUnloaded(scene, method);
+	UExplorer::PostChangeEvent(UExplorer::ChangeEventKind::SceneUnloaded, scene, nullptr);
+}
+
+#ifdef _WIN64
+void __fastcall hkActiveSceneChanged(int previous, int next, void* method)
+#else
+void __cdecl hkActiveSceneChanged(int previous, int next, void* method)
+#endif
+{
+	if (oActiveSceneChanged)
+		oActiveSceneChanged(previous, next, method);
+	UExplorer::PostChangeEvent(UExplorer::ChangeEventKind::ActiveSceneChanged, next, nullptr);
+}
+
+#ifdef _WIN64
+void* __fastcall hkCloneSingle(void* original)
+#else
+void* __cdecl hkCloneSingle(void* original)
+#endif
+{
+	void* clone = oCloneSingle ? oCloneSingle(original) : nullptr;
+	UExplorer::PostChangeEvent(UExplorer::ChangeEventKind::ObjectInstantiated, 0, clone);
+	return clone;
+}
+
+#ifdef _WIN64
+void* __fastcall hkCloneSingleWithParent(void* original, void* parent, bool worldPositionStays)
+#else
+void* __cdecl hkCloneSingleWithParent(void* original, void* parent, bool worldPositionStays)
+#endif
+{
+	void* clone = oCloneSingleWithParent ? oCloneSingleWithParent(original, parent, worldPositionStays) : nullptr;
+	UExplorer::PostChangeEvent(UExplorer::ChangeEventKind::ObjectInstantiated, 0, clone);
+	return clone;
+}
+
+#ifdef _WIN64
+void* __fastcall hkInstantiateSingle(void* original, void* position, void* rotation)
+#else
+void* __cdecl hkInstantiateSingle(void* original, void* position, void* rotation)
+#endif
+{
+	void* clone = oInstantiateSingle ? oInstantiateSingle(original, position, rotation) : nullptr;
+	UExplorer::PostChangeEvent(UExplorer::ChangeEventKind::ObjectInstantiated, 0, clone);
+	return clone;
+}
+
+#ifdef _WIN64
+void* __fastcall hkInstantiateSingleWithParent(void* original, void* parent, void* position, void* rotation)
+#else
+void* __cdecl hkInstantiateSingleWithParent(void* original, void* parent, void* position, void* rotation)
+#endif
+{
+	void* clone = oInstantiateSingleWithParent ? oInstantiateSingleWithParent(original, parent, position, rotation) : nullptr;
+	UExplorer::PostChangeEvent(UExplorer::ChangeEventKind::ObjectInstantiated, 0, clone);
+	return clone;
+}
+
+#ifdef _WIN64
+void __fastcall hkObjectDestroy(void* object, float delay)
+#else
+void __cdecl hkObjectDestroy(void* object, float delay)
+#endif
+{
+	UExplorer::PostChangeEvent(UExplorer::ChangeEventKind::ObjectDestroyed, 0, object);
+	if (oObjectDestroy)
+		oObjectDestroy(object, delay);
+}
+
+#ifdef _WIN64
+void __fastcall hkObjectDestroyImmediate(void* object, bool allowDestroyingAssets)
+#else
+void __cdecl hkObjectDestroyImmediate(void* object, bool allowDestroyingAssets)
+#endif
+{
+	UExplorer::PostChangeEvent(UExplorer::ChangeEventKind::ObjectDestroyed, 0, object);
+	if (oObjectDestroyImmediate)
+		oObjectDestroyImmediate(object, allowDestroyingAssets);
+}
+
 static bool CreateAndEnableRawHook(void* target, void* detour, void** original, const char* tag)
 {
 	if (!target || !detour)
@@ -447,6 +582,116 @@ void InitUnityLogHooks()
 		okErr ? "OK" : "FAIL");
 }
 
+void InitSceneChangeHooks()
+{
+	if (g_SceneChangeHooksInstalled)
+		return;
+
+	bool envDisable = false;
+	if (TryReadBoolEnv("HBEXPLORER_DISABLE_CHANGE_HOOKS", &envDisable) && envDisable)
+	{
+		static bool s_DisableLogged = false;
+		if (!s_DisableLogged)
+		{
+			s_DisableLogged = true;
+			HBLog::Printf("[Core] Scene change hooks disabled by HBEXPLORER_DISABLE_CHANGE_HOOKS.\n");
+		}
+		return;
+	}
+
+	if (!IL2CPP::Functions.m_ResolveFunction || !IL2CPP::Domain::Get())
+		return;
+
+	MH_STATUS initStatus = MH_Initialize();
+	if (initStatus != MH_OK && initStatus != MH_ERROR_ALREADY_INITIALIZED)
+	{
+		HBLog::Printf("[Core] MinHook init failed for scene change hooks: %s\n", MH_StatusToString(initStatus));
+		return;
+	}
+
+	g_MinHookInitialized = true;
+
+	// The managed dispatchers fire for every load/unload, including additive and async loads.
+	void* pSceneLoaded = IL2CPP::ResolveUnityMethod(UNITY_SCENEMANAGER_CLASS, "Internal_SceneLoaded", 2);
+	void* pSceneUnloaded = IL2CPP::ResolveUnityMethod(UNITY_SCENEMANAGER_CLASS, "Internal_SceneUnloaded", 1);
+	void* pActiveSceneChanged = IL2CPP::ResolveUnityMethod(UNITY_SCENEMANAGER_CLASS, "Internal_ActiveSceneChanged", 2);
+
+	// Every Object.Instantiate overload funnels into one of these icalls.
+	void* pClone = IL2CPP::ResolveCall(UNITY_OBJECT_CLONESINGLE);
+	void* pCloneParent = IL2CPP::ResolveCall(UNITY_OBJECT_CLONESINGLEWITHPARENT);
+	void* pInstantiate = IL2CPP::ResolveCall(UNITY_OBJECT_INSTANTIATESINGLE);
+	void* pInstantiateParent = IL2CPP::ResolveCall(UNITY_OBJECT_INSTANTIATESINGLEWITHPARENT);
+	void* pDestroy = IL2CPP::ResolveCall(UNITY_OBJECT_DESTROY);
+	void* pDestroyImmediate = IL2CPP::ResolveCall(UNITY_OBJECT_DESTROYIMMEDIATE);
+
+	const bool okLoaded = CreateAndEnableRawHook(pSceneLoaded, reinterpret_cast<void*>(hkSceneLoaded), reinterpret_cast<void**>(&oSceneLoaded), "SceneManager.Internal_SceneLoaded");
+	const bool okUnloaded = CreateAndEnableRawHook(pSceneUnloaded, reinterpret_cast<void*>(hkSceneUnloaded), reinterpret_cast<void**>(&oSceneUnloaded), "SceneManager.Internal_SceneUnloaded");
+	const bool okActive = CreateAndEnableRawHook(pActiveSceneChanged, reinterpret_cast<void*>(hkActiveSceneChanged), reinterpret_cast<void**>(&oActiveSceneChanged), "SceneManager.Internal_ActiveSceneChanged");
+	const bool okClone = CreateAndEnableRawHook(pClone, reinterpret_cast<void*>(hkCloneSingle), reinterpret_cast<void**>(&oCloneSingle), "Object.Internal_CloneSingle");
+	const bool okCloneParent = CreateAndEnableRawHook(pCloneParent, reinterpret_cast<void*>(hkCloneSingleWithParent), reinterpret_cast<void**>(&oCloneSingleWithParent), "Object.Internal_CloneSingleWithParent");
+	const bool okInstantiate = CreateAndEnableRawHook(pInstantiate, reinterpret_cast<void*>(hkInstantiateSingle), reinterpret_cast<void**>(&oInstantiateSingle), "Object.Internal_InstantiateSingle");
+	const bool okInstantiateParent = CreateAndEnableRawHook(pInstantiateParent, reinterpret_cast<void*>(hkInstantiateSingleWithParent), reinterpret_cast<void**>(&oInstantiateSingleWithParent), "Object.Internal_InstantiateSingleWithParent");
+	const bool okDestroy = CreateAndEnableRawHook(pDestroy, reinterpret_cast<void*>(hkObjectDestroy), reinterpret_cast<void**>(&oObjectDestroy), "Object.Destroy");
+	const bool okDestroyImmediate = CreateAndEnableRawHook(pDestroyImmediate, reinterpret_cast<void*>(hkObjectDestroyImmediate), reinterpret_cast<void**>(&oObjectDestroyImmediate), "Object.DestroyImmediate");
+
+	const bool okScenes = okLoaded && okUnloaded;
+	const bool okSpawn = okClone || okCloneParent || okInstantiate || okInstantiateParent;
+	const bool okDespawn = okDestroy || okDestroyImmediate;
+
+	// Polling stays the primary source unless every class of change is covered.
+	g_SceneChangeHooksInstalled = okLoaded || okUnloaded || okActive || okSpawn || okDespawn;
+	UExplorer::SetChangeHooksActive(okScenes && okSpawn && okDespawn);
+	HBLog::Printf("[Core] Scene change hooks: Scenes=%s ActiveScene=%s Instantiate=%s Destroy=%s\n",
+		okScenes ? "OK" : "FAIL",
+		okActive ? "OK" : "FAIL",
+		okSpawn ? "OK" : "FAIL",
+		okDespawn ? "OK" : "FAIL");
+}
+
+void InitWatchUpdateHook()
+{
+	// Shares the switch with the scene hooks: both patch game code, and Present sampling covers
+	// watches without it.
+	bool envDisable = false;
+	if (TryReadBoolEnv("HBEXPLORER_DISABLE_CHANGE_HOOKS", &envDisable) && envDisable)
+	{
+		HBLog::Printf("[Core] OnUpdate hook disabled by HBEXPLORER_DISABLE_CHANGE_HOOKS (sampling from Present).\n");
+		return;
+	}
+
+	// Register before the vtable patch so the callback list never changes under the game thread.
+	// Callback::Initialize attaches and detaches its calling thread, so this must stay off the
+	// render thread.
+	IL2CPP::Callback::OnUpdate::Add(reinterpret_cast<void*>(UExplorer::SampleWatchesOnUpdate));
+	IL2CPP::Callback::Initialize();
+
+	g_WatchUpdateHookInstalled = IL2CPP::Callback::OnUpdate::m_CallbackHook.m_VFunc
+		&& IL2CPP::Callback::OnUpdate::m_CallbackHook.m_Original;
+	UExplorer::SetWatchUpdateHookActive(g_WatchUpdateHookInstalled);
+	HBLog::Printf("[Core] OnUpdate hook for watch sampling: %s\n", g_WatchUpdateHookInstalled ? "OK" : "FAIL (sampling from Present)");
+}
+
+DWORD WINAPI WatchUpdateHookThread(LPVOID)
+{
+	InitWatchUpdateHook();
+	return 0;
+}
+
+// The update hook only matters once something is watched, so it is installed on the first watch
+// rather than at startup; until it is up (or if it never is) Present samples.
+void RequestWatchUpdateHook()
+{
+	if (g_WatchUpdateHookRequested || !UExplorer::WantsWatchUpdateHook())
+		return;
+
+	g_WatchUpdateHookRequested = true;
+	HANDLE thread = CreateThread(nullptr, 0, WatchUpdateHookThread, nullptr, 0, nullptr);
+	if (thread)
+		CloseHandle(thread);
+	else
+		HBLog::Printf("[Core] OnUpdate hook thread failed to start (sampling from Present).\n");
+}
+
 BOOL WINAPI hkSetCursorPos(int X, int Y)
 {
 	if (g_ShowExplorer)
@@ -1023,8 +1268,11 @@ HRESULT __stdcall hkPresent(IDXGISwapChain* pSwapChain, UINT SyncInterval, UINT
 	else
 	{
 		g_MenuCursorOverrideLogged = false;
+		if (g_RenderIl2CppThread)
+			UExplorer::TickWhileHidden();
 	}
 
+	RequestWatchUpdateHook();
 	DrawInjectionToast();
 
 	ImGui::Render();
@@ -1058,8 +1306,9 @@ DWORD WINAPI MainThread(LPVOID lpReserved)
 
 			EvaluateUnityLogHookCompatibility();
 			InitUnityLogHooks();
+			InitSceneChangeHooks();
 
-			HBLog::Printf("[Core] Input update is handled in hkPresent (no IL2CPP callback hook).\n");
+			HBLog::Printf("[Core] Input update is handled in hkPresent.\n");
 			init_hook = true;
 		}
 		else
@@ -1082,6 +1331,11 @@ BOOL WINAPI DllMain(HMODULE hMod, DWORD dwReason, LPVOID lpReserved)
 		break;
 	case DLL_PROCESS_DETACH:
 		kiero::shutdown();
+		if (g_WatchUpdateHookInstalled)
+		{
+			IL2CPP::Callback::Uninitialize();
+			g_WatchUpdateHookInstalled = false;
+		}
 		if (g_MinHookInitialized)
 		{
 			MH_DisableHook(MH_ALL_HOOKS);
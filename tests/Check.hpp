@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdio>
+
+// Minimal assertion helpers for the portable Explorer headers; failures are counted so one
+// run reports all of them.
+static int g_CheckFailures = 0;
+
+#define CHECK(condition)                                                                  \
+    do                                                                                    \
+    {                                                                                     \
+        if (!(condition))                                                                 \
+        {                                                                                 \
+            std::printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);    \
+            ++g_CheckFailures;                                                            \
+        }                                                                                 \
+    } while (0)
+
+static int FinishChecks(const char* name)
+{
+    if (g_CheckFailures == 0)
+        std::printf("%s: ok\n", name);
+    else
+        std::printf("%s: %d failure(s)\n", name, g_CheckFailures);
+    return g_CheckFailures == 0 ? 0 : 1;
+}
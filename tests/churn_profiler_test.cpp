@@ -0,0 +1,116 @@
+#include "ChurnProfiler.hpp"
+#include "Check.hpp"
+
+using namespace UExplorer;
+
+static void TestRatesOverWindow()
+{
+    // Series pointers are only good until the next Acquire of a new key.
+    ChurnProfiler profiler;
+    CHECK(profiler.Acquire(1) != nullptr);
+    CHECK(profiler.Acquire(2) != nullptr);
+    ChurnProfiler::Series* bullets = profiler.Acquire(1);
+    ChurnProfiler::Series* sparks = profiler.Acquire(2);
+    CHECK(bullets == &profiler.At(0) && sparks == &profiler.At(1));
+
+    // A 1000 ms window ending at 10249 covers buckets 37..40, i.e. ticks 9250..10249.
+    for (uint64_t tick = 9250; tick < 10250; tick += 50)
+        profiler.Record(*bullets, true, tick);
+    profiler.Record(*sparks, true, 10000);
+    profiler.Record(*sparks, false, 10100);
+
+    std::vector<ChurnProfiler::Rate> rates;
+    profiler.TopChurners(10249, 1000, 8, &rates);
+    CHECK(rates.size() == 2);
+    CHECK(rates[0].series == 0);
+    CHECK(rates[0].createdPerSecond > 19.9f && rates[0].createdPerSecond < 20.1f);
+    CHECK(rates[0].destroyedPerSecond == 0.0f);
+    CHECK(rates[1].series == 1);
+    CHECK(rates[1].createdPerSecond == rates[1].destroyedPerSecond);
+
+    profiler.TopChurners(10249, 1000, 1, &rates);
+    CHECK(rates.size() == 1 && rates[0].series == 0);
+
+    // Nothing recorded in the last second of a window that ends much later.
+    profiler.TopChurners(20000, 1000, 8, &rates);
+    CHECK(rates.empty());
+}
+
+static void TestRingWrapsAndForgets()
+{
+    ChurnProfiler profiler;
+    ChurnProfiler::Series& series = *profiler.Acquire(7);
+    const uint64_t span = static_cast<uint64_t>(ChurnProfiler::kBucketMs) * ChurnProfiler::kBucketCount;
+
+    profiler.Record(series, true, 1000);
+    profiler.Record(series, true, 1000 + span); // same slot, one full ring later
+    CHECK(series.totalCreated == 2);
+
+    float history[ChurnProfiler::kBucketCount]{};
+    profiler.CopyHistory(series, 1000 + span, true, history);
+    float sum = 0.0f;
+    for (float value : history)
+        sum += value;
+    CHECK(sum == 1.0f); // the stale count in the reused slot was zeroed
+    CHECK(history[ChurnProfiler::kBucketCount - 1U] == 1.0f);
+
+    // Older than the ring: totals only.
+    profiler.Record(series, false, 500);
+    CHECK(series.totalDestroyed == 1);
+    profiler.CopyHistory(series, 1000 + span, false, history);
+    for (float value : history)
+        CHECK(value == 0.0f);
+
+    // Out-of-order but inside the ring lands in its own bucket.
+    profiler.Record(series, false, 1000 + span - 2U * ChurnProfiler::kBucketMs);
+    profiler.CopyHistory(series, 1000 + span, false, history);
+    CHECK(history[ChurnProfiler::kBucketCount - 3U] == 1.0f);
+}
+
+static void TestSeriesLimit()
+{
+    ChurnProfiler profiler;
+    for (uint64_t key = 0; key < ChurnProfiler::kMaxSeries; ++key)
+        CHECK(profiler.Acquire(key) != nullptr);
+
+    CHECK(profiler.Acquire(ChurnProfiler::kMaxSeries) == nullptr);
+    CHECK(profiler.Acquire(3) != nullptr);
+    CHECK(profiler.OverflowCount() == 1);
+
+    profiler.Clear();
+    CHECK(profiler.Size() == 0 && profiler.OverflowCount() == 0);
+}
+
+static void TestSpawnAttribution()
+{
+    SpawnAttributionTable table(4);
+    table.Remember(0x1000, { 11, 21 });
+    table.Remember(0x2000, { 12, 22 });
+    table.Remember(0x1000, { 13, 23 }); // a reused address overwrites
+
+    ChurnAttribution attribution{};
+    CHECK(table.Take(0x1000, &attribution));
+    CHECK(attribution.stemHash == 13 && attribution.signature == 23);
+    CHECK(!table.Take(0x1000, &attribution)); // a destroy is attributed once
+    CHECK(!table.Take(0x3000, &attribution));
+
+    // Filling past capacity starts over; what was forgotten is counted.
+    for (uintptr_t subject = 0x10; subject < 0x14; ++subject)
+        table.Remember(subject, { subject, subject });
+    CHECK(table.Size() == 1);
+    CHECK(table.ForgottenCount() == 4);
+    CHECK(!table.Take(0x2000, &attribution));
+    CHECK(table.Take(0x13, &attribution) && attribution.stemHash == 0x13);
+
+    table.Clear();
+    CHECK(table.Size() == 0 && table.ForgottenCount() == 0);
+}
+
+int main()
+{
+    TestRatesOverWindow();
+    TestRingWrapsAndForgets();
+    TestSeriesLimit();
+    TestSpawnAttribution();
+    return FinishChecks("churn_profiler_test");
+}
@@ -0,0 +1,84 @@
+#include "InstanceCollector.hpp"
+#include "Check.hpp"
+
+#include <vector>
+
+using namespace UExplorer;
+
+namespace
+{
+    // Stands in for VirtualAlloc(MEM_COMMIT): records how far the arena committed.
+    size_t g_Committed = 0;
+    bool g_CommitFails = false;
+
+    bool CountCommit(void*, size_t bytes)
+    {
+        if (g_CommitFails)
+            return false;
+        g_Committed += bytes;
+        return true;
+    }
+}
+
+static void TestArenaGrowsNewestBlockInPlace()
+{
+    std::vector<uint8_t> storage(4U << 20);
+    g_Committed = 0;
+    LivenessArena arena;
+    arena.Attach(storage.data(), storage.size(), CountCommit);
+
+    // The liveness walk grows one array at a time, doubling it.
+    uint8_t* block = static_cast<uint8_t*>(arena.Reallocate(nullptr, 64));
+    CHECK(block != nullptr);
+    for (int i = 0; i < 64; ++i)
+        block[i] = static_cast<uint8_t>(i);
+
+    for (size_t size = 128; size <= (1U << 20); size *= 2)
+        CHECK(arena.Reallocate(block, size) == block);
+    CHECK(block[63] == 63);
+    CHECK(arena.Committed() == g_Committed);
+    CHECK(arena.Committed() >= (1U << 20) && arena.Committed() % LivenessArena::kCommitStep == 0);
+
+    // An older block moves and keeps its bytes.
+    uint8_t* other = static_cast<uint8_t*>(arena.Reallocate(nullptr, 32));
+    CHECK(other != nullptr && other > block);
+    uint8_t* moved = static_cast<uint8_t*>(arena.Reallocate(block, (1U << 20) + 16));
+    CHECK(moved != nullptr && moved != block);
+    CHECK(moved[0] == 0 && moved[63] == 63);
+    CHECK(reinterpret_cast<uintptr_t>(moved) % LivenessArena::kAlign == 0);
+
+    // Freeing the newest block hands its space back.
+    const size_t peak = arena.Peak();
+    CHECK(arena.Reallocate(moved, 0) == nullptr);
+    CHECK(arena.Reallocate(nullptr, 16) == moved);
+    CHECK(arena.Peak() == peak);
+}
+
+static void TestArenaExhaustion()
+{
+    std::vector<uint8_t> storage(1U << 16);
+    g_Committed = 0;
+    LivenessArena arena;
+    arena.Attach(storage.data(), storage.size(), CountCommit);
+
+    CHECK(arena.Reallocate(nullptr, storage.size()) == nullptr);
+    void* block = arena.Reallocate(nullptr, 1024);
+    CHECK(block != nullptr);
+    CHECK(arena.Reallocate(block, storage.size()) == nullptr);
+    CHECK(arena.Committed() == storage.size()); // the last step is capped at the reservation
+
+    // A failed commit fails the call instead of handing out uncommitted pages.
+    std::vector<uint8_t> larger(4U << 20);
+    arena.Attach(larger.data(), larger.size(), CountCommit);
+    g_CommitFails = true;
+    CHECK(arena.Reallocate(nullptr, 1024) == nullptr);
+    g_CommitFails = false;
+    CHECK(arena.Reallocate(nullptr, 1024) != nullptr);
+}
+
+int main()
+{
+    TestArenaGrowsNewestBlockInPlace();
+    TestArenaExhaustion();
+    return FinishChecks("instance_collector_test");
+}
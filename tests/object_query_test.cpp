@@ -0,0 +1,184 @@
+#include "ObjectQuery.hpp"
+#include "Check.hpp"
+
+using namespace UExplorer;
+
+static std::vector<QueryPredicate> Parse(const char* text, bool expectOk = true)
+{
+    std::vector<QueryPredicate> predicates;
+    std::string error;
+    const bool ok = ParseObjectQuery(text, &predicates, &error);
+    if (ok != expectOk)
+        std::printf("  parse \"%s\": %s\n", text, ok ? "unexpectedly ok" : error.c_str());
+    CHECK(ok == expectOk);
+    CHECK(ok == error.empty());
+    return predicates;
+}
+
+static void TestTokenizer()
+{
+    std::vector<std::string> tokens;
+    TokenizeQuery("  enemy  \"big boss\"\tn:\"a b\"* ", &tokens);
+    CHECK(tokens.size() == 3);
+    CHECK(tokens[0] == "enemy");
+    CHECK(tokens[1] == "big boss");
+    CHECK(tokens[2] == "n:a b*");
+
+    TokenizeQuery("\"\"", &tokens);
+    CHECK(tokens.size() == 1 && tokens[0].empty());
+}
+
+static void TestNamesAndNegation()
+{
+    std::vector<QueryPredicate> predicates = Parse("Enemy -Dead !boss en*y");
+    CHECK(predicates.size() == 4);
+    CHECK(predicates[0].kind == QueryPredicateKind::Name && predicates[0].text == "enemy" && !predicates[0].negate);
+    CHECK(predicates[1].kind == QueryPredicateKind::Name && predicates[1].text == "dead" && predicates[1].negate);
+    CHECK(predicates[2].negate && predicates[2].text == "boss");
+    CHECK(predicates[3].kind == QueryPredicateKind::NameGlob && predicates[3].text == "en*y");
+
+    // A lone '-' is a name, not a negation of nothing.
+    predicates = Parse("-");
+    CHECK(predicates.size() == 1 && predicates[0].text == "-" && !predicates[0].negate);
+}
+
+static void TestUnknownKeysAreNames()
+{
+    std::vector<QueryPredicate> predicates = Parse("Door:Left hp<3 Lod=2 x:y:z");
+    CHECK(predicates.size() == 4);
+    for (const QueryPredicate& predicate : predicates)
+        CHECK(predicate.kind == QueryPredicateKind::Name);
+    CHECK(predicates[0].text == "door:left");
+    CHECK(predicates[1].text == "hp<3");
+    CHECK(predicates[3].text == "x:y:z");
+
+    // A known key keeps its meaning whatever the case.
+    predicates = Parse("Name:Door:Left");
+    CHECK(predicates.size() == 1 && predicates[0].kind == QueryPredicateKind::Name && predicates[0].text == "door:left");
+}
+
+static void TestKeys()
+{
+    std::vector<QueryPredicate> predicates = Parse("t:Rigidbody active:1 self:0 root:yes layer:8 depth<3 scene:Main");
+    CHECK(predicates.size() == 7);
+    CHECK(predicates[0].kind == QueryPredicateKind::Type && predicates[0].text == "rigidbody");
+    CHECK(predicates[1].kind == QueryPredicateKind::Attribute && predicates[1].attribute == AttributeKind::Active && !predicates[1].negate);
+    CHECK(predicates[2].attribute == AttributeKind::ActiveSelf && predicates[2].negate); // :0 flips
+    CHECK(predicates[3].attribute == AttributeKind::Root && !predicates[3].negate);
+    CHECK(predicates[4].attribute == AttributeKind::Layer && predicates[4].attributeValue == 8);
+    CHECK(predicates[5].kind == QueryPredicateKind::Depth && predicates[5].compare == QueryCompare::Less && predicates[5].number == 3.0);
+    CHECK(predicates[6].kind == QueryPredicateKind::Scene && predicates[6].text == "main");
+
+    predicates = Parse("-active:0");
+    CHECK(predicates.size() == 1 && !predicates[0].negate); // not inactive
+
+    predicates = Parse("field:health<10 f:Speed>=2.5 field:ok!=false");
+    CHECK(predicates.size() == 3);
+    CHECK(predicates[0].kind == QueryPredicateKind::Field && predicates[0].text == "health");
+    CHECK(predicates[0].compare == QueryCompare::Less && predicates[0].number == 10.0);
+    CHECK(predicates[1].text == "Speed" && predicates[1].compare == QueryCompare::GreaterEqual && predicates[1].number == 2.5);
+    CHECK(predicates[2].compare == QueryCompare::NotEqual && predicates[2].number == 0.0);
+}
+
+static void TestErrors()
+{
+    Parse("layer:40", false);
+    Parse("layer<3", false);
+    Parse("active:maybe", false);
+    Parse("depth:-1", false);
+    Parse("field:health", false);
+    Parse("field<3", false);
+    Parse("t:", false);
+    Parse("path:/World[x]", false);
+
+    std::vector<QueryPredicate> predicates;
+    std::string error;
+    CHECK(!ParseObjectQuery("enemy layer:99", &predicates, &error));
+    CHECK(error.find("layer:99") != std::string::npos);
+}
+
+static void TestPaths()
+{
+    std::vector<QueryPredicate> predicates = Parse("path:/World/Spawn[2]/**/");
+    CHECK(predicates.size() == 1 && predicates[0].kind == QueryPredicateKind::PathGlob);
+    const std::vector<ObjectPathSegment>& path = predicates[0].path;
+    CHECK(path.size() == 4);
+    CHECK(path[0].name == "*" && path[1].name == "World" && !path[1].explicitOrdinal);
+    CHECK(path[2].name == "Spawn" && path[2].explicitOrdinal && path[2].ordinal == 2);
+    CHECK(path[3].name == "**");
+
+    std::vector<ObjectPathSegment> candidate;
+    CHECK(ParseObjectPath("Main/World/Spawn[2]/Wave/Enemy[3]", &candidate));
+    CHECK(PathGlobMatch(path, 0, candidate, 0));
+    CHECK(ParseObjectPath("Main/World/Spawn/Wave", &candidate));
+    CHECK(!PathGlobMatch(path, 0, candidate, 0));
+
+    // Escaped separators stay inside one name.
+    CHECK(ParseObjectPath("Main/A\\/B", &candidate));
+    CHECK(candidate.size() == 2 && candidate[1].name == "A/B");
+}
+
+static void TestGlobs()
+{
+    CHECK(GlobMatch("en*y", "EnemY"));
+    CHECK(GlobMatch("*", ""));
+    CHECK(GlobMatch("a?c", "abc"));
+    CHECK(!GlobMatch("a?c", "ac"));
+    CHECK(GlobMatch("*boss*", "MiniBoss01"));
+    CHECK(!GlobMatch("boss", "boss2"));
+    CHECK(LongestGlobLiteral("*Big*Bo?ss") == "big");
+    CHECK(LongestGlobLiteral("*?*").empty());
+}
+
+static void TestPlan()
+{
+    QueryPlan plan;
+    PlanObjectQuery(Parse("field:hp<3 en*y active:1 depth:2 depth>5"), &plan);
+
+    // Index stages: active, depth bucket 2, the glob's literal; filters: depth>5, glob, field.
+    CHECK(plan.indexed.size() == 3);
+    CHECK(plan.indexed[0].kind == QueryPredicateKind::Attribute);
+    CHECK(plan.indexed[1].kind == QueryPredicateKind::Attribute && plan.indexed[1].attribute == AttributeKind::DepthBucket);
+    CHECK(plan.indexed[2].kind == QueryPredicateKind::Name && plan.indexed[2].text == "en");
+    CHECK(plan.filters.size() == 3);
+    CHECK(plan.filters[0].kind == QueryPredicateKind::Depth);
+    CHECK(plan.filters[1].kind == QueryPredicateKind::NameGlob);
+    CHECK(plan.filters[2].kind == QueryPredicateKind::Field);
+
+    // A negated glob cannot be narrowed.
+    PlanObjectQuery(Parse("-en*y"), &plan);
+    CHECK(plan.indexed.empty() && plan.filters.size() == 1);
+
+    // "<literal>/**" is answered by the prefix stage alone; a pinned ordinal needs the filter.
+    PlanObjectQuery(Parse("path:/World/Spawn/**"), &plan);
+    CHECK(plan.indexed.size() == 1 && plan.indexed[0].kind == QueryPredicateKind::PathPrefix);
+    CHECK(plan.indexed[0].segments.size() == 2 && plan.indexed[0].text.empty());
+    CHECK(plan.filters.empty());
+
+    PlanObjectQuery(Parse("path:Main/World/Spawn[1]/**"), &plan);
+    CHECK(plan.indexed.size() == 1 && plan.indexed[0].text == "main");
+    CHECK(plan.filters.size() == 1);
+}
+
+static void TestPredicateKeys()
+{
+    const std::vector<QueryPredicate> predicates = Parse("field:hp<3 -field:hp<3 field:hp<4 field:HP<3 depth>2");
+    CHECK(QueryPredicateKey(predicates[0]) == QueryPredicateKey(predicates[1])); // negation aside
+    CHECK(QueryPredicateKey(predicates[0]) != QueryPredicateKey(predicates[2]));
+    CHECK(QueryPredicateKey(predicates[0]) != QueryPredicateKey(predicates[3])); // field names are exact
+    CHECK(QueryPredicateKey(predicates[0]) != QueryPredicateKey(predicates[4]));
+}
+
+int main()
+{
+    TestTokenizer();
+    TestNamesAndNegation();
+    TestUnknownKeysAreNames();
+    TestKeys();
+    TestErrors();
+    TestPaths();
+    TestGlobs();
+    TestPlan();
+    TestPredicateKeys();
+    return FinishChecks("object_query_test");
+}
@@ -0,0 +1,121 @@
+#include "SnapshotDiff.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace UExplorer;
+
+// DiffBytes against a byte-at-a-time loop: first checked for identical ranges on random
+// buffers, then timed over a class-wide diff's worth of instances.
+// Usage: snapshot_diff_bench [instances] [instance bytes]
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    void DiffBytesScalar(const uint8_t* a, const uint8_t* b, size_t size, std::vector<ByteRange>* out)
+    {
+        for (size_t i = 0; i < size; ++i)
+        {
+            if (a[i] == b[i])
+                continue;
+
+            if (!out->empty() && out->back().end == i)
+                out->back().end = static_cast<uint32_t>(i + 1);
+            else
+                out->push_back({ static_cast<uint32_t>(i), static_cast<uint32_t>(i + 1) });
+        }
+    }
+
+    bool SameRanges(const std::vector<ByteRange>& left, const std::vector<ByteRange>& right)
+    {
+        if (left.size() != right.size())
+            return false;
+
+        for (size_t i = 0; i < left.size(); ++i)
+        {
+            if (left[i].begin != right[i].begin || left[i].end != right[i].end)
+                return false;
+        }
+        return true;
+    }
+
+    template<typename DiffFn>
+    double BestMicros(DiffFn&& diff, const std::vector<uint8_t>& a, const std::vector<uint8_t>& b, size_t instances, size_t size,
+        std::vector<ByteRange>* out)
+    {
+        double best = 1e18;
+        for (int round = 0; round < 20; ++round)
+        {
+            out->clear();
+            const Clock::time_point start = Clock::now();
+            for (size_t i = 0; i < instances; ++i)
+                diff(a.data() + i * size, b.data() + i * size, size, out);
+            best = std::min(best, std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+        }
+        return best;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const size_t instances = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 10000U;
+    const size_t size = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 256U;
+
+    // Odd sizes exercise the tail loop; runs of flipped bytes exercise block-spanning ranges.
+    std::mt19937 rng(3);
+    for (int trial = 0; trial < 2000; ++trial)
+    {
+        const size_t length = rng() % 300;
+        std::vector<uint8_t> a(length);
+        for (uint8_t& value : a)
+            value = static_cast<uint8_t>(rng());
+        std::vector<uint8_t> b = a;
+
+        for (uint32_t flips = rng() % 10; flips > 0 && length; --flips)
+            b[rng() % length] ^= static_cast<uint8_t>(1 + rng() % 255);
+        if (length && rng() % 3 == 0)
+        {
+            const size_t begin = rng() % length;
+            const size_t end = begin + rng() % (length - begin);
+            for (size_t i = begin; i < end; ++i)
+                b[i] = static_cast<uint8_t>(~a[i]);
+        }
+
+        std::vector<ByteRange> fast;
+        std::vector<ByteRange> scalar;
+        DiffBytes(a.data(), b.data(), length, &fast);
+        DiffBytesScalar(a.data(), b.data(), length, &scalar);
+        if (!SameRanges(fast, scalar))
+        {
+            std::printf("MISMATCH in trial %d (%zu bytes)\n", trial, length);
+            return 1;
+        }
+    }
+
+    std::vector<uint8_t> baseline(instances * size);
+    for (uint8_t& value : baseline)
+        value = static_cast<uint8_t>(rng());
+    std::vector<uint8_t> live = baseline;
+    for (size_t i = 0; i < live.size() / 100; ++i)
+        live[rng() % live.size()] ^= 0x5A;
+
+    std::vector<ByteRange> ranges;
+    ranges.reserve(live.size() / 50);
+    const double megabytes = static_cast<double>(live.size()) / 1e6;
+    std::printf("%zu instances x %zu bytes (%.1f MB), 1%% of bytes changed\n", instances, size, megabytes);
+
+    const double fastMicros = BestMicros(DiffBytes, baseline, live, instances, size, &ranges);
+    const size_t fastRanges = ranges.size();
+    const double scalarMicros = BestMicros(DiffBytesScalar, baseline, live, instances, size, &ranges);
+    const size_t scalarRanges = ranges.size();
+    std::printf("DiffBytes: %8.0f us (%.2f GB/s), %zu ranges\n", fastMicros, megabytes * 1e3 / fastMicros, fastRanges);
+    std::printf("scalar   : %8.0f us (%.2f GB/s), %zu ranges\n", scalarMicros, megabytes * 1e3 / scalarMicros, scalarRanges);
+
+    live = baseline;
+    const double equalMicros = BestMicros(DiffBytes, baseline, live, instances, size, &ranges);
+    std::printf("unchanged: %8.0f us (%.2f GB/s)\n", equalMicros, megabytes * 1e3 / equalMicros);
+    return fastRanges == scalarRanges && ranges.empty() ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+#include "SpatialGrid.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace UExplorer;
+
+// Build, radius and frustum timings of the grid next to a linear scan over the same arrays.
+// Usage: spatial_grid_bench [objects]
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    double MicrosSince(Clock::time_point start)
+    {
+        return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const size_t count = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000U;
+    constexpr int kQueries = 200;
+
+    std::mt19937 rng(1);
+    std::normal_distribution<float> cluster(0.0f, 150.0f);
+    std::vector<float> xs(count), ys(count), zs(count);
+    for (size_t id = 0; id < count; ++id)
+    {
+        xs[id] = cluster(rng);
+        ys[id] = cluster(rng) * 0.1f;
+        zs[id] = cluster(rng);
+    }
+    Bitset valid;
+    valid.Resize(count, true);
+
+    SpatialGrid grid;
+    Clock::time_point start = Clock::now();
+    grid.Build(count, xs.data(), ys.data(), zs.data(), valid, 8.0f);
+    const double firstBuildMicros = MicrosSince(start);
+
+    // The overlay rebuilds the same grid, so later builds reuse its buffers.
+    constexpr int kRebuilds = 10;
+    start = Clock::now();
+    for (int rebuild = 0; rebuild < kRebuilds; ++rebuild)
+        grid.Build(count, xs.data(), ys.data(), zs.data(), valid, 8.0f);
+    std::printf("%zu objects, build %.0f us first, %.0f us rebuild\n", count, firstBuildMicros, MicrosSince(start) / kRebuilds);
+
+    std::uniform_real_distribution<float> where(-300.0f, 300.0f);
+    std::vector<float> centers(kQueries * 3);
+    for (float& value : centers)
+        value = where(rng);
+
+    const float radii[] = { 5.0f, 25.0f, 100.0f };
+    for (float radius : radii)
+    {
+        size_t gridHits = 0;
+        start = Clock::now();
+        for (int query = 0; query < kQueries; ++query)
+            grid.QueryRadius(&centers[query * 3], radius, [&gridHits](uint32_t, float) { ++gridHits; });
+        const double gridMicros = MicrosSince(start) / kQueries;
+
+        size_t bruteHits = 0;
+        start = Clock::now();
+        for (int query = 0; query < kQueries; ++query)
+        {
+            const float* center = &centers[query * 3];
+            for (size_t id = 0; id < count; ++id)
+            {
+                const float dx = xs[id] - center[0];
+                const float dy = ys[id] - center[1];
+                const float dz = zs[id] - center[2];
+                bruteHits += dx * dx + dy * dy + dz * dz <= radius * radius ? 1U : 0U;
+            }
+        }
+        const double bruteMicros = MicrosSince(start) / kQueries;
+
+        std::printf("radius %6.1f: grid %8.1f us  scan %8.1f us  (%zu hits/query%s)\n", radius, gridMicros, bruteMicros,
+            gridHits / kQueries, gridHits == bruteHits ? "" : ", MISMATCH");
+        if (gridHits != bruteHits)
+            return 1;
+    }
+
+    // Camera at the edge of the cloud looking across it.
+    const float nearPlane = 0.3f;
+    const float farPlane = 400.0f;
+    float projection[16]{};
+    projection[0] = 1.0f / 1.7778f;
+    projection[5] = 1.0f;
+    projection[10] = -(farPlane + nearPlane) / (farPlane - nearPlane);
+    projection[11] = -1.0f;
+    projection[14] = -2.0f * farPlane * nearPlane / (farPlane - nearPlane);
+    float view[16]{};
+    view[0] = view[5] = view[10] = view[15] = 1.0f;
+    view[14] = -300.0f;
+    float viewProjection[16];
+    Frustum::Multiply(projection, view, viewProjection);
+    const Frustum frustum = Frustum::FromViewProjection(viewProjection);
+
+    size_t gridHits = 0;
+    start = Clock::now();
+    for (int query = 0; query < kQueries; ++query)
+        grid.QueryFrustum(frustum, [&gridHits](uint32_t) { ++gridHits; });
+    const double gridMicros = MicrosSince(start) / kQueries;
+
+    size_t bruteHits = 0;
+    start = Clock::now();
+    for (int query = 0; query < kQueries; ++query)
+    {
+        for (size_t id = 0; id < count; ++id)
+            bruteHits += frustum.ContainsPoint(xs[id], ys[id], zs[id]) ? 1U : 0U;
+    }
+    const double bruteMicros = MicrosSince(start) / kQueries;
+
+    std::printf("frustum     : grid %8.1f us  scan %8.1f us  (%zu hits/query%s)\n", gridMicros, bruteMicros,
+        gridHits / kQueries, gridHits == bruteHits ? "" : ", MISMATCH");
+    return gridHits == bruteHits ? 0 : 1;
+}
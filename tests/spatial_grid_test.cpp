@@ -0,0 +1,318 @@
+#include "SpatialGrid.hpp"
+#include "Check.hpp"
+
+#include <random>
+
+using namespace UExplorer;
+
+namespace
+{
+    // A scene-shaped point cloud: mostly clustered, a few far outliers, some invalid or NaN.
+    struct Cloud
+    {
+        std::vector<float> xs, ys, zs;
+        Bitset valid;
+
+        explicit Cloud(size_t count, uint32_t seed)
+        {
+            std::mt19937 rng(seed);
+            std::normal_distribution<float> cluster(0.0f, 40.0f);
+            std::uniform_real_distribution<float> far(-5000.0f, 5000.0f);
+            std::uniform_int_distribution<int> pick(0, 99);
+
+            xs.resize(count);
+            ys.resize(count);
+            zs.resize(count);
+            valid.Resize(count);
+            for (size_t id = 0; id < count; ++id)
+            {
+                const int roll = pick(rng);
+                const bool outlier = roll < 5;
+                xs[id] = outlier ? far(rng) : cluster(rng);
+                ys[id] = outlier ? far(rng) : cluster(rng) * 0.25f;
+                zs[id] = outlier ? far(rng) : cluster(rng);
+                if (roll == 99)
+                    xs[id] = std::numeric_limits<float>::quiet_NaN();
+                if (roll != 98)
+                    valid.Set(id);
+            }
+        }
+
+        bool Indexed(size_t id) const
+        {
+            return valid.Test(id) && !std::isnan(xs[id]);
+        }
+    };
+
+    std::vector<uint32_t> Sorted(std::vector<uint32_t> ids)
+    {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    std::vector<uint32_t> GridRadius(const SpatialGrid& grid, const float* center, float radius)
+    {
+        std::vector<uint32_t> ids;
+        grid.QueryRadius(center, radius, [&ids](uint32_t id, float) { ids.push_back(id); });
+        return Sorted(std::move(ids));
+    }
+
+    std::vector<uint32_t> BruteRadius(const Cloud& cloud, const float* center, float radius)
+    {
+        std::vector<uint32_t> ids;
+        for (size_t id = 0; id < cloud.xs.size(); ++id)
+        {
+            const float dx = cloud.xs[id] - center[0];
+            const float dy = cloud.ys[id] - center[1];
+            const float dz = cloud.zs[id] - center[2];
+            if (cloud.Indexed(id) && dx * dx + dy * dy + dz * dz <= radius * radius)
+                ids.push_back(static_cast<uint32_t>(id));
+        }
+        return ids;
+    }
+
+    // Column-major perspective looking down -Z from the origin, then translated by -eye.
+    void ViewProjection(const float* eye, float* out)
+    {
+        const float nearPlane = 0.3f;
+        const float farPlane = 1000.0f;
+        const float f = 1.0f / std::tan(0.5f * 1.0472f); // 60 degree vertical fov
+        const float aspect = 16.0f / 9.0f;
+
+        float projection[16]{};
+        projection[0] = f / aspect;
+        projection[5] = f;
+        projection[10] = -(farPlane + nearPlane) / (farPlane - nearPlane);
+        projection[11] = -1.0f;
+        projection[14] = -2.0f * farPlane * nearPlane / (farPlane - nearPlane);
+
+        float view[16]{};
+        view[0] = view[5] = view[10] = view[15] = 1.0f;
+        view[12] = -eye[0];
+        view[13] = -eye[1];
+        view[14] = -eye[2];
+
+        Frustum::Multiply(projection, view, out);
+    }
+}
+
+static void TestRadiusMatchesBruteForce()
+{
+    Cloud cloud(20000, 1);
+    SpatialGrid grid;
+    grid.Build(cloud.xs.size(), cloud.xs.data(), cloud.ys.data(), cloud.zs.data(), cloud.valid, 8.0f);
+
+    size_t indexed = 0;
+    for (size_t id = 0; id < cloud.xs.size(); ++id)
+    {
+        indexed += cloud.Indexed(id) ? 1U : 0U;
+        CHECK(grid.Contains(static_cast<uint32_t>(id)) == cloud.Indexed(id));
+    }
+    CHECK(grid.InsertedCount() == indexed);
+
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<float> where(-150.0f, 150.0f);
+    const float radii[] = { 0.5f, 4.0f, 25.0f, 300.0f, 20000.0f }; // the last takes the linear path
+    for (int query = 0; query < 40; ++query)
+    {
+        const float center[3] = { where(rng), where(rng) * 0.25f, where(rng) };
+        for (float radius : radii)
+            CHECK(GridRadius(grid, center, radius) == BruteRadius(cloud, center, radius));
+    }
+}
+
+static void TestUpdatesMatchBruteForce()
+{
+    Cloud cloud(5000, 3);
+    SpatialGrid grid;
+    grid.Build(cloud.xs.size(), cloud.xs.data(), cloud.ys.data(), cloud.zs.data(), cloud.valid, 4.0f);
+
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<uint32_t> pickId(0, 4999);
+    std::uniform_real_distribution<float> step(-20.0f, 20.0f);
+    for (int round = 0; round < 2000; ++round)
+    {
+        const uint32_t id = pickId(rng);
+        if (round % 10 == 0)
+        {
+            grid.Remove(id);
+            cloud.valid.Reset(id);
+            continue;
+        }
+
+        // Moving an object (re)inserts it, as for a transform that became readable again.
+        const float x = std::isnan(cloud.xs[id]) ? 0.0f : cloud.xs[id] + step(rng);
+        cloud.xs[id] = x;
+        cloud.ys[id] += step(rng);
+        cloud.zs[id] += step(rng);
+        cloud.valid.Set(id);
+        grid.Update(id, cloud.xs[id], cloud.ys[id], cloud.zs[id]);
+    }
+
+    // A NaN move drops the object.
+    grid.Update(7, std::numeric_limits<float>::quiet_NaN(), 0.0f, 0.0f);
+    cloud.xs[7] = std::numeric_limits<float>::quiet_NaN();
+    CHECK(!grid.Contains(7));
+
+    size_t indexed = 0;
+    for (size_t id = 0; id < cloud.xs.size(); ++id)
+        indexed += cloud.Indexed(id) ? 1U : 0U;
+    CHECK(grid.InsertedCount() == indexed);
+
+    for (int query = 0; query < 40; ++query)
+    {
+        const float center[3] = { step(rng) * 5.0f, step(rng), step(rng) * 5.0f };
+        CHECK(GridRadius(grid, center, 12.0f) == BruteRadius(cloud, center, 12.0f));
+        CHECK(GridRadius(grid, center, 90.0f) == BruteRadius(cloud, center, 90.0f));
+    }
+}
+
+static void TestNearest()
+{
+    Cloud cloud(8000, 5);
+    SpatialGrid grid;
+    grid.Build(cloud.xs.size(), cloud.xs.data(), cloud.ys.data(), cloud.zs.data(), cloud.valid, 8.0f);
+
+    std::vector<SpatialGrid::Neighbor> neighbors;
+    const float center[3] = { 10.0f, 0.0f, -10.0f };
+    grid.Nearest(center, 16, 1.0e6f, &neighbors);
+    CHECK(neighbors.size() == 16);
+
+    std::vector<SpatialGrid::Neighbor> brute;
+    for (size_t id = 0; id < cloud.xs.size(); ++id)
+    {
+        if (cloud.Indexed(id))
+            brute.push_back({ grid.DistanceSq(static_cast<uint32_t>(id), center), static_cast<uint32_t>(id) });
+    }
+    std::sort(brute.begin(), brute.end(), [](const SpatialGrid::Neighbor& left, const SpatialGrid::Neighbor& right)
+        {
+            return left.distanceSq < right.distanceSq || (left.distanceSq == right.distanceSq && left.id < right.id);
+        });
+    for (size_t i = 0; i < neighbors.size(); ++i)
+        CHECK(neighbors[i].id == brute[i].id);
+
+    // Capped by maxRadius: only what lies inside it.
+    grid.Nearest(center, 1000, 3.0f, &neighbors);
+    for (const SpatialGrid::Neighbor& neighbor : neighbors)
+        CHECK(neighbor.distanceSq <= 9.0f);
+}
+
+static void TestFrustumMatchesBruteForce()
+{
+    Cloud cloud(20000, 6);
+    SpatialGrid grid;
+    grid.Build(cloud.xs.size(), cloud.xs.data(), cloud.ys.data(), cloud.zs.data(), cloud.valid, 8.0f);
+
+    const float eyes[][3] = { { 0.0f, 0.0f, 200.0f }, { 0.0f, 5.0f, 0.0f }, { 3000.0f, 0.0f, 0.0f } };
+    for (const float* eye : eyes)
+    {
+        float viewProjection[16];
+        ViewProjection(eye, viewProjection);
+        const Frustum frustum = Frustum::FromViewProjection(viewProjection);
+
+        std::vector<uint32_t> fromGrid;
+        grid.QueryFrustum(frustum, [&fromGrid](uint32_t id) { fromGrid.push_back(id); });
+
+        std::vector<uint32_t> brute;
+        for (size_t id = 0; id < cloud.xs.size(); ++id)
+        {
+            if (cloud.Indexed(id) && frustum.ContainsPoint(cloud.xs[id], cloud.ys[id], cloud.zs[id]))
+                brute.push_back(static_cast<uint32_t>(id));
+        }
+
+        CHECK(Sorted(std::move(fromGrid)) == brute);
+    }
+
+    // The planes agree with clip space: straight ahead is in, behind the eye is not.
+    float viewProjection[16];
+    const float eye[3] = { 0.0f, 0.0f, 0.0f };
+    ViewProjection(eye, viewProjection);
+    const Frustum frustum = Frustum::FromViewProjection(viewProjection);
+    CHECK(frustum.ContainsPoint(0.0f, 0.0f, -10.0f));
+    CHECK(!frustum.ContainsPoint(0.0f, 0.0f, 10.0f));
+    CHECK(!frustum.ContainsPoint(0.0f, 0.0f, -2000.0f));
+}
+
+// A tight cloud takes the counting-sort build, and objects past the key window stay loose;
+// both must answer like the brute-force scan.
+static void CheckQueriesMatchBruteForce(const SpatialGrid& grid, const Cloud& cloud)
+{
+    std::mt19937 rng(8);
+    std::uniform_real_distribution<float> where(-150.0f, 150.0f);
+    for (int query = 0; query < 40; ++query)
+    {
+        const float center[3] = { where(rng), where(rng) * 0.25f, where(rng) };
+        CHECK(GridRadius(grid, center, 4.0f) == BruteRadius(cloud, center, 4.0f));
+        CHECK(GridRadius(grid, center, 60.0f) == BruteRadius(cloud, center, 60.0f));
+
+        const float boxMin[3] = { center[0] - 30.0f, center[1] - 5.0f, center[2] - 30.0f };
+        const float boxMax[3] = { center[0] + 30.0f, center[1] + 5.0f, center[2] + 30.0f };
+        std::vector<uint32_t> fromGrid;
+        grid.QueryBox(boxMin, boxMax, [&fromGrid](uint32_t id) { fromGrid.push_back(id); });
+        std::vector<uint32_t> brute;
+        for (size_t id = 0; id < cloud.xs.size(); ++id)
+        {
+            if (cloud.Indexed(id) && cloud.xs[id] >= boxMin[0] && cloud.xs[id] <= boxMax[0] && cloud.ys[id] >= boxMin[1]
+                && cloud.ys[id] <= boxMax[1] && cloud.zs[id] >= boxMin[2] && cloud.zs[id] <= boxMax[2])
+            {
+                brute.push_back(static_cast<uint32_t>(id));
+            }
+        }
+        CHECK(Sorted(std::move(fromGrid)) == brute);
+    }
+
+    float viewProjection[16];
+    const float eye[3] = { 0.0f, 10.0f, 150.0f };
+    ViewProjection(eye, viewProjection);
+    const Frustum frustum = Frustum::FromViewProjection(viewProjection);
+    std::vector<uint32_t> fromGrid;
+    grid.QueryFrustum(frustum, [&fromGrid](uint32_t id) { fromGrid.push_back(id); });
+    std::vector<uint32_t> brute;
+    for (size_t id = 0; id < cloud.xs.size(); ++id)
+    {
+        if (cloud.Indexed(id) && frustum.ContainsPoint(cloud.xs[id], cloud.ys[id], cloud.zs[id]))
+            brute.push_back(static_cast<uint32_t>(id));
+    }
+    CHECK(Sorted(std::move(fromGrid)) == brute);
+}
+
+static void TestDenseAndFarLayouts()
+{
+    Cloud cloud(20000, 7);
+    for (size_t id = 0; id < cloud.xs.size(); ++id)
+    {
+        if (std::fabs(cloud.xs[id]) > 400.0f || std::fabs(cloud.ys[id]) > 400.0f || std::fabs(cloud.zs[id]) > 400.0f)
+            cloud.xs[id] = cloud.ys[id] = cloud.zs[id] = 0.0f;
+    }
+
+    SpatialGrid grid;
+    grid.Build(cloud.xs.size(), cloud.xs.data(), cloud.ys.data(), cloud.zs.data(), cloud.valid, 8.0f);
+    CHECK(grid.LooseCount() == 0);
+    CheckQueriesMatchBruteForce(grid, cloud);
+
+    const float farAway[][3] = { { 1.0e8f, 0.0f, 0.0f }, { 1.0e8f, 1.0f, 0.5f }, { -3.0e7f, 2.0e7f, 0.0f } };
+    for (size_t i = 0; i < 3; ++i)
+    {
+        cloud.xs[i] = farAway[i][0];
+        cloud.ys[i] = farAway[i][1];
+        cloud.zs[i] = farAway[i][2];
+        cloud.valid.Set(i);
+    }
+    grid.Build(cloud.xs.size(), cloud.xs.data(), cloud.ys.data(), cloud.zs.data(), cloud.valid, 8.0f);
+    CHECK(grid.LooseCount() == 3);
+    CheckQueriesMatchBruteForce(grid, cloud);
+
+    const float center[3] = { 1.0e8f, 0.0f, 0.0f };
+    CHECK(GridRadius(grid, center, 2.0f).size() == 2);
+    CHECK(GridRadius(grid, center, 2.0f) == BruteRadius(cloud, center, 2.0f));
+}
+
+int main()
+{
+    TestRadiusMatchesBruteForce();
+    TestUpdatesMatchBruteForce();
+    TestNearest();
+    TestFrustumMatchesBruteForce();
+    TestDenseAndFarLayouts();
+    return FinishChecks("spatial_grid_test");
+}
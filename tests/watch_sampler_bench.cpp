@@ -0,0 +1,161 @@
+#include "WatchSampler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace UExplorer;
+
+// WatchSampler::Tick over watches spread across scattered heap objects, one to three hops
+// deep, read the way the overlay reads them minus the fault guard. Every ring is first checked
+// against the values written; then ticks are timed against the per-tick budget of 1000
+// watches sampled at 60 Hz, back to back and with the caches flushed before each tick, as a
+// frame of game work would leave them.
+// Usage: watch_sampler_bench [watches]
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    constexpr double kBudgetMicros = 200.0;
+
+    // Stand-in for a managed object: a header, a reference, then value fields.
+    struct FakeObject
+    {
+        void* klass = nullptr;
+        void* monitor = nullptr;
+        FakeObject* next = nullptr;
+        float speed = 0.0f;
+        int32_t count = 0;
+        double elapsed = 0.0;
+    };
+
+    bool ReadProbe(const WatchProbe& probe, double* outValue)
+    {
+        const uintptr_t address = ResolveWatchAddress(probe);
+        if (!address)
+            return false;
+
+        *outValue = LoadWatchValue(address, probe.kind);
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const size_t watchCount = std::min<size_t>(argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000U, WatchSampler::kMaxWatches);
+    constexpr int kTicks = 200;
+
+    // Chains of three objects, allocated one by one and linked in shuffled order so the hops
+    // land across the heap rather than in one array.
+    std::mt19937 rng(5);
+    std::vector<std::unique_ptr<FakeObject>> objects;
+    for (size_t i = 0; i < watchCount * 3U; ++i)
+    {
+        objects.push_back(std::make_unique<FakeObject>());
+        objects.back()->speed = static_cast<float>(i) * 0.5f;
+        objects.back()->count = static_cast<int32_t>(i);
+        objects.back()->elapsed = static_cast<double>(i) * 0.25;
+    }
+    std::shuffle(objects.begin(), objects.end(), rng);
+    for (size_t i = 0; i + 2 < objects.size(); i += 3)
+    {
+        objects[i]->next = objects[i + 1].get();
+        objects[i + 1]->next = objects[i + 2].get();
+    }
+
+    WatchSampler sampler;
+    sampler.SetIntervalMicros(0);
+    std::vector<WatchProbe> probes;
+    std::vector<double> expected;
+    for (size_t w = 0; w < watchCount; ++w)
+    {
+        const FakeObject* head = objects[(w % (objects.size() / 3U)) * 3U].get();
+        WatchProbe probe{};
+        probe.base = reinterpret_cast<uintptr_t>(head);
+        probe.hopCount = static_cast<uint8_t>(1U + w % 3U);
+        for (uint32_t hop = 0; hop + 1 < probe.hopCount; ++hop)
+            probe.offsets[hop] = static_cast<int32_t>(offsetof(FakeObject, next));
+
+        const FakeObject* target = head;
+        for (uint32_t hop = 0; hop + 1 < probe.hopCount; ++hop)
+            target = target->next;
+
+        switch (w % 4U)
+        {
+        case 0:
+        case 1:
+            probe.kind = WatchValueKind::F32;
+            probe.offsets[probe.hopCount - 1] = static_cast<int32_t>(offsetof(FakeObject, speed));
+            expected.push_back(target->speed);
+            break;
+        case 2:
+            probe.kind = WatchValueKind::I32;
+            probe.offsets[probe.hopCount - 1] = static_cast<int32_t>(offsetof(FakeObject, count));
+            expected.push_back(target->count);
+            break;
+        default:
+            probe.kind = WatchValueKind::F64;
+            probe.offsets[probe.hopCount - 1] = static_cast<int32_t>(offsetof(FakeObject, elapsed));
+            expected.push_back(static_cast<float>(target->elapsed));
+            break;
+        }
+
+        if (!sampler.AcquireRing(&probe.ring))
+        {
+            std::printf("out of rings at watch %zu\n", w);
+            return 1;
+        }
+        probes.push_back(probe);
+    }
+    const std::vector<WatchProbe> published = probes;
+    sampler.Publish(std::move(probes));
+
+    sampler.Tick(ReadProbe);
+    float history[SampleRing::kCapacity];
+    for (size_t w = 0; w < published.size(); ++w)
+    {
+        const size_t count = sampler.Ring(published[w].ring).Copy(history);
+        if (count != 1 || history[0] != static_cast<float>(expected[w]))
+        {
+            std::printf("MISMATCH on watch %zu: %zu sample(s), %f expected %f\n", w, count, count ? history[0] : 0.0f, expected[w]);
+            return 1;
+        }
+    }
+
+    std::vector<uint8_t> evict(64U << 20);
+    auto timeTicks = [&](const char* label, bool flush)
+        {
+            sampler.ResetPeak();
+            double totalMicros = 0.0;
+            double bestMicros = 1e18;
+            for (int tick = 0; tick < kTicks; ++tick)
+            {
+                if (flush)
+                {
+                    for (size_t i = 0; i < evict.size(); i += 64)
+                        ++evict[i];
+                }
+
+                const Clock::time_point start = Clock::now();
+                sampler.Tick(ReadProbe);
+                const double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+                totalMicros += micros;
+                bestMicros = std::min(bestMicros, micros);
+            }
+
+            const double meanMicros = totalMicros / kTicks;
+            std::printf("%s: mean %6.1f us, best %6.1f us, peak %6.1f us%s\n", label, meanMicros, bestMicros,
+                sampler.GetStats().microsPeak, meanMicros > kBudgetMicros ? "  OVER BUDGET" : "");
+        };
+
+    std::printf("%zu watches, %d ticks each, budget %.0f us per tick\n", watchCount, kTicks, kBudgetMicros);
+    timeTicks("warm", false);
+    timeTicks("cold", true);
+
+    const WatchSampler::Stats stats = sampler.GetStats();
+    return stats.failedLastTick == 0 ? 0 : 1;
+}